@@ -1,15 +1,16 @@
 ﻿// SPDX-FileCopyrightText: Copyright 2025-2026 shadLauncher4 Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
 #include <array>
+#include <mutex>
 #include <Windows.h>
 #include <bcrypt.h>
 #include "crypto.h"
 #include "key_manager.h"
 #include "picosha2.h"
 
-template <typename TKeyset>
-static BCRYPT_KEY_HANDLE ImportRsaPrivateKey(const TKeyset& keyset) {
+static BCRYPT_KEY_HANDLE ImportRsaPrivateKey(const KeyManager::RsaKey2048& keyset) {
     BCRYPT_ALG_HANDLE alg = nullptr;
     BCRYPT_KEY_HANDLE key = nullptr;
 
@@ -17,29 +18,26 @@ static BCRYPT_KEY_HANDLE ImportRsaPrivateKey(const TKeyset& keyset) {
         throw std::runtime_error("BCryptOpenAlgorithmProvider failed");
     }
 
-    const ULONG blobSize = sizeof(BCRYPT_RSAKEY_BLOB) + keyset.PublicExponent.size() +
-                           keyset.Modulus.size() + keyset.Prime1.size() + keyset.Prime2.size() +
-                           keyset.Exponent1.size() + keyset.Exponent2.size() +
-                           keyset.Coefficient.size() + keyset.PrivateExponent.size();
-
-    std::vector<u8> blob(blobSize);
+    const std::span<const u8> public_exponent(keyset.PublicExponent.data(),
+                                              keyset.PublicExponentSize);
+    std::array<u8, sizeof(BCRYPT_RSAKEY_BLOB) + sizeof(KeyManager::RsaKey2048)> blob{};
     auto* hdr = reinterpret_cast<BCRYPT_RSAKEY_BLOB*>(blob.data());
 
     hdr->Magic = BCRYPT_RSAFULLPRIVATE_MAGIC;
     hdr->BitLength = keyset.Modulus.size() * 8;
-    hdr->cbPublicExp = keyset.PublicExponent.size();
+    hdr->cbPublicExp = public_exponent.size();
     hdr->cbModulus = keyset.Modulus.size();
     hdr->cbPrime1 = keyset.Prime1.size();
     hdr->cbPrime2 = keyset.Prime2.size();
 
     u8* p = blob.data() + sizeof(BCRYPT_RSAKEY_BLOB);
 
-    auto copy = [&](const std::vector<u8>& v) {
+    auto copy = [&](std::span<const u8> v) {
         memcpy(p, v.data(), v.size());
         p += v.size();
     };
 
-    copy(keyset.PublicExponent);
+    copy(public_exponent);
     copy(keyset.Modulus);
     copy(keyset.Prime1);
     copy(keyset.Prime2);
@@ -49,7 +47,7 @@ static BCRYPT_KEY_HANDLE ImportRsaPrivateKey(const TKeyset& keyset) {
     copy(keyset.PrivateExponent); // d
 
     if (BCryptImportKeyPair(alg, nullptr, BCRYPT_RSAFULLPRIVATE_BLOB, &key, blob.data(),
-                            blob.size(), 0) != 0) {
+                            static_cast<ULONG>(p - blob.data()), 0) != 0) {
         BCryptCloseAlgorithmProvider(alg, 0);
         throw std::runtime_error("BCryptImportKeyPair failed");
     }
@@ -58,26 +56,42 @@ static BCRYPT_KEY_HANDLE ImportRsaPrivateKey(const TKeyset& keyset) {
     return key;
 }
 
+// Imported keys are kept until the keys of the KeyManager change, a PKG needs two RSA decryptions
+// and importing the key pair costs more than decrypting with it
+struct ImportedRsaKey {
+    u64 generation = 0;
+    BCRYPT_KEY_HANDLE handle = nullptr;
+};
+static std::mutex rsa_key_mutex;
+static std::array<ImportedRsaKey, 2> rsa_keys; // Fake keyset, derived key 3 keyset
+
 void Crypto::RSA2048Decrypt(std::span<u8, 32> dec_key, std::span<const u8, 256> ciphertext,
                             bool is_dk3) {
-    BCRYPT_KEY_HANDLE key = nullptr;
-
-    if (is_dk3) {
-        const auto& ks = KeyManager::GetInstance()->GetAllKeys().PkgDerivedKey3Keyset;
-        key = ImportRsaPrivateKey(ks);
-    } else {
-        const auto& ks = KeyManager::GetInstance()->GetAllKeys().FakeKeyset;
-        key = ImportRsaPrivateKey(ks);
+    const auto key_manager = KeyManager::GetInstance();
+    const u64 generation = KeyManager::GetGeneration();
+
+    std::scoped_lock lock{rsa_key_mutex};
+    ImportedRsaKey& key = rsa_keys[is_dk3 ? 1 : 0];
+    if (!key.handle || key.generation != generation) {
+        const auto& table = key_manager->GetKeyTable();
+        const auto& keyset = is_dk3 ? table.PkgDerivedKey3Keyset : table.FakeKeyset;
+        if (!keyset) {
+            throw std::runtime_error("RSA key is missing or invalid");
+        }
+        if (key.handle) {
+            BCryptDestroyKey(key.handle);
+            key.handle = nullptr;
+        }
+        key.handle = ImportRsaPrivateKey(*keyset);
+        key.generation = generation;
     }
 
     std::array<u8, 256> plaintext{};
     DWORD outSize = 0;
 
-    NTSTATUS st =
-        BCryptDecrypt(key, const_cast<u8*>(ciphertext.data()), ciphertext.size(), nullptr, nullptr,
-                      0, plaintext.data(), plaintext.size(), &outSize, BCRYPT_PAD_PKCS1);
-
-    BCryptDestroyKey(key);
+    NTSTATUS st = BCryptDecrypt(key.handle, const_cast<u8*>(ciphertext.data()), ciphertext.size(),
+                                nullptr, nullptr, 0, plaintext.data(), plaintext.size(), &outSize,
+                                BCRYPT_PAD_PKCS1);
 
     if (st < 0) {
         throw std::runtime_error("RSA decrypt failed");
@@ -244,6 +258,27 @@ inline bool cpu_supports_avx2() {
 #endif
     return false;
 }
+
+inline bool cpu_supports_aes() {
+    int info[4] = {0, 0, 0, 0};
+
+#ifdef _MSC_VER
+    __cpuid(info, 1);
+    return (info[2] & (1 << 25)) != 0; // AES-NI = ECX bit 25
+#else
+    unsigned int eax, ebx, ecx, edx;
+    if (__get_cpuid(1, &eax, &ebx, &ecx, &edx)) {
+        return (ecx & (1 << 25)) != 0; // AES-NI = ECX bit 25
+    }
+#endif
+    return false;
+}
+
+bool Crypto::HasAesNi() {
+    static const bool supported = cpu_supports_aes();
+    return supported;
+}
+
 void Crypto::decryptPFS(std::span<const u8, 16> dataKey, std::span<const u8, 16> tweakKey,
                         std::span<const u8> src_image, std::span<u8> dst_image, u64 sector_start) {
     if (cpu_supports_avx2()) {
@@ -534,55 +569,82 @@ void Crypto::PfsGenCryptoKey(std::span<const u8, 32> ekpfs, std::span<const u8,
     std::copy(hmac_result.begin(), hmac_result.begin() + 16, tweakKey.begin());
     std::copy(hmac_result.begin() + 16, hmac_result.end(), dataKey.begin());
 }
-__attribute__((target("aes"))) void Crypto::decryptEFSM(std::span<u8, 16> trophyKey,
-                                                        std::span<u8, 16> NPcommID,
-                                                        std::span<u8, 16> efsmIv,
-                                                        std::span<u8> ciphertext,
+__attribute__((target("aes"))) void Crypto::decryptEFSM(std::span<const u8, 16> trophyKey,
+                                                        std::span<const u8, 16> NPcommID,
+                                                        std::span<const u8, 16> efsmIv,
+                                                        std::span<const u8> ciphertext,
                                                         std::span<u8> decrypted) {
     constexpr size_t BLOCK_SIZE = 16;
+    constexpr size_t LANES = 4;
 
     if (ciphertext.size() != decrypted.size()) {
         throw std::runtime_error("Invalid ciphertext/decrypted sizes");
     }
 
-    // Step 1: Encrypt NPcommID with trophyKey (ECB since IV is zero)
-    AES128Key trophyEncKey;
-    aes128_set_encrypt_key(trophyKey.data(), trophyEncKey);
+    // Step 1: Encrypt NPcommID with trophyKey (ECB since IV is zero). Every file of a trophy set
+    // and every set after it uses the same trophy key, so its schedule is only expanded once.
+    struct TrophyKeySchedule {
+        std::array<u8, BLOCK_SIZE> key{};
+        AES128Key encKey;
+        bool valid = false;
+    };
+    thread_local TrophyKeySchedule trophySchedule;
+    if (!trophySchedule.valid ||
+        !std::equal(trophyKey.begin(), trophyKey.end(), trophySchedule.key.begin())) {
+        std::copy(trophyKey.begin(), trophyKey.end(), trophySchedule.key.begin());
+        aes128_set_encrypt_key(trophyKey.data(), trophySchedule.encKey);
+        trophySchedule.valid = true;
+    }
 
     alignas(16) std::array<u8, BLOCK_SIZE> trpKey;
-    aes128_encrypt_block(NPcommID.data(), trpKey.data(), trophyEncKey);
+    aes128_encrypt_block(NPcommID.data(), trpKey.data(), trophySchedule.encKey);
 
     // Step 2: Setup decryption for trpKey
     AES128Key trpEncKey, trpDecKey;
     aes128_set_encrypt_key(trpKey.data(), trpEncKey);
     aes128_set_decrypt_key(trpEncKey, trpDecKey);
 
-    // CBC decryption
+    // CBC decryption. Unlike encryption, every block only depends on ciphertext, so four blocks
+    // go through the AES rounds together and hide the latency of aesdec.
+    const u8* src = ciphertext.data();
+    u8* dst = decrypted.data();
+    const size_t num_blocks = ciphertext.size() / BLOCK_SIZE;
     __m128i prevCipherBlock = _mm_loadu_si128(reinterpret_cast<const __m128i*>(efsmIv.data()));
 
-    size_t num_blocks = ciphertext.size() / BLOCK_SIZE;
-
-    for (size_t i = 0; i < num_blocks; ++i) {
-        size_t offset = i * BLOCK_SIZE;
-        const u8* cipher_ptr = ciphertext.data() + offset;
-        u8* decrypted_ptr = decrypted.data() + offset;
+    size_t i = 0;
+    for (; i + LANES <= num_blocks; i += LANES) {
+        __m128i cipherBlocks[LANES];
+        __m128i blocks[LANES];
+        for (size_t lane = 0; lane < LANES; ++lane) {
+            cipherBlocks[lane] = _mm_loadu_si128(
+                reinterpret_cast<const __m128i*>(src + (i + lane) * BLOCK_SIZE));
+            blocks[lane] = _mm_xor_si128(cipherBlocks[lane], trpDecKey.roundKeys[0]);
+        }
+        for (int round = 1; round < 10; ++round) {
+            for (size_t lane = 0; lane < LANES; ++lane) {
+                blocks[lane] = _mm_aesdec_si128(blocks[lane], trpDecKey.roundKeys[round]);
+            }
+        }
+        for (size_t lane = 0; lane < LANES; ++lane) {
+            blocks[lane] = _mm_aesdeclast_si128(blocks[lane], trpDecKey.roundKeys[10]);
+            blocks[lane] = _mm_xor_si128(blocks[lane], prevCipherBlock);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + (i + lane) * BLOCK_SIZE),
+                             blocks[lane]);
+            prevCipherBlock = cipherBlocks[lane];
+        }
+    }
 
-        // Load ciphertext
-        __m128i cipherBlock = _mm_loadu_si128(reinterpret_cast<const __m128i*>(cipher_ptr));
+    for (; i < num_blocks; ++i) {
+        const u8* cipher_ptr = src + i * BLOCK_SIZE;
+        const __m128i cipherBlock = _mm_loadu_si128(reinterpret_cast<const __m128i*>(cipher_ptr));
 
-        // Use your aes128_decrypt_block function
         alignas(16) u8 decryptedBlockBytes[BLOCK_SIZE];
         aes128_decrypt_block(cipher_ptr, decryptedBlockBytes, trpDecKey);
 
-        // XOR with previous block
-        __m128i decryptedBlock =
+        const __m128i decryptedBlock =
             _mm_load_si128(reinterpret_cast<const __m128i*>(decryptedBlockBytes));
-        __m128i plainBlock = _mm_xor_si128(decryptedBlock, prevCipherBlock);
-
-        // Store result
-        _mm_storeu_si128(reinterpret_cast<__m128i*>(decrypted_ptr), plainBlock);
-
-        // Update previous block
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i * BLOCK_SIZE),
+                         _mm_xor_si128(decryptedBlock, prevCipherBlock));
         prevCipherBlock = cipherBlock;
     }
 }
\ No newline at end of file
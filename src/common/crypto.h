@@ -8,6 +8,9 @@
 
 class Crypto {
 public:
+    /// Whether the CPU has the AES instructions the AES-NI paths below are built on
+    static bool HasAesNi();
+
     void RSA2048Decrypt(std::span<u8, 32> dk3, std::span<const u8, 256> ciphertext,
                         bool is_dk3); // RSAES_PKCS1v15_
     void ivKeyHASH256(std::span<const u8, 64> cipher_input, std::span<u8, 32> ivkey_result);
@@ -15,8 +18,9 @@ public:
                              std::span<u8, 256> decrypted);
     void aesCbcCfb128DecryptEntry(std::span<const u8, 32> ivkey, std::span<u8> ciphertext,
                                   std::span<u8> decrypted);
-    void decryptEFSM(std::span<u8, 16> trophyKey, std::span<u8, 16> NPcommID,
-                     std::span<u8, 16> efsmIv, std::span<u8> ciphertext, std::span<u8> decrypted);
+    void decryptEFSM(std::span<const u8, 16> trophyKey, std::span<const u8, 16> NPcommID,
+                     std::span<const u8, 16> efsmIv, std::span<const u8> ciphertext,
+                     std::span<u8> decrypted);
     void PfsGenCryptoKey(std::span<const u8, 32> ekpfs, std::span<const u8, 16> seed,
                          std::span<u8, 16> dataKey, std::span<u8, 16> tweakKey);
     void decryptPFS(std::span<const u8, 16> dataKey, std::span<const u8, 16> tweakKey,
@@ -0,0 +1,37 @@
+// SPDX-FileCopyrightText: Copyright 2025-2026 shadLauncher4 Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "common/dir_listing.h"
+#include "common/path_util.h"
+#include "common/string_util.h"
+
+namespace Common::FS {
+
+namespace fs = std::filesystem;
+
+DirectoryListing::DirectoryListing(const fs::path& dir) {
+    std::error_code ec;
+    for (fs::directory_iterator it(dir, ec), end; it != end && !ec; it.increment(ec)) {
+        // The file type comes from the directory entry itself on all major platforms, so this
+        // does not cost an extra stat() per file.
+        if (!it->is_regular_file(ec)) {
+            continue;
+        }
+        std::string name = PathToUTF8String(it->path().filename());
+        m_files.insert_or_assign(Common::ToLower(name), std::move(name));
+    }
+}
+
+bool DirectoryListing::Contains(std::string_view name) const {
+    return Find(name) != nullptr;
+}
+
+const std::string* DirectoryListing::Find(std::string_view name) const {
+    if (m_files.empty()) {
+        return nullptr;
+    }
+    const auto it = m_files.find(Common::ToLower(name));
+    return it != m_files.end() ? &it->second : nullptr;
+}
+
+} // namespace Common::FS
@@ -0,0 +1,44 @@
+// SPDX-FileCopyrightText: Copyright 2025-2026 shadLauncher4 Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace Common::FS {
+
+/**
+ * Snapshot of the regular files contained in a single directory.
+ *
+ * The directory is listed once on construction, every existence check afterwards is answered
+ * from memory. Lookups are ASCII case-insensitive and hand back the on-disk spelling, so
+ * "icon0.png" finds "ICON0.PNG" on case-sensitive filesystems as well.
+ */
+class DirectoryListing {
+public:
+    DirectoryListing() = default;
+    explicit DirectoryListing(const std::filesystem::path& dir);
+
+    /// Returns true if a regular file with the given name exists in the directory.
+    [[nodiscard]] bool Contains(std::string_view name) const;
+
+    /// Returns the on-disk spelling of the given file name, or nullptr if it does not exist.
+    [[nodiscard]] const std::string* Find(std::string_view name) const;
+
+    [[nodiscard]] bool IsEmpty() const {
+        return m_files.empty();
+    }
+
+    [[nodiscard]] std::size_t Size() const {
+        return m_files.size();
+    }
+
+private:
+    // Case-folded name -> on-disk name
+    std::unordered_map<std::string, std::string> m_files;
+};
+
+} // namespace Common::FS
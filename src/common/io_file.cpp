@@ -3,7 +3,10 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include <filesystem>
+#include <functional>
+#include <thread>
 #include <vector>
+#include <fmt/core.h>
 
 #include "common/alignment.h"
 // #include "common/assert.h"
@@ -428,4 +431,37 @@ u64 GetDirectorySize(const std::filesystem::path& path) {
     return total;
 }
 
+bool WriteFileAtomically(const std::filesystem::path& path,
+                         const std::function<bool(IOFile&)>& write) {
+    // Named per thread, two writers of the same file must not share their temporary file
+    fs::path temp_path = path;
+    temp_path += fmt::format(".{}.tmp", std::hash<std::thread::id>{}(std::this_thread::get_id()));
+
+    std::error_code ec;
+    {
+        IOFile file(temp_path, FileAccessMode::Write);
+        if (!file.IsOpen()) {
+            return false;
+        }
+        if (!write(file) || !file.Commit()) {
+            file.Close();
+            fs::remove(temp_path, ec);
+            return false;
+        }
+    }
+
+    fs::rename(temp_path, path, ec);
+    if (ec) {
+        fs::remove(temp_path, ec);
+        return false;
+    }
+    return true;
+}
+
+bool WriteFileAtomically(const std::filesystem::path& path, std::span<const u8> data) {
+    return WriteFileAtomically(path, [data](IOFile& file) {
+        return file.WriteRaw<u8>(data.data(), data.size()) == data.size();
+    });
+}
+
 } // namespace Common::FS
@@ -6,6 +6,7 @@
 
 #include <cstdio>
 #include <filesystem>
+#include <functional>
 #include <span>
 #include <type_traits>
 
@@ -232,4 +233,13 @@ private:
 
 u64 GetDirectorySize(const std::filesystem::path& path);
 
+/**
+ * Replaces the file at path with what write puts into a temporary file next to it. The temporary
+ * file is committed to disk before it is moved into place, so neither readers nor a crash ever see
+ * a partial file. Returns false and leaves path untouched if opening, writing or moving fails.
+ */
+bool WriteFileAtomically(const std::filesystem::path& path,
+                         const std::function<bool(IOFile&)>& write);
+bool WriteFileAtomically(const std::filesystem::path& path, std::span<const u8> data);
+
 } // namespace Common::FS
@@ -1,6 +1,7 @@
 ﻿// SPDX-FileCopyrightText: Copyright 2025-2026 shadLauncher4 Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
 #include <fstream>
 #include <iomanip>
 #include <iostream>
@@ -11,6 +12,7 @@
 
 std::shared_ptr<KeyManager> KeyManager::s_instance = nullptr;
 std::mutex KeyManager::s_mutex;
+std::atomic<u64> KeyManager::s_generation{0};
 
 // ------------------- Constructor & Singleton -------------------
 KeyManager::KeyManager() {
@@ -68,6 +70,8 @@ bool KeyManager::LoadFromFile() {
         if (j.contains("PkgDerivedKey3Keyset"))
             j.at("PkgDerivedKey3Keyset").get_to(m_keys.PkgDerivedKey3Keyset);
 
+        BuildKeyTable();
+
         LOG_DEBUG(KeyManager, "Successfully loaded keys from: {}", keysPath.string());
         return true;
 
@@ -117,11 +121,69 @@ void KeyManager::JsonToKeys(const json& j) {
     json current = m_keys;           // serialize current defaults
     current.update(j);               // merge only fields present in file
     m_keys = current.get<AllKeys>(); // deserialize back
+    BuildKeyTable();
 }
 
 // ------------------- Defaults / Checks -------------------
 void KeyManager::SetDefaultKeys() {
     m_keys = AllKeys{};
+    BuildKeyTable();
+}
+
+// ------------------- Decoded key table -------------------
+namespace {
+
+template <std::size_t N>
+bool CopyKey(const std::vector<u8>& src, std::array<u8, N>& dst) {
+    if (src.size() != N) {
+        return false;
+    }
+    std::copy(src.begin(), src.end(), dst.begin());
+    return true;
+}
+
+template <typename TKeyset>
+std::optional<KeyManager::RsaKey2048> DecodeRsaKey(const TKeyset& keyset, const char* name) {
+    if (keyset.Modulus.empty()) {
+        return std::nullopt;
+    }
+
+    KeyManager::RsaKey2048 key{};
+    const bool valid = CopyKey(keyset.Modulus, key.Modulus) &&
+                       CopyKey(keyset.PrivateExponent, key.PrivateExponent) &&
+                       CopyKey(keyset.Prime1, key.Prime1) && CopyKey(keyset.Prime2, key.Prime2) &&
+                       CopyKey(keyset.Exponent1, key.Exponent1) &&
+                       CopyKey(keyset.Exponent2, key.Exponent2) &&
+                       CopyKey(keyset.Coefficient, key.Coefficient) &&
+                       !keyset.PublicExponent.empty() &&
+                       keyset.PublicExponent.size() <= key.PublicExponent.size();
+    if (!valid) {
+        LOG_WARNING(KeyManager, "{} does not have the sizes of an RSA-2048 key, ignoring it", name);
+        return std::nullopt;
+    }
+    std::copy(keyset.PublicExponent.begin(), keyset.PublicExponent.end(),
+              key.PublicExponent.begin());
+    key.PublicExponentSize = static_cast<u8>(keyset.PublicExponent.size());
+    return key;
+}
+
+} // Anonymous namespace
+
+void KeyManager::BuildKeyTable() {
+    KeyTable table{};
+
+    const auto& trophy_key = m_keys.TrophyKeySet.ReleaseTrophyKey;
+    if (std::array<u8, 16> key; CopyKey(trophy_key, key)) {
+        table.ReleaseTrophyKey = key;
+    } else if (!trophy_key.empty()) {
+        LOG_WARNING(KeyManager, "ReleaseTrophyKey must be 16 bytes, ignoring it");
+    }
+    table.FakeKeyset = DecodeRsaKey(m_keys.FakeKeyset, "FakeKeyset");
+    table.DebugRifKeyset = DecodeRsaKey(m_keys.DebugRifKeyset, "DebugRifKeyset");
+    table.PkgDerivedKey3Keyset = DecodeRsaKey(m_keys.PkgDerivedKey3Keyset, "PkgDerivedKey3Keyset");
+
+    m_table = table;
+    ++s_generation;
 }
 
 bool KeyManager::HasKeys() const {
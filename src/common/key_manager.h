@@ -3,10 +3,13 @@
 
 #pragma once
 
+#include <array>
+#include <atomic>
 #include <cstdint>
 #include <filesystem>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <string>
 #include <vector>
 #include "common/types.h"
@@ -43,6 +46,25 @@ public:
         KeyManager::PkgDerivedKey3Keyset PkgDerivedKey3Keyset;
     };
 
+    // ------------------- Decoded keys -------------------
+    /// RSA-2048 private key with its CRT parameters, in the sizes the PKG format uses
+    struct RsaKey2048 {
+        std::array<u8, 256> Modulus;
+        std::array<u8, 256> PrivateExponent;
+        std::array<u8, 128> Prime1, Prime2, Exponent1, Exponent2, Coefficient;
+        std::array<u8, 8> PublicExponent; // Big endian, only the first PublicExponentSize bytes
+        u8 PublicExponentSize;
+    };
+
+    /// Keys validated and decoded once whenever the key set changes. A key that is missing or has
+    /// the wrong size is empty here, so hot paths neither parse nor check anything.
+    struct KeyTable {
+        std::optional<std::array<u8, 16>> ReleaseTrophyKey;
+        std::optional<RsaKey2048> FakeKeyset;
+        std::optional<RsaKey2048> DebugRifKeyset;
+        std::optional<RsaKey2048> PkgDerivedKey3Keyset;
+    };
+
     // ------------------- Construction -------------------
     KeyManager();
     ~KeyManager();
@@ -65,23 +87,22 @@ public:
     }
     void SetAllKeys(const AllKeys& keys) {
         m_keys = keys;
+        BuildKeyTable();
+    }
+    const KeyTable& GetKeyTable() const {
+        return m_table;
     }
     bool IsFakeKeysetValid() const {
-        const auto& FakeKeyset = GetAllKeys().FakeKeyset;
-        if (FakeKeyset.Prime1.empty() || FakeKeyset.Prime2.empty() || FakeKeyset.Modulus.empty() ||
-            FakeKeyset.PrivateExponent.empty() || FakeKeyset.PublicExponent.empty()) {
-            return false;
-        }
-        return true;
+        return m_table.FakeKeyset.has_value();
     }
     bool isPkgDerivedKey3KeysetValid() const {
-        const auto& PkgDerivedKey3Keyset = GetAllKeys().PkgDerivedKey3Keyset;
-        if (PkgDerivedKey3Keyset.Prime1.empty() || PkgDerivedKey3Keyset.Prime2.empty() ||
-            PkgDerivedKey3Keyset.Modulus.empty() || PkgDerivedKey3Keyset.PrivateExponent.empty() ||
-            PkgDerivedKey3Keyset.PublicExponent.empty()) {
-            return false;
-        }
-        return true;
+        return m_table.PkgDerivedKey3Keyset.has_value();
+    }
+
+    /// Changes whenever the keys of any KeyManager change, for caches of material derived from
+    /// them such as imported RSA keys
+    static u64 GetGeneration() {
+        return s_generation.load();
     }
 
     static std::vector<u8> HexStringToBytes(const std::string& hexStr);
@@ -90,11 +111,14 @@ public:
 private:
     void KeysToJson(json& j) const;
     void JsonToKeys(const json& j);
+    void BuildKeyTable();
 
     AllKeys m_keys{};
+    KeyTable m_table{};
 
     static std::shared_ptr<KeyManager> s_instance;
     static std::mutex s_mutex;
+    static std::atomic<u64> s_generation;
 };
 
 // ------------------- NLOHMANN macros -------------------
@@ -0,0 +1,59 @@
+// SPDX-FileCopyrightText: Copyright 2025-2026 shadLauncher4 Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <filesystem>
+#include <span>
+#include "common/types.h"
+
+namespace Common::FS {
+
+/**
+ * Read-only memory mapping of a whole file.
+ *
+ * Parsers can hand out std::string_view/std::span straight into the mapping instead of reading
+ * the file into a buffer and copying every field out of it. Views are only valid for as long as
+ * the MappedFile they point into stays open.
+ */
+class MappedFile {
+public:
+    MappedFile() = default;
+    explicit MappedFile(const std::filesystem::path& path);
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+
+    /// Maps the file at path, unmapping any previous file. Empty files fail to map.
+    bool Open(const std::filesystem::path& path);
+    void Close();
+
+    [[nodiscard]] bool IsOpen() const {
+        return data != nullptr;
+    }
+
+    [[nodiscard]] const u8* Data() const {
+        return data;
+    }
+
+    [[nodiscard]] u64 Size() const {
+        return size;
+    }
+
+    [[nodiscard]] std::span<const u8> Span() const {
+        return {data, static_cast<std::size_t>(size)};
+    }
+
+private:
+    const u8* data = nullptr;
+    u64 size = 0;
+#ifdef _WIN32
+    void* mapping_handle = nullptr;
+#endif
+};
+
+} // namespace Common::FS
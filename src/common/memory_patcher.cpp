@@ -5,9 +5,20 @@
 //   2026-01-05  Fixed float parsing (kalaposfos)
 
 #include <algorithm>
+#include <atomic>
 #include <codecvt>
+#include <cstring>
+#include <filesystem>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <set>
+#include <span>
 #include <sstream>
 #include <string>
+#include <string_view>
+#include <system_error>
 #include <QDir>
 #include <QFile>
 #include <QJsonArray>
@@ -16,7 +27,9 @@
 #include <QMessageBox>
 #include <QString>
 #include <QXmlStreamReader>
+#include "common/io_file.h"
 #include "common/logging/log.h"
+#include "common/mapped_file.h"
 #include "common/path_util.h"
 #include "core/file_format/psf.h"
 #include "memory_patcher.h"
@@ -111,146 +124,634 @@ std::string convertValueToHex(const std::string type, const std::string valueStr
     return result;
 }
 
-std::vector<PendingPatch> readPatches(std::string gameSerial, std::string appVersion) {
-    std::vector<PendingPatch> pending;
+namespace {
+
+namespace fs = std::filesystem;
+
+constexpr u32 index_magic = 0x49504C53; // "SLPI"
+constexpr u32 index_version = 1;
+constexpr u32 any_version = 0xFFFFFFFF; // Entry for app versions no patch names
+constexpr s64 missing_time = std::numeric_limits<s64>::min();
+constexpr const char* index_file_name = "patch_index.bin";
+
+// Layout: header, repository stamps, source stamps, source references, entries sorted by serial,
+// records, string offsets (string_count + 1), string data. Strings are interned UTF-8.
+struct IndexHeader {
+    u32 magic;
+    u32 version;
+    u32 repo_count;
+    u32 source_count;
+    u32 ref_count;
+    u32 entry_count;
+    u32 record_count;
+    u32 string_count;
+};
+static_assert(sizeof(IndexHeader) == 32);
+
+// files.json of a repository, or a patch file relative to the patches directory
+struct FileStamp {
+    u32 path;
+    u32 reserved;
+    u64 size;
+    s64 mtime;
+};
+static_assert(sizeof(FileStamp) == 24);
+
+struct IndexEntry {
+    u32 serial;
+    u32 version; // any_version or a string
+    u32 first_record;
+    u32 record_count;
+    u32 first_ref; // Source files the records came from
+    u32 ref_count;
+};
+static_assert(sizeof(IndexEntry) == 24);
+
+struct IndexRecord {
+    u32 mod_name;
+    u32 address;
+    u32 value;
+    u32 target;
+    u32 size;
+    u8 little_endian;
+    u8 mask;
+    u16 reserved;
+    s32 mask_offset;
+};
+static_assert(sizeof(IndexRecord) == 28);
+
+struct Stamp {
+    u64 size = 0;
+    s64 mtime = missing_time;
+
+    bool operator==(const Stamp&) const = default;
+};
+
+Stamp ReadStamp(const fs::path& path) {
+    std::error_code ec;
+    const u64 size = fs::file_size(path, ec);
+    if (ec) {
+        return {};
+    }
+    const auto time = fs::last_write_time(path, ec);
+    if (ec) {
+        return {};
+    }
+    return {size, static_cast<s64>(time.time_since_epoch().count())};
+}
 
-    QString patchDir;
-    Common::FS::PathToQString(patchDir, Common::FS::GetUserPath(Common::FS::PathType::PatchesDir));
-    QDir dir(patchDir);
-    QStringList folders = dir.entryList(QDir::Dirs | QDir::NoDotAndDotDot);
+fs::path PatchPath(const fs::path& patch_dir, std::string_view relative_path) {
+    return patch_dir / Common::FS::PathFromQString(QString::fromUtf8(
+                           relative_path.data(), static_cast<qsizetype>(relative_path.size())));
+}
 
-    for (const QString& folder : folders) {
-        QString filesJsonPath = patchDir + "/" + folder + "/files.json";
+// Repositories in the order patches from them are applied
+QStringList ListRepositories(const fs::path& patch_dir) {
+    QString dir;
+    Common::FS::PathToQString(dir, patch_dir);
+    return QDir(dir).entryList(QDir::Dirs | QDir::NoDotAndDotDot);
+}
 
-        QFile jsonFile(filesJsonPath);
-        if (!jsonFile.open(QIODevice::ReadOnly)) {
-            LOG_ERROR(Loader, "Unable to open files.json for reading in repository {}",
-                      folder.toStdString());
-            continue;
+/** Read only view of an index. Open checks every offset once, so lookups need no checks. */
+class IndexView {
+public:
+    bool Open(std::span<const u8> data) {
+        m_data = data;
+        if (data.size() < sizeof(IndexHeader)) {
+            return false;
+        }
+        std::memcpy(&m_header, data.data(), sizeof(m_header));
+        if (m_header.magic != index_magic || m_header.version != index_version) {
+            return false;
         }
-        const QByteArray jsonData = jsonFile.readAll();
-        jsonFile.close();
 
-        const QJsonDocument jsonDoc = QJsonDocument::fromJson(jsonData);
-        const QJsonObject jsonObject = jsonDoc.object();
+        m_repos = sizeof(IndexHeader);
+        m_sources = m_repos + u64{m_header.repo_count} * sizeof(FileStamp);
+        m_refs = m_sources + u64{m_header.source_count} * sizeof(FileStamp);
+        m_entries = m_refs + u64{m_header.ref_count} * sizeof(u32);
+        m_records = m_entries + u64{m_header.entry_count} * sizeof(IndexEntry);
+        m_offsets = m_records + u64{m_header.record_count} * sizeof(IndexRecord);
+        m_strings = m_offsets + (u64{m_header.string_count} + 1) * sizeof(u32);
+        if (data.size() < m_strings) {
+            return false;
+        }
 
-        QString selectedFileName;
-        const QString serial = QString::fromStdString(gameSerial);
+        u32 previous = 0;
+        for (u32 i = 0; i <= m_header.string_count; ++i) {
+            const u32 offset = Read<u32>(m_offsets, i);
+            if (offset < previous) {
+                return false;
+            }
+            previous = offset;
+        }
+        if (data.size() - m_strings < previous) {
+            return false;
+        }
 
-        for (auto it = jsonObject.constBegin(); it != jsonObject.constEnd(); ++it) {
-            const QString filePath = it.key();
-            const QJsonArray idsArray = it.value().toArray();
-            if (idsArray.contains(QJsonValue(serial))) {
-                selectedFileName = filePath;
-                break;
+        const auto valid_string = [&](u32 index) { return index < m_header.string_count; };
+        for (u32 i = 0; i < m_header.repo_count + m_header.source_count; ++i) {
+            if (!valid_string(Read<FileStamp>(m_repos, i).path)) {
+                return false;
+            }
+        }
+        for (u32 i = 0; i < m_header.ref_count; ++i) {
+            if (Read<u32>(m_refs, i) >= m_header.source_count) {
+                return false;
             }
         }
+        for (u32 i = 0; i < m_header.entry_count; ++i) {
+            const IndexEntry entry = Read<IndexEntry>(m_entries, i);
+            if (!valid_string(entry.serial) ||
+                (entry.version != any_version && !valid_string(entry.version)) ||
+                u64{entry.first_record} + entry.record_count > m_header.record_count ||
+                u64{entry.first_ref} + entry.ref_count > m_header.ref_count) {
+                return false;
+            }
+            if (i > 0 && String(Read<IndexEntry>(m_entries, i - 1).serial) > String(entry.serial)) {
+                return false;
+            }
+        }
+        for (u32 i = 0; i < m_header.record_count; ++i) {
+            const IndexRecord record = Read<IndexRecord>(m_records, i);
+            if (!valid_string(record.mod_name) || !valid_string(record.address) ||
+                !valid_string(record.value) || !valid_string(record.target) ||
+                !valid_string(record.size)) {
+                return false;
+            }
+        }
+        return true;
+    }
 
-        if (selectedFileName.isEmpty()) {
-            LOG_ERROR(Loader, "No patch file found for the current serial in repository {}",
-                      folder.toStdString());
-            continue;
+    /** Whether the repositories are the ones the index was compiled from */
+    bool ReposCurrent(const fs::path& patch_dir) const {
+        const QStringList repos = ListRepositories(patch_dir);
+        if (static_cast<u32>(repos.size()) != m_header.repo_count) {
+            return false;
+        }
+        for (u32 i = 0; i < m_header.repo_count; ++i) {
+            const FileStamp stamp = Read<FileStamp>(m_repos, i);
+            const std::string name = repos[i].toStdString();
+            if (String(stamp.path) != name ||
+                !StampMatches(stamp, PatchPath(patch_dir, name + "/files.json"))) {
+                return false;
+            }
         }
+        return true;
+    }
 
-        const QString filePath = patchDir + "/" + folder + "/" + selectedFileName;
-        QFile file(filePath);
-        if (!file.open(QIODevice::ReadOnly | QIODevice::Text)) {
-            LOG_ERROR(Loader, "Unable to open the file for reading.");
-            continue;
+    /** Whether every patch file is the one the index was compiled from */
+    bool SourcesCurrent(const fs::path& patch_dir) const {
+        for (u32 i = 0; i < m_header.source_count; ++i) {
+            if (!SourceCurrent(patch_dir, i)) {
+                return false;
+            }
         }
-        const QByteArray xmlData = file.readAll();
-        file.close();
+        return true;
+    }
 
-        QXmlStreamReader xmlReader(xmlData);
+    /** Whether every patch file the patches of this game come from is the one compiled */
+    bool PatchesCurrent(const fs::path& patch_dir, std::string_view serial,
+                        std::string_view app_version) const {
+        const std::optional<IndexEntry> match = Match(serial, app_version);
+        return !match || RefsCurrent(patch_dir, *match);
+    }
 
-        bool isEnabled = false;
-        std::string currentPatchName;
+    /** Returns nothing if a file the patches of this game come from changed */
+    std::optional<std::vector<PendingPatch>> Find(const fs::path& patch_dir,
+                                                  std::string_view serial,
+                                                  std::string_view app_version) const {
+        const std::optional<IndexEntry> match = Match(serial, app_version);
+        if (!match) {
+            return std::vector<PendingPatch>{};
+        }
+        if (!RefsCurrent(patch_dir, *match)) {
+            return std::nullopt;
+        }
 
-        bool versionMatches = true;
+        std::vector<PendingPatch> patches;
+        patches.reserve(match->record_count);
+        for (u32 i = 0; i < match->record_count; ++i) {
+            const IndexRecord record = Read<IndexRecord>(m_records, match->first_record + i);
+            patches.push_back(PendingPatch{
+                .modName = std::string(String(record.mod_name)),
+                .address = std::string(String(record.address)),
+                .value = std::string(String(record.value)),
+                .target = std::string(String(record.target)),
+                .size = std::string(String(record.size)),
+                .littleEndian = record.little_endian != 0,
+                .mask = static_cast<PatchMask>(record.mask),
+                .maskOffset = record.mask_offset,
+            });
+        }
+        return patches;
+    }
+
+private:
+    // The entry holding the patches of this game, if it has any
+    std::optional<IndexEntry> Match(std::string_view serial, std::string_view app_version) const {
+        u32 first = 0;
+        u32 count = m_header.entry_count;
+        while (count > 0) {
+            const u32 step = count / 2;
+            if (String(Read<IndexEntry>(m_entries, first + step).serial) < serial) {
+                first += step + 1;
+                count -= step + 1;
+            } else {
+                count = step;
+            }
+        }
 
-        while (!xmlReader.atEnd()) {
-            xmlReader.readNext();
+        // Entries of a serial are sorted by version with the any_version one last
+        for (u32 i = first; i < m_header.entry_count; ++i) {
+            const IndexEntry entry = Read<IndexEntry>(m_entries, i);
+            if (String(entry.serial) != serial) {
+                break;
+            }
+            if (entry.version == any_version || String(entry.version) == app_version) {
+                return entry;
+            }
+        }
+        return std::nullopt;
+    }
 
-            if (!xmlReader.isStartElement()) {
-                continue;
+    bool RefsCurrent(const fs::path& patch_dir, const IndexEntry& entry) const {
+        for (u32 i = 0; i < entry.ref_count; ++i) {
+            if (!SourceCurrent(patch_dir, Read<u32>(m_refs, entry.first_ref + i))) {
+                return false;
             }
+        }
+        return true;
+    }
 
-            if (xmlReader.name() == QStringLiteral("Metadata")) {
-                QString name = xmlReader.attributes().value("Name").toString();
-                currentPatchName = name.toStdString();
+    template <typename T>
+    T Read(u64 section, u32 index) const {
+        T value;
+        std::memcpy(&value, m_data.data() + section + u64{index} * sizeof(T), sizeof(T));
+        return value;
+    }
 
-                const QString appVer = xmlReader.attributes().value("AppVer").toString();
+    std::string_view String(u32 index) const {
+        const u32 begin = Read<u32>(m_offsets, index);
+        const u32 end = Read<u32>(m_offsets, index + 1);
+        return {reinterpret_cast<const char*>(m_data.data()) + m_strings + begin, end - begin};
+    }
 
-                isEnabled = false;
-                for (const QXmlStreamAttribute& attr : xmlReader.attributes()) {
-                    if (attr.name() == QStringLiteral("isEnabled")) {
-                        isEnabled = (attr.value().toString() == "true");
-                    }
+    bool StampMatches(const FileStamp& stamp, const fs::path& path) const {
+        return ReadStamp(path) == Stamp{stamp.size, stamp.mtime};
+    }
+
+    bool SourceCurrent(const fs::path& patch_dir, u32 source) const {
+        const FileStamp stamp = Read<FileStamp>(m_sources, source);
+        return StampMatches(stamp, PatchPath(patch_dir, String(stamp.path)));
+    }
+
+    std::span<const u8> m_data;
+    IndexHeader m_header{};
+    u64 m_repos = 0;
+    u64 m_sources = 0;
+    u64 m_refs = 0;
+    u64 m_entries = 0;
+    u64 m_records = 0;
+    u64 m_offsets = 0;
+    u64 m_strings = 0;
+};
+
+struct CompiledLine {
+    std::string app_ver;
+    bool is_mask = false;
+    PendingPatch patch;
+};
+
+// Enabled lines of a patch file, for every app version
+std::vector<CompiledLine> CompilePatchFile(const QString& path) {
+    std::vector<CompiledLine> lines;
+
+    QFile file(path);
+    if (!file.open(QIODevice::ReadOnly | QIODevice::Text)) {
+        LOG_ERROR(Loader, "Unable to open the file for reading.");
+        return lines;
+    }
+    QXmlStreamReader xmlReader(file.readAll());
+
+    bool isEnabled = false;
+    std::string currentPatchName;
+    std::string currentAppVer;
+
+    while (!xmlReader.atEnd()) {
+        xmlReader.readNext();
+
+        if (!xmlReader.isStartElement()) {
+            continue;
+        }
+
+        if (xmlReader.name() == QStringLiteral("Metadata")) {
+            currentPatchName = xmlReader.attributes().value("Name").toString().toStdString();
+            currentAppVer = xmlReader.attributes().value("AppVer").toString().toStdString();
+
+            isEnabled = false;
+            for (const QXmlStreamAttribute& attr : xmlReader.attributes()) {
+                if (attr.name() == QStringLiteral("isEnabled")) {
+                    isEnabled = (attr.value().toString() == "true");
                 }
-                versionMatches = (appVer.toStdString() == appVersion);
-            } else if (xmlReader.name() == QStringLiteral("PatchList")) {
-                while (!xmlReader.atEnd() &&
-                       !(xmlReader.tokenType() == QXmlStreamReader::EndElement &&
-                         xmlReader.name() == QStringLiteral("PatchList"))) {
+            }
+        } else if (xmlReader.name() == QStringLiteral("PatchList")) {
+            while (!xmlReader.atEnd() &&
+                   !(xmlReader.tokenType() == QXmlStreamReader::EndElement &&
+                     xmlReader.name() == QStringLiteral("PatchList"))) {
 
-                    xmlReader.readNext();
+                xmlReader.readNext();
 
-                    if (xmlReader.tokenType() != QXmlStreamReader::StartElement ||
-                        xmlReader.name() != QStringLiteral("Line")) {
-                        continue;
-                    }
+                if (!isEnabled || xmlReader.tokenType() != QXmlStreamReader::StartElement ||
+                    xmlReader.name() != QStringLiteral("Line")) {
+                    continue;
+                }
 
-                    const QXmlStreamAttributes a = xmlReader.attributes();
-                    const QString type = a.value("Type").toString();
-                    const QString addr = a.value("Address").toString();
-                    QString val = a.value("Value").toString();
-                    const QString offStr = a.value("Offset").toString();
-                    const QString tgt =
-                        (type == "mask_jump32") ? a.value("Target").toString() : QString{};
-                    const QString sz =
-                        (type == "mask_jump32") ? a.value("Size").toString() : QString{};
-
-                    if (!isEnabled) {
-                        continue;
-                    }
-                    if ((type != "mask" && type != "mask_jump32") && !versionMatches) {
-                        continue;
-                    }
+                const QXmlStreamAttributes a = xmlReader.attributes();
+                const std::string type = a.value("Type").toString().toStdString();
 
-                    PendingPatch pp;
-                    pp.modName = currentPatchName;
-                    pp.address = addr.toStdString();
+                CompiledLine line{.app_ver = currentAppVer,
+                                  .is_mask = type == "mask" || type == "mask_jump32"};
+                PendingPatch& pp = line.patch;
+                pp.modName = currentPatchName;
+                pp.address = a.value("Address").toString().toStdString();
 
-                    if (type == "mask" || type == "mask_jump32") {
-                        if (!offStr.toStdString().empty()) {
-                            pp.maskOffset = std::stoi(offStr.toStdString(), nullptr, 10);
-                        }
+                try {
+                    if (line.is_mask) {
+                        pp.maskOffset = a.value("Offset").toInt();
                         pp.mask = (type == "mask") ? MemoryPatcher::PatchMask::Mask
                                                    : MemoryPatcher::PatchMask::Mask_Jump32;
-                        pp.value = val.toStdString();
-                        pp.target = tgt.toStdString();
-                        pp.size = sz.toStdString();
+                        pp.value = a.value("Value").toString().toStdString();
+                        if (type == "mask_jump32") {
+                            pp.target = a.value("Target").toString().toStdString();
+                            pp.size = a.value("Size").toString().toStdString();
+                        }
                     } else {
-                        pp.value = convertValueToHex(type.toStdString(), val.toStdString());
-                        pp.target.clear();
-                        pp.size.clear();
-                        pp.mask = MemoryPatcher::PatchMask::None;
-                        pp.maskOffset = 0;
+                        pp.value =
+                            convertValueToHex(type, a.value("Value").toString().toStdString());
                     }
+                } catch (const std::exception& e) {
+                    LOG_ERROR(Loader, "Skipping patch line of {}: {}", currentPatchName,
+                              e.what());
+                    continue;
+                }
+
+                pp.littleEndian = (type == "bytes16" || type == "bytes32" || type == "bytes64");
+                lines.emplace_back(std::move(line));
+            }
+        }
+    }
+
+    if (xmlReader.hasError()) {
+        LOG_ERROR(Loader, "Failed to parse XML {}", path.toStdString());
+    }
+    return lines;
+}
+
+class IndexBuilder {
+public:
+    u32 Intern(std::string_view value) {
+        if (const auto it = m_indices.find(value); it != m_indices.end()) {
+            return it->second;
+        }
+        const u32 index = static_cast<u32>(m_offsets.size());
+        m_offsets.push_back(static_cast<u32>(m_data.size()));
+        m_data.append(value);
+        m_indices.emplace(std::string(value), index);
+        return index;
+    }
+
+    std::vector<u8> Finish() {
+        m_offsets.push_back(static_cast<u32>(m_data.size()));
+        const IndexHeader header{
+            .magic = index_magic,
+            .version = index_version,
+            .repo_count = static_cast<u32>(repos.size()),
+            .source_count = static_cast<u32>(sources.size()),
+            .ref_count = static_cast<u32>(refs.size()),
+            .entry_count = static_cast<u32>(entries.size()),
+            .record_count = static_cast<u32>(records.size()),
+            .string_count = static_cast<u32>(m_offsets.size() - 1),
+        };
+
+        std::vector<u8> index;
+        const auto append = [&index](const void* data, size_t size) {
+            const u8* bytes = static_cast<const u8*>(data);
+            index.insert(index.end(), bytes, bytes + size);
+        };
+        append(&header, sizeof(header));
+        append(repos.data(), repos.size() * sizeof(FileStamp));
+        append(sources.data(), sources.size() * sizeof(FileStamp));
+        append(refs.data(), refs.size() * sizeof(u32));
+        append(entries.data(), entries.size() * sizeof(IndexEntry));
+        append(records.data(), records.size() * sizeof(IndexRecord));
+        append(m_offsets.data(), m_offsets.size() * sizeof(u32));
+        append(m_data.data(), m_data.size());
+        return index;
+    }
+
+    std::vector<FileStamp> repos;
+    std::vector<FileStamp> sources;
+    std::vector<u32> refs;
+    std::vector<IndexEntry> entries;
+    std::vector<IndexRecord> records;
+
+private:
+    std::vector<u32> m_offsets;
+    std::string m_data;
+    std::map<std::string, u32, std::less<>> m_indices;
+};
+
+std::vector<u8> CompileIndex(const fs::path& patch_dir) {
+    IndexBuilder builder;
+    std::vector<std::vector<CompiledLine>> source_lines;
+    std::map<std::string, u32> source_indices; // Relative path to source
+    std::map<std::string, std::vector<u32>> serial_sources;
+
+    for (const QString& folder : ListRepositories(patch_dir)) {
+        const std::string repo = folder.toStdString();
+        const fs::path files_json = PatchPath(patch_dir, repo + "/files.json");
+        const Stamp repo_stamp = ReadStamp(files_json);
+        builder.repos.push_back({builder.Intern(repo), 0, repo_stamp.size, repo_stamp.mtime});
+
+        QFile jsonFile(QString::fromStdString(Common::FS::PathToUTF8String(files_json)));
+        if (!jsonFile.open(QIODevice::ReadOnly)) {
+            LOG_ERROR(Loader, "Unable to open files.json for reading in repository {}", repo);
+            continue;
+        }
+        const QJsonObject jsonObject = QJsonDocument::fromJson(jsonFile.readAll()).object();
 
-                    pp.littleEndian = (type == "bytes16" || type == "bytes32" || type == "bytes64");
-                    pending.emplace_back(std::move(pp));
+        // A serial uses the first file of a repository that lists it
+        std::map<std::string, u32> repo_serials;
+        for (auto it = jsonObject.constBegin(); it != jsonObject.constEnd(); ++it) {
+            const std::string relative_path = repo + "/" + it.key().toStdString();
+            for (const QJsonValue& id : it.value().toArray()) {
+                const std::string serial = id.toString().toStdString();
+                if (serial.empty() || repo_serials.contains(serial)) {
+                    continue;
+                }
+                const u32 next_source = static_cast<u32>(source_lines.size());
+                auto [source, inserted] = source_indices.try_emplace(relative_path, next_source);
+                if (inserted) {
+                    const fs::path path = PatchPath(patch_dir, relative_path);
+                    const Stamp stamp = ReadStamp(path);
+                    builder.sources.push_back(
+                        {builder.Intern(relative_path), 0, stamp.size, stamp.mtime});
+                    source_lines.push_back(CompilePatchFile(
+                        QString::fromStdString(Common::FS::PathToUTF8String(path))));
                 }
+                repo_serials.emplace(serial, source->second);
             }
         }
+        for (const auto& [serial, source] : repo_serials) {
+            serial_sources[serial].push_back(source);
+        }
+    }
 
-        if (xmlReader.hasError()) {
-            LOG_ERROR(Loader, "Failed to parse XML for {}", gameSerial);
-        } else {
-            LOG_INFO(Loader, "Patches parsed successfully, repository: {}", folder.toStdString());
+    for (const auto& [serial, sources] : serial_sources) {
+        const u32 first_ref = static_cast<u32>(builder.refs.size());
+        builder.refs.insert(builder.refs.end(), sources.begin(), sources.end());
+
+        std::set<std::string> versions;
+        for (const u32 source : sources) {
+            for (const CompiledLine& line : source_lines[source]) {
+                if (!line.is_mask) {
+                    versions.insert(line.app_ver);
+                }
+            }
         }
+
+        // Masks apply to every version, other lines only to the version of their patch
+        const auto add_entry = [&](const std::string* version) {
+            IndexEntry entry{
+                .serial = builder.Intern(serial),
+                .version = version ? builder.Intern(*version) : any_version,
+                .first_record = static_cast<u32>(builder.records.size()),
+                .record_count = 0,
+                .first_ref = first_ref,
+                .ref_count = static_cast<u32>(sources.size()),
+            };
+            for (const u32 source : sources) {
+                for (const CompiledLine& line : source_lines[source]) {
+                    if (!line.is_mask && (!version || line.app_ver != *version)) {
+                        continue;
+                    }
+                    const PendingPatch& pp = line.patch;
+                    builder.records.push_back(IndexRecord{
+                        .mod_name = builder.Intern(pp.modName),
+                        .address = builder.Intern(pp.address),
+                        .value = builder.Intern(pp.value),
+                        .target = builder.Intern(pp.target),
+                        .size = builder.Intern(pp.size),
+                        .little_endian = static_cast<u8>(pp.littleEndian ? 1 : 0),
+                        .mask = static_cast<u8>(pp.mask),
+                        .reserved = 0,
+                        .mask_offset = pp.maskOffset,
+                    });
+                    ++entry.record_count;
+                }
+            }
+            builder.entries.push_back(entry);
+        };
+        for (const std::string& version : versions) {
+            add_entry(&version);
+        }
+        add_entry(nullptr);
+    }
+
+    LOG_INFO(Loader, "Compiled patch index: {} titles from {} patch files",
+             serial_sources.size(), source_lines.size());
+    return builder.Finish();
+}
+
+std::mutex index_mutex;
+std::atomic<u64> index_generation{0};
+std::atomic<bool> index_compiling{false};
+
+// Requires index_mutex
+std::vector<u8> RebuildIndex(const fs::path& patch_dir) {
+    index_compiling = true;
+    std::vector<u8> index = CompileIndex(patch_dir);
+    index_compiling = false;
+    Common::FS::WriteFileAtomically(patch_dir / index_file_name, index);
+    ++index_generation;
+    return index;
+}
+
+// The patches of a game from the index on disk, nothing if it is missing or out of date for it
+std::optional<std::vector<PendingPatch>> FindStored(const fs::path& patch_dir,
+                                                    std::string_view serial,
+                                                    std::string_view app_version, u64* generation) {
+    // Read before mapping, a recompile in between can only make the patches look older
+    if (generation) {
+        *generation = index_generation.load();
+    }
+    Common::FS::MappedFile file;
+    IndexView view;
+    if (file.Open(patch_dir / index_file_name) && view.Open(file.Span()) &&
+        view.ReposCurrent(patch_dir)) {
+        return view.Find(patch_dir, serial, app_version);
+    }
+    return std::nullopt;
+}
+
+} // namespace
+
+std::vector<PendingPatch> readPatches(std::string gameSerial, std::string appVersion,
+                                      u64* generation) {
+    const fs::path patch_dir = Common::FS::GetUserPath(Common::FS::PathType::PatchesDir);
+    if (auto patches = FindStored(patch_dir, gameSerial, appVersion, generation)) {
+        return std::move(*patches);
+    }
+
+    // Another caller may have compiled the index while this one waited for the lock
+    std::scoped_lock lock{index_mutex};
+    if (auto patches = FindStored(patch_dir, gameSerial, appVersion, generation)) {
+        return std::move(*patches);
+    }
+    // The index is unmapped by now, so it can be replaced
+    const std::vector<u8> index = RebuildIndex(patch_dir);
+    if (generation) {
+        *generation = index_generation.load();
+    }
+    IndexView view;
+    if (!view.Open(index)) {
+        return {};
+    }
+    return view.Find(patch_dir, gameSerial, appVersion).value_or(std::vector<PendingPatch>{});
+}
+
+void UpdatePatchIndex() {
+    const fs::path patch_dir = Common::FS::GetUserPath(Common::FS::PathType::PatchesDir);
+    std::scoped_lock lock{index_mutex};
+    {
+        Common::FS::MappedFile file;
+        IndexView view;
+        if (file.Open(patch_dir / index_file_name) && view.Open(file.Span()) &&
+            view.ReposCurrent(patch_dir) && view.SourcesCurrent(patch_dir)) {
+            return;
+        }
+    }
+    RebuildIndex(patch_dir);
+}
+
+u64 PatchIndexGeneration() {
+    return index_generation.load();
+}
+
+bool PatchIndexCompiling() {
+    return index_compiling.load();
+}
+
+bool PatchesCurrent(const std::string& gameSerial, const std::string& appVersion,
+                    u64 generation) {
+    if (generation != index_generation.load()) {
+        return false;
     }
-    return pending;
+    const fs::path patch_dir = Common::FS::GetUserPath(Common::FS::PathType::PatchesDir);
+    Common::FS::MappedFile file;
+    IndexView view;
+    return file.Open(patch_dir / index_file_name) && view.Open(file.Span()) &&
+           view.ReposCurrent(patch_dir) && view.PatchesCurrent(patch_dir, gameSerial, appVersion);
 }
 
 } // namespace MemoryPatcher
@@ -28,6 +28,25 @@ struct PendingPatch {
 
 std::string convertValueToHex(std::string type, std::string valueStr);
 
-std::vector<PendingPatch> readPatches(std::string gameSerial, std::string appVersion);
+/// Returns the patches to send for a game. They are looked up in an index compiled from the patch
+/// repositories, which is compiled again first if a repository or patch file changed. If given,
+/// generation receives the PatchIndexGeneration() the patches were read at.
+std::vector<PendingPatch> readPatches(std::string gameSerial, std::string appVersion,
+                                      u64* generation = nullptr);
+
+/// Compiles the patch index if any repository or patch file changed since it was compiled, so the
+/// next game launch does not have to. Thread-safe.
+void UpdatePatchIndex();
+
+/// Changes whenever the patch index is compiled again, so patches returned by readPatches before
+/// can be told apart from current ones.
+u64 PatchIndexGeneration();
+
+/// Whether the patch index is being compiled right now, readPatches would wait for it
+bool PatchIndexCompiling();
+
+/// Whether readPatches would still return what it returned at generation for this game. Only
+/// stats the repositories and the patch files of the game, cheap enough to call before a launch.
+bool PatchesCurrent(const std::string& gameSerial, const std::string& appVersion, u64 generation);
 
 } // namespace MemoryPatcher
\ No newline at end of file
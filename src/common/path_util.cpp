@@ -9,9 +9,7 @@ namespace Common::FS {
 
 namespace fs = std::filesystem;
 
-static auto UserPaths = [] {
-    auto user_dir = std::filesystem::current_path() / "user";
-
+static std::unordered_map<PathType, fs::path> BuildUserPaths(const fs::path& user_dir) {
     std::unordered_map<PathType, fs::path> paths;
 
     const auto create_path = [&](PathType shad_path, const fs::path& new_path) {
@@ -32,14 +30,24 @@ static auto UserPaths = [] {
     create_path(PathType::CheatsDir, user_dir / CHEATS_DIR);
     create_path(PathType::CacheDir, user_dir / CACHE_DIR);
     create_path(PathType::FontsDir, user_dir / FONTS_DIR);
+    create_path(PathType::IconCacheDir, user_dir / CACHE_DIR / ICON_CACHE_DIR);
 
     return paths;
-}();
+}
+
+static auto UserPaths = BuildUserPaths(std::filesystem::current_path() / "user");
 
 const fs::path& GetUserPath(PathType shad_path) {
     return UserPaths.at(shad_path);
 }
 
+void SetUserDir(const fs::path& user_dir) {
+    // Assigned in place, so references returned by GetUserPath before see the new paths
+    for (auto& [type, path] : BuildUserPaths(user_dir)) {
+        UserPaths.insert_or_assign(type, std::move(path));
+    }
+}
+
 std::filesystem::path PathFromQString(const QString& path) {
 #ifdef _WIN32
     return std::filesystem::path(path.toStdWString());
@@ -25,6 +25,7 @@ enum class PathType {
     CustomTrophy,       // Where custom files for trophies are stored.
     CacheDir,           // Where pipeline and shader cache is stored.
     FontsDir,           // Where dumped system fonts are stored.
+    IconCacheDir,       // Where composed game list icons are cached.
 };
 
 // Sub-directories contained within a user data directory
@@ -40,6 +41,7 @@ constexpr auto PATCHES_DIR = "patches";
 constexpr auto CHEATS_DIR = "cheats";
 constexpr auto CACHE_DIR = "cache";
 constexpr auto FONTS_DIR = "fonts";
+constexpr auto ICON_CACHE_DIR = "icon_cache";
 
 // Filenames
 constexpr auto LOG_FILE = "shadLauncher4.txt";
@@ -53,6 +55,14 @@ constexpr auto LOG_FILE = "shadLauncher4.txt";
  */
 [[nodiscard]] const std::filesystem::path& GetUserPath(PathType user_path);
 
+/**
+ * Moves every user path below user_dir, creating the directories. Only meant for developer
+ * tooling that must not touch the real user directory, and only before anything cached a path.
+ *
+ * @param user_dir The new user directory
+ */
+void SetUserDir(const std::filesystem::path& user_dir);
+
 /**
  * Converts a QString to an std::filesystem::path.
  * The native underlying string of a path is wstring on Windows and string on POSIX.
@@ -0,0 +1,32 @@
+// SPDX-FileCopyrightText: Copyright 2025-2026 shadLauncher4 Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <mutex>
+#include "common/string_pool.h"
+
+namespace Common {
+
+const std::string& StringPool::Intern(std::string_view str) {
+    {
+        std::shared_lock lock(m_mutex);
+        if (const auto it = m_strings.find(str); it != m_strings.end()) {
+            return *it;
+        }
+    }
+
+    std::unique_lock lock(m_mutex);
+    // Element addresses in an unordered_set are stable across rehashing
+    return *m_strings.emplace(str).first;
+}
+
+std::size_t StringPool::Size() const {
+    std::shared_lock lock(m_mutex);
+    return m_strings.size();
+}
+
+StringPool& StringPool::Global() {
+    static StringPool pool;
+    return pool;
+}
+
+} // namespace Common
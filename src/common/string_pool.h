@@ -0,0 +1,96 @@
+// SPDX-FileCopyrightText: Copyright 2025-2026 shadLauncher4 Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <functional>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+
+namespace Common {
+
+/**
+ * Thread-safe string interning arena.
+ *
+ * Every distinct string is stored once and never freed, so only use it for values with a small
+ * set of distinct values (regions, firmware/SDK versions, categories...).
+ */
+class StringPool {
+public:
+    /// Returns the pooled copy of str. The reference stays valid for the lifetime of the pool.
+    const std::string& Intern(std::string_view str);
+
+    [[nodiscard]] std::size_t Size() const;
+
+    static StringPool& Global();
+
+private:
+    struct Hash {
+        using is_transparent = void;
+        std::size_t operator()(std::string_view str) const {
+            return std::hash<std::string_view>{}(str);
+        }
+    };
+
+    mutable std::shared_mutex m_mutex;
+    std::unordered_set<std::string, Hash, std::equal_to<>> m_strings;
+};
+
+/**
+ * Handle to a string in the global StringPool. It is pointer sized, copies are free and equal
+ * values share one allocation.
+ */
+class InternedString {
+public:
+    InternedString() = default;
+    InternedString(std::string_view str)
+        : m_str(str.empty() ? &Empty() : &StringPool::Global().Intern(str)) {}
+    InternedString(const char* str) : InternedString(std::string_view{str}) {}
+    InternedString(const std::string& str) : InternedString(std::string_view{str}) {}
+
+    [[nodiscard]] const std::string& str() const {
+        return *m_str;
+    }
+    operator const std::string&() const {
+        return *m_str;
+    }
+
+    [[nodiscard]] const char* c_str() const {
+        return m_str->c_str();
+    }
+    [[nodiscard]] const char* data() const {
+        return m_str->data();
+    }
+    [[nodiscard]] std::size_t size() const {
+        return m_str->size();
+    }
+    [[nodiscard]] bool empty() const {
+        return m_str->empty();
+    }
+
+    friend bool operator==(const InternedString& lhs, const InternedString& rhs) {
+        // Same pool, so equal strings are the same object
+        return lhs.m_str == rhs.m_str;
+    }
+    friend bool operator==(const InternedString& lhs, const std::string& rhs) {
+        return *lhs.m_str == rhs;
+    }
+    friend bool operator==(const InternedString& lhs, std::string_view rhs) {
+        return *lhs.m_str == rhs;
+    }
+    friend bool operator==(const InternedString& lhs, const char* rhs) {
+        return *lhs.m_str == rhs;
+    }
+
+private:
+    static const std::string& Empty() {
+        static const std::string empty;
+        return empty;
+    }
+
+    const std::string* m_str = &Empty();
+};
+
+} // namespace Common
@@ -0,0 +1,182 @@
+// SPDX-FileCopyrightText: Copyright 2025-2026 shadLauncher4 Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <filesystem>
+#include <fstream>
+#include <set>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <vector>
+#include <fmt/core.h>
+#include <nlohmann/json.hpp>
+#include <QCryptographicHash>
+#include "common/io_file.h"
+#include "common/logging/log.h"
+#include "common/path_util.h"
+#include "common/version_store.h"
+#include "common/zip_util.h"
+
+namespace VersionStore {
+
+namespace fs = std::filesystem;
+using json = nlohmann::json;
+
+namespace {
+
+constexpr std::string_view store_dir_name = ".store";
+
+fs::path StoreDir(const fs::path& versions_dir) {
+    return versions_dir / store_dir_name;
+}
+
+fs::path BlobPath(const fs::path& store_dir, const std::string& hash) {
+    return store_dir / "objects" / hash.substr(0, 2) / hash;
+}
+
+fs::path ManifestPath(const fs::path& store_dir, const fs::path& version_dir) {
+    fs::path name = version_dir.filename();
+    name += ".json";
+    return store_dir / "manifests" / name;
+}
+
+// Entries are joined to the version folder, so nothing may point outside of it
+bool IsSafeEntryName(const fs::path& name) {
+    if (name.empty() || name.is_absolute() || name.has_root_name()) {
+        return false;
+    }
+    for (const auto& part : name) {
+        if (part == "..") {
+            return false;
+        }
+    }
+    return true;
+}
+
+void Materialize(const fs::path& blob, const fs::path& target) {
+    std::error_code ec;
+    fs::create_directories(target.parent_path(), ec);
+    // Replace instead of writing through, the old file may be a link shared with other versions
+    fs::remove(target, ec);
+
+    fs::create_hard_link(blob, target, ec);
+    if (!ec) {
+        return;
+    }
+    // Hard links need the store and the version folder on a volume that supports them
+    ec.clear();
+    fs::copy_file(blob, target, fs::copy_options::overwrite_existing, ec);
+    if (ec) {
+        throw std::runtime_error(fmt::format("Cannot create {}: {}",
+                                             Common::FS::PathToUTF8String(target), ec.message()));
+    }
+}
+
+} // Anonymous namespace
+
+InstallStats Install(const QString& zip_path, const QString& dest_dir) {
+    const fs::path version_dir = Common::FS::PathFromQString(dest_dir);
+    const fs::path store_dir = StoreDir(version_dir.parent_path());
+
+    std::error_code ec;
+    fs::create_directories(version_dir, ec);
+    fs::create_directories(store_dir / "manifests", ec);
+
+    InstallStats stats{};
+    json files = json::object();
+    Zip::ForEachEntry(zip_path, [&](const QString& name, const QByteArray& data) {
+        const fs::path entry = Common::FS::PathFromQString(name).lexically_normal();
+        if (name.endsWith('/') || !IsSafeEntryName(entry)) {
+            return;
+        }
+
+        const std::string hash =
+            QCryptographicHash::hash(data, QCryptographicHash::Sha256).toHex().toStdString();
+        const fs::path blob = BlobPath(store_dir, hash);
+
+        const std::span<const u8> bytes(reinterpret_cast<const u8*>(data.constData()),
+                                        static_cast<std::size_t>(data.size()));
+        // A blob of the wrong size was damaged outside the store, write it again rather than
+        // linking every version to it
+        std::error_code blob_ec;
+        const auto blob_size = fs::file_size(blob, blob_ec);
+        if (blob_ec || blob_size != bytes.size()) {
+            fs::create_directories(blob.parent_path(), blob_ec);
+            if (!Common::FS::WriteFileAtomically(blob, bytes)) {
+                throw std::runtime_error(fmt::format("Cannot write {}",
+                                                     Common::FS::PathToUTF8String(blob)));
+            }
+            ++stats.new_blobs;
+            stats.new_bytes += bytes.size();
+        }
+
+        Materialize(blob, version_dir / entry);
+        files[entry.generic_string()] = hash;
+        ++stats.files;
+    });
+
+    const std::string manifest = json{{"files", std::move(files)}}.dump(1);
+    const std::span<const u8> manifest_bytes(reinterpret_cast<const u8*>(manifest.data()),
+                                             manifest.size());
+    if (!Common::FS::WriteFileAtomically(ManifestPath(store_dir, version_dir), manifest_bytes)) {
+        LOG_WARNING(Common_Filesystem, "Could not write the manifest of {}",
+                    Common::FS::PathToUTF8String(version_dir));
+    }
+
+    LOG_INFO(Common_Filesystem, "Installed {} files into {}, {} new ({} bytes)", stats.files,
+             Common::FS::PathToUTF8String(version_dir), stats.new_blobs, stats.new_bytes);
+    return stats;
+}
+
+void CollectGarbage(const QString& versions_dir) {
+    const fs::path store_dir = StoreDir(Common::FS::PathFromQString(versions_dir));
+    std::error_code ec;
+    if (!fs::is_directory(store_dir, ec)) {
+        return;
+    }
+
+    std::set<std::string> live;
+    for (const auto& entry : fs::directory_iterator(store_dir / "manifests", ec)) {
+        const fs::path& manifest_path = entry.path();
+        if (manifest_path.extension() != ".json") {
+            continue;
+        }
+
+        std::error_code version_ec;
+        if (!fs::is_directory(store_dir.parent_path() / manifest_path.stem(), version_ec)) {
+            fs::remove(manifest_path, version_ec);
+            continue;
+        }
+
+        try {
+            std::ifstream in(manifest_path);
+            const json manifest = json::parse(in);
+            for (const auto& [name, hash] : manifest.at("files").items()) {
+                live.insert(hash.get<std::string>());
+            }
+        } catch (const std::exception& e) {
+            // Without its manifest the blobs of this version cannot be told apart, keep them all
+            LOG_ERROR(Common_Filesystem, "Unreadable manifest {}: {}",
+                      Common::FS::PathToUTF8String(manifest_path), e.what());
+            return;
+        }
+    }
+
+    std::vector<fs::path> dead;
+    for (const auto& entry : fs::recursive_directory_iterator(store_dir / "objects", ec)) {
+        std::error_code blob_ec;
+        if (entry.is_regular_file(blob_ec) &&
+            !live.contains(Common::FS::PathToUTF8String(entry.path().filename()))) {
+            dead.push_back(entry.path());
+        }
+    }
+    for (const fs::path& blob : dead) {
+        fs::remove(blob, ec);
+    }
+    if (!dead.empty()) {
+        LOG_INFO(Common_Filesystem, "Removed {} unreferenced version files", dead.size());
+    }
+}
+
+} // namespace VersionStore
@@ -0,0 +1,38 @@
+// SPDX-FileCopyrightText: Copyright 2025-2026 shadLauncher4 Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <QString>
+#include "common/types.h"
+
+/**
+ * Content-addressed store for the files of installed emulator versions.
+ *
+ * Every file is kept once under .store/objects in the versions directory, named after the SHA-256
+ * of its contents, and each version folder is populated with hard links to those blobs. A manifest
+ * per version folder lists the hash of every file. Builds that share most files, such as a row of
+ * nightlies, then only take the space of the files that differ, and installing one only writes
+ * the blobs that are not stored yet. Volumes without hard link support get plain copies.
+ */
+namespace VersionStore {
+
+struct InstallStats {
+    u32 files = 0;
+    u32 new_blobs = 0; // Files whose contents were not in the store yet
+    u64 new_bytes = 0; // Bytes written to the store
+};
+
+/**
+ * Extracts the ZIP archive into dest_dir, a folder directly inside the versions directory, through
+ * the store of that versions directory. Existing files of dest_dir are replaced, never written
+ * through, so other versions sharing their blob are unaffected.
+ *
+ * Throws std::runtime_error like Zip::Extract.
+ */
+InstallStats Install(const QString& zip_path, const QString& dest_dir);
+
+/// Drops the manifests of version folders that are gone and every blob no manifest references
+void CollectGarbage(const QString& versions_dir);
+
+} // namespace VersionStore
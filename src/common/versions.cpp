@@ -8,19 +8,45 @@
 #include <algorithm>
 #include <filesystem>
 #include <fstream>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <system_error>
 #include <vector>
 #include <fmt/core.h>
 #include <nlohmann/json.hpp>
+#include "io_file.h"
 
 using json = nlohmann::json;
 
 namespace VersionManager {
 
-std::vector<Version> GetVersionList(std::filesystem::path const& path) {
-    std::filesystem::path cfg_path =
-        path.empty() ? Common::FS::GetUserPath(Common::FS::PathType::UserDir) / "versions.json"
-                     : path;
+namespace {
+
+std::filesystem::path ListPath(std::filesystem::path const& path) {
+    return path.empty()
+               ? Common::FS::GetUserPath(Common::FS::PathType::UserDir) / "versions.json"
+               : path;
+}
 
+// The lists are read once and then answered from memory, until the file changes on disk
+struct CachedList {
+    std::filesystem::file_time_type mtime;
+    std::vector<Version> versions;
+};
+std::mutex list_mutex;
+std::map<std::filesystem::path, CachedList> list_cache;
+
+std::optional<std::filesystem::file_time_type> ModifiedTime(std::filesystem::path const& path) {
+    std::error_code ec;
+    const auto mtime = std::filesystem::last_write_time(path, ec);
+    if (ec) {
+        return std::nullopt;
+    }
+    return mtime;
+}
+
+std::vector<Version> ReadVersionList(std::filesystem::path const& cfg_path) {
     std::ifstream ifs{cfg_path};
     if (!ifs) {
         fmt::print(stderr, "VersionManager: Config file not found: {}\n", cfg_path.string());
@@ -74,10 +100,27 @@ std::vector<Version> GetVersionList(std::filesystem::path const& path) {
     return versions;
 }
 
+} // Anonymous namespace
+
+std::vector<Version> GetVersionList(std::filesystem::path const& path) {
+    const std::filesystem::path cfg_path = ListPath(path);
+    const auto mtime = ModifiedTime(cfg_path);
+
+    std::scoped_lock lock{list_mutex};
+    if (const auto it = list_cache.find(cfg_path);
+        mtime && it != list_cache.end() && it->second.mtime == *mtime) {
+        return it->second.versions;
+    }
+
+    std::vector<Version> versions = ReadVersionList(cfg_path);
+    if (const auto new_mtime = ModifiedTime(cfg_path)) {
+        list_cache.insert_or_assign(cfg_path, CachedList{*new_mtime, versions});
+    }
+    return versions;
+}
+
 void SaveVersionList(std::vector<Version> const& versions, std::filesystem::path const& path) {
-    std::filesystem::path out_path =
-        path.empty() ? Common::FS::GetUserPath(Common::FS::PathType::UserDir) / "versions.json"
-                     : path;
+    const std::filesystem::path out_path = ListPath(path);
 
     json root = json::array();
 
@@ -89,13 +132,26 @@ void SaveVersionList(std::vector<Version> const& versions, std::filesystem::path
                         {"type", static_cast<int>(v.type)}});
     }
 
-    std::ofstream ofs(out_path, std::ios::trunc);
-    if (!ofs) {
-        fmt::print(stderr, "Failed to open file for writing: {}\n", out_path.string());
+    const std::string text = root.dump(4);
+    const bool written = Common::FS::WriteFileAtomically(out_path, [&](Common::FS::IOFile& file) {
+        return file.WriteString(text) == text.size();
+    });
+    if (!written) {
+        fmt::print(stderr, "Failed to write {}\n", out_path.string());
         return;
     }
 
-    ofs << std::setw(4) << root;
+    // Keep what was written, numbered the way reading the file back would
+    std::vector<Version> cached = versions;
+    for (std::size_t i = 0; i < cached.size(); ++i) {
+        cached[i].id = static_cast<s32>(i);
+    }
+    std::scoped_lock lock{list_mutex};
+    if (const auto mtime = ModifiedTime(out_path)) {
+        list_cache.insert_or_assign(out_path, CachedList{*mtime, std::move(cached)});
+    } else {
+        list_cache.erase(out_path);
+    }
 }
 
 void AddNewVersion(Version const& v, std::filesystem::path const& path) {
@@ -13,12 +13,26 @@
 
 namespace Zip {
 void Extract(const QString& zipPath, const QString& outDir) {
+    QDir().mkpath(outDir);
+
+    ForEachEntry(zipPath, [&outDir](const QString& name, const QByteArray& data) {
+        QString outFilePath = QDir(outDir).filePath(name);
+
+        QDir().mkpath(QFileInfo(outFilePath).path());
+
+        QFile outFile(outFilePath);
+        outFile.open(QIODevice::WriteOnly);
+        outFile.write(data);
+    });
+}
+
+void ForEachEntry(
+    const QString& zipPath,
+    const std::function<void(const QString& name, const QByteArray& data)>& callback) {
     QFile file(zipPath);
     if (!file.open(QIODevice::ReadOnly))
         throw std::runtime_error("Cannot open ZIP file");
 
-    QDir().mkpath(outDir);
-
     libdeflate_decompressor* d = libdeflate_alloc_decompressor();
     if (!d)
         throw std::runtime_error("libdeflate alloc failed");
@@ -94,13 +108,7 @@ void Extract(const QString& zipPath, const QString& outDir) {
                 if (res != LIBDEFLATE_SUCCESS)
                     throw std::runtime_error("Decompression failed");
 
-                QString outFilePath = QDir(outDir).filePath(QString::fromUtf8(filename));
-
-                QDir().mkpath(QFileInfo(outFilePath).path());
-
-                QFile outFile(outFilePath);
-                outFile.open(QIODevice::WriteOnly);
-                outFile.write(decompressed);
+                callback(QString::fromUtf8(filename), decompressed);
             } else {
                 // No Data Descriptor
                 QByteArray compressed = file.read(compSizeHeader);
@@ -116,13 +124,7 @@ void Extract(const QString& zipPath, const QString& outDir) {
                 if (res != LIBDEFLATE_SUCCESS)
                     throw std::runtime_error("Decompression failed");
 
-                QString outFilePath = QDir(outDir).filePath(QString::fromUtf8(filename));
-
-                QDir().mkpath(QFileInfo(outFilePath).path());
-
-                QFile outFile(outFilePath);
-                outFile.open(QIODevice::WriteOnly);
-                outFile.write(decompressed);
+                callback(QString::fromUtf8(filename), decompressed);
             }
         }
     } catch (...) {
@@ -3,8 +3,14 @@
 
 #pragma once
 
+#include <functional>
+#include <QByteArray>
 #include <QString>
 
 namespace Zip {
 void Extract(const QString& zipPath, const QString& outDir);
+
+/// Decompresses every entry of the archive in order and hands its name and contents to callback
+void ForEachEntry(const QString& zipPath,
+                  const std::function<void(const QString& name, const QByteArray& data)>& callback);
 }
\ No newline at end of file
@@ -3,10 +3,15 @@
 
 #include <algorithm>
 #include <fstream>
-#include <iomanip>
 #include <map>
+#include <optional>
+#include <system_error>
+#include <unordered_map>
 #include <common/path_util.h>
 #include <common/scm_rev.h>
+#include <common/string_util.h>
+#include <fmt/core.h>
+#include "common/io_file.h"
 #include "common/logging/log.h"
 #include "emulator_settings.h"
 #include "emulator_state.h"
@@ -34,6 +39,223 @@ struct adl_serializer<std::filesystem::path> {
     }
 };
 } // namespace nlohmann
+
+// ── Parsed config cache ───────────────────────────────────────────────
+// Shared by every EmulatorSettingsImpl, so a settings dialog or a game launch reuses what was
+// parsed before as long as the file on disk did not change.
+namespace {
+
+struct FileStamp {
+    std::filesystem::file_time_type mtime{};
+    std::uintmax_t size = 0;
+
+    bool operator==(const FileStamp&) const = default;
+};
+
+std::optional<FileStamp> StatFile(const std::filesystem::path& path) {
+    std::error_code ec;
+    const auto mtime = std::filesystem::last_write_time(path, ec);
+    if (ec) {
+        return std::nullopt;
+    }
+    const auto size = std::filesystem::file_size(path, ec);
+    if (ec) {
+        return std::nullopt;
+    }
+    return FileStamp{mtime, size};
+}
+
+// config.json merged over the defaults, immutable once built
+struct GlobalBaseline {
+    FileStamp stamp;
+    std::shared_ptr<const json> document;
+    GeneralSettings general{};
+    DebugSettings debug{};
+    InputSettings input{};
+    AudioSettings audio{};
+    GPUSettings gpu{};
+    VulkanSettings vulkan{};
+};
+
+struct CachedDocument {
+    FileStamp stamp;
+    std::shared_ptr<const json> document;
+};
+
+std::mutex s_cache_mutex;
+std::shared_ptr<const GlobalBaseline> s_baseline;
+std::unordered_map<std::string, CachedDocument> s_game_configs;
+// config.json as the last Save wrote it, so saving again does not have to parse it back
+std::optional<CachedDocument> s_saved_global;
+// Case-folded serial -> name of its file in CustomConfigs, filled from one listing on first use.
+// Matched like Common::FS::DirectoryListing, so cusa00001.json still belongs to CUSA00001.
+std::optional<std::unordered_map<std::string, std::string>> s_game_config_files;
+
+// Where a new per-game config of serial is written
+std::filesystem::path GameConfigPath(const std::string& serial) {
+    return Common::FS::GetUserPath(Common::FS::PathType::CustomConfigs) / (serial + ".json");
+}
+
+// Requires s_cache_mutex
+std::unordered_map<std::string, std::string>& GameConfigFiles() {
+    if (!s_game_config_files) {
+        auto& files = s_game_config_files.emplace();
+        std::error_code ec;
+        const auto dir = Common::FS::GetUserPath(Common::FS::PathType::CustomConfigs);
+        for (const auto& entry : std::filesystem::directory_iterator(dir, ec)) {
+            if (entry.path().extension() == ".json" && entry.is_regular_file(ec)) {
+                files.insert_or_assign(Common::ToLower(entry.path().stem().string()),
+                                       entry.path().filename().string());
+            }
+        }
+    }
+    return *s_game_config_files;
+}
+
+// The per-game config of serial in the spelling it has on disk. Serials missing from the listing
+// cost one stat, so a file the emulator or the user created since is still found.
+std::optional<std::filesystem::path> FindGameConfig(const std::string& serial) {
+    const std::string key = Common::ToLower(serial);
+    {
+        std::scoped_lock lock{s_cache_mutex};
+        const auto& files = GameConfigFiles();
+        if (const auto it = files.find(key); it != files.end()) {
+            return Common::FS::GetUserPath(Common::FS::PathType::CustomConfigs) / it->second;
+        }
+    }
+
+    auto path = GameConfigPath(serial);
+    std::error_code ec;
+    if (!std::filesystem::is_regular_file(path, ec)) {
+        return std::nullopt;
+    }
+    std::scoped_lock lock{s_cache_mutex};
+    GameConfigFiles().insert_or_assign(key, path.filename().string());
+    return path;
+}
+
+std::shared_ptr<const json> ParseFile(const std::filesystem::path& path) {
+    std::ifstream in(path);
+    if (!in) {
+        return nullptr;
+    }
+    auto document = std::make_shared<json>();
+    in >> *document;
+    return document;
+}
+
+std::shared_ptr<const GlobalBaseline> LoadBaseline(const std::filesystem::path& path,
+                                                   const FileStamp& stamp) {
+    {
+        std::scoped_lock lock{s_cache_mutex};
+        if (s_baseline && s_baseline->stamp == stamp) {
+            return s_baseline;
+        }
+    }
+
+    const auto document = ParseFile(path);
+    if (!document) {
+        return nullptr;
+    }
+
+    auto baseline = std::make_shared<GlobalBaseline>();
+    baseline->stamp = stamp;
+    baseline->document = document->is_object() ? document : std::make_shared<json>(json::object());
+
+    const json& gj = *baseline->document;
+    auto mergeGroup = [&gj](auto& group, const char* section) {
+        if (!gj.contains(section))
+            return;
+        json current = group;
+        current.update(gj.at(section));
+        group = current.get<std::remove_reference_t<decltype(group)>>();
+    };
+    mergeGroup(baseline->general, "General");
+    mergeGroup(baseline->debug, "Debug");
+    mergeGroup(baseline->input, "Input");
+    mergeGroup(baseline->audio, "Audio");
+    mergeGroup(baseline->gpu, "GPU");
+    mergeGroup(baseline->vulkan, "Vulkan");
+
+    std::scoped_lock lock{s_cache_mutex};
+    s_baseline = baseline;
+    return baseline;
+}
+
+std::shared_ptr<const json> LoadGameConfig(const std::string& serial,
+                                           const std::filesystem::path& path) {
+    const auto stamp = StatFile(path);
+
+    std::unique_lock lock{s_cache_mutex};
+    if (!stamp) {
+        // Removed behind our back
+        GameConfigFiles().erase(Common::ToLower(serial));
+        s_game_configs.erase(serial);
+        return nullptr;
+    }
+    if (const auto it = s_game_configs.find(serial);
+        it != s_game_configs.end() && it->second.stamp == *stamp) {
+        return it->second.document;
+    }
+    lock.unlock();
+
+    auto document = ParseFile(path);
+    if (!document) {
+        return nullptr;
+    }
+
+    lock.lock();
+    s_game_configs.insert_or_assign(serial, CachedDocument{*stamp, document});
+    return document;
+}
+
+// config.json as it is on disk right now, parsed again only if it changed since the last Load or
+// Save. Null if it is missing or unreadable.
+std::shared_ptr<const json> CurrentGlobalDocument(const std::filesystem::path& path) {
+    const auto stamp = StatFile(path);
+    if (!stamp) {
+        return nullptr;
+    }
+    {
+        std::scoped_lock lock{s_cache_mutex};
+        if (s_saved_global && s_saved_global->stamp == *stamp) {
+            return s_saved_global->document;
+        }
+    }
+
+    try {
+        const auto baseline = LoadBaseline(path, *stamp);
+        return baseline ? baseline->document : nullptr;
+    } catch (const std::exception& e) {
+        LOG_WARNING(EmuSettings, "Replacing unreadable {}: {}", path.string(), e.what());
+        return nullptr;
+    }
+}
+
+} // Anonymous namespace
+
+bool EmulatorSettingsImpl::HasGameConfig(const std::string& serial) {
+    return FindGameConfig(serial).has_value();
+}
+
+void EmulatorSettingsImpl::RescanGameConfigs() {
+    std::scoped_lock lock{s_cache_mutex};
+    s_game_config_files.reset();
+    GameConfigFiles();
+}
+
+bool EmulatorSettingsImpl::RemoveGameConfig(const std::string& serial, std::error_code& ec) {
+    const bool removed =
+        std::filesystem::remove(FindGameConfig(serial).value_or(GameConfigPath(serial)), ec);
+
+    std::scoped_lock lock{s_cache_mutex};
+    if (!ec) {
+        GameConfigFiles().erase(Common::ToLower(serial));
+        s_game_configs.erase(serial);
+    }
+    return removed;
+}
+
 #if 0
 namespace toml {
 // why is it so hard to avoid exceptions with this library
@@ -242,12 +464,25 @@ void EmulatorSettingsImpl::ResetGameSpecificValue(const std::string& key) {
     LOG_WARNING(EmuSettings, "ResetGameSpecificValue: key '{}' not found", key);
 }
 
+// Write next to the config and move it into place, so a crash never leaves a truncated file
+static bool WriteConfigFile(const std::filesystem::path& path, const json& j) {
+    const std::string text = j.dump(2);
+    const bool written = Common::FS::WriteFileAtomically(path, [&](Common::FS::IOFile& file) {
+        return file.WriteString(text) == text.size();
+    });
+    if (!written) {
+        LOG_ERROR(EmuSettings, "Failed to write config: {}", path.string());
+    }
+    return written;
+}
+
 bool EmulatorSettingsImpl::Save(const std::string& serial) {
     try {
         if (!serial.empty()) {
-            const auto cfgDir = Common::FS::GetUserPath(Common::FS::PathType::CustomConfigs);
-            std::filesystem::create_directories(cfgDir);
-            const auto path = cfgDir / (serial + ".json");
+            std::filesystem::create_directories(
+                Common::FS::GetUserPath(Common::FS::PathType::CustomConfigs));
+            // Replaces the existing file even if it is spelled differently
+            const auto path = FindGameConfig(serial).value_or(GameConfigPath(serial));
 
             json j = json::object();
 
@@ -275,13 +510,14 @@ bool EmulatorSettingsImpl::Save(const std::string& serial) {
             SaveGroupGameSpecific(m_vulkan, vulkanObj);
             j["Vulkan"] = vulkanObj;
 
-            std::ofstream out(path);
-            if (!out) {
-                LOG_ERROR(EmuSettings, "Failed to open game config for writing: {}", path.string());
+            if (!WriteConfigFile(path, j)) {
                 return false;
             }
-            out << std::setw(2) << j;
-            return !out.fail();
+
+            std::scoped_lock lock{s_cache_mutex};
+            GameConfigFiles().insert_or_assign(Common::ToLower(serial), path.filename().string());
+            s_game_configs.erase(serial);
+            return true;
 
         } else {
             // ── Global config.json ─────────────────────────────────────
@@ -298,15 +534,10 @@ bool EmulatorSettingsImpl::Save(const std::string& serial) {
             j["GPU"] = m_gpu;
             j["Vulkan"] = m_vulkan;
 
-            // Read the existing file so we can preserve keys unknown to this build
-            json existing = json::object();
-            if (std::ifstream existingIn{path}; existingIn.good()) {
-                try {
-                    existingIn >> existing;
-                } catch (...) {
-                    existing = json::object();
-                }
-            }
+            // Start from the file as it is now, so keys unknown to this build are preserved, even
+            // ones another instance wrote since this one loaded
+            const auto current = CurrentGlobalDocument(path);
+            json existing = current ? *current : json::object();
 
             // Merge: update each section's known keys, but leave unknown keys intact
             for (auto& [section, val] : j.items()) {
@@ -316,13 +547,22 @@ bool EmulatorSettingsImpl::Save(const std::string& serial) {
                     existing[section] = val;
             }
 
-            std::ofstream out(path);
-            if (!out) {
-                LOG_ERROR(EmuSettings, "Failed to open config for writing: {}", path.string());
+            if (current && existing == *current) {
+                return true;
+            }
+            if (!WriteConfigFile(path, existing)) {
                 return false;
             }
-            out << std::setw(2) << existing;
-            return !out.fail();
+            const auto stamp = StatFile(path);
+
+            std::scoped_lock lock{s_cache_mutex};
+            s_baseline.reset();
+            s_saved_global.reset();
+            if (stamp) {
+                s_saved_global =
+                    CachedDocument{*stamp, std::make_shared<const json>(std::move(existing))};
+            }
+            return true;
         }
     } catch (const std::exception& e) {
         LOG_ERROR(EmuSettings, "Error saving settings: {}", e.what());
@@ -340,24 +580,14 @@ bool EmulatorSettingsImpl::Load(const std::string& serial) {
             const auto configPath = userDir / "config.json";
             LOG_DEBUG(EmuSettings, "Loading global config from: {}", configPath.string());
 
-            if (std::ifstream in{configPath}; in.good()) {
-                json gj;
-                in >> gj;
-
-                auto mergeGroup = [&gj](auto& group, const char* section) {
-                    if (!gj.contains(section))
-                        return;
-                    json current = group;
-                    current.update(gj.at(section));
-                    group = current.get<std::remove_reference_t<decltype(group)>>();
-                };
-
-                mergeGroup(m_general, "General");
-                mergeGroup(m_debug, "Debug");
-                mergeGroup(m_input, "Input");
-                mergeGroup(m_audio, "Audio");
-                mergeGroup(m_gpu, "GPU");
-                mergeGroup(m_vulkan, "Vulkan");
+            const auto stamp = StatFile(configPath);
+            if (const auto baseline = stamp ? LoadBaseline(configPath, *stamp) : nullptr) {
+                m_general = baseline->general;
+                m_debug = baseline->debug;
+                m_input = baseline->input;
+                m_audio = baseline->audio;
+                m_gpu = baseline->gpu;
+                m_vulkan = baseline->vulkan;
 
                 LOG_DEBUG(EmuSettings, "Global config loaded successfully");
             } else {
@@ -407,23 +637,19 @@ bool EmulatorSettingsImpl::Load(const std::string& serial) {
             // Never reloads global settings. Only applies
             // game_specific_value overrides on top of the already-loaded
             // base configuration.
-            const auto gamePath =
-                Common::FS::GetUserPath(Common::FS::PathType::CustomConfigs) / (serial + ".json");
-            LOG_DEBUG(EmuSettings, "Applying game config: {}", gamePath.string());
-
-            if (!std::filesystem::exists(gamePath)) {
+            const auto gamePath = FindGameConfig(serial);
+            if (!gamePath) {
                 LOG_DEBUG(EmuSettings, "No game-specific config found for {}", serial);
                 return false;
             }
+            LOG_DEBUG(EmuSettings, "Applying game config: {}", gamePath->string());
 
-            std::ifstream in(gamePath);
-            if (!in) {
-                LOG_ERROR(EmuSettings, "Failed to open game config: {}", gamePath.string());
+            const auto document = LoadGameConfig(serial, *gamePath);
+            if (!document) {
+                LOG_ERROR(EmuSettings, "Failed to open game config: {}", gamePath->string());
                 return false;
             }
-
-            json gj;
-            in >> gj;
+            const json& gj = *document;
 
             std::vector<std::string> changed;
 
@@ -9,6 +9,7 @@
 #include <mutex>
 #include <sstream>
 #include <string>
+#include <system_error>
 #include <vector>
 #include <nlohmann/json.hpp>
 #include "common/logging/log.h"
@@ -425,6 +426,15 @@ public:
     void SetDefaultValues();
     bool TransferSettings();
 
+    /// Whether serial has a per-game config, matched case-insensitively. Answered from one listing
+    /// of CustomConfigs that Save(serial) and RemoveGameConfig keep current; a serial missing from
+    /// it costs one stat, so files created outside the launcher are still found.
+    static bool HasGameConfig(const std::string& serial);
+    /// Lists CustomConfigs again, to pick up files changed outside the launcher.
+    static void RescanGameConfigs();
+    /// Deletes the per-game config of serial, with the semantics of std::filesystem::remove.
+    static bool RemoveGameConfig(const std::string& serial, std::error_code& ec);
+
     // Config mode
     ConfigMode GetConfigMode() const {
         return m_configMode;
@@ -2,66 +2,54 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include <cstring>
-#include <fstream>
-#include <iomanip>
-#include <sstream>
 #include <vector>
+#include "common/mapped_file.h"
 #include "npbind.h"
 
-bool NPBindFile::Load(const std::string& path) {
-    Clear(); // Clear any existing data
-
-    std::ifstream f(path, std::ios::binary | std::ios::ate);
-    if (!f)
-        return false;
-
-    std::streamsize sz = f.tellg();
-    if (sz <= 0)
-        return false;
-
-    f.seekg(0, std::ios::beg);
-    std::vector<u8> buf(static_cast<size_t>(sz));
-    if (!f.read(reinterpret_cast<char*>(buf.data()), sz))
-        return false;
+namespace {
 
+/// Walks every body of an npbind.dat buffer, calling fn for each one. Shared by the owning
+/// NPBindFile and the zero-copy NPBindView.
+template <typename Fn>
+bool ParseNpBind(std::span<const u8> buf, NpBindHeader& header, Fn&& fn) {
     const u64 size = buf.size();
     if (size < sizeof(NpBindHeader))
         return false;
 
     // Read header
-    memcpy(&m_header, buf.data(), sizeof(NpBindHeader));
-    if (m_header.magic != NPBIND_MAGIC)
+    memcpy(&header, buf.data(), sizeof(NpBindHeader));
+    if (header.magic != NPBIND_MAGIC)
         return false;
 
     // offset start of bodies
     size_t offset = sizeof(NpBindHeader);
 
-    m_bodies.reserve(static_cast<size_t>(m_header.num_entries));
-
     // For each body: read 4 TLV entries then skip padding (0x98 = 152 bytes)
     const u64 body_padding = 0x98; // 152
 
-    for (u64 bi = 0; bi < m_header.num_entries; ++bi) {
+    for (u64 bi = 0; bi < header.num_entries; ++bi) {
         // Ensure we have room for 4 entries' headers at least
         if (offset + 4 * 4 > size)
             return false; // 4 entries x (type+size)
 
-        NPBindBody body;
+        NPBindBodyView body;
 
         // helper lambda to read one entry
-        auto read_entry = [&](NPBindEntryRaw& e) -> bool {
+        auto read_entry = [&](NPBindEntryView& e) -> bool {
             if (offset + 4 > size)
                 return false;
 
-            memcpy(&e.type, &buf[offset], 2);
-            memcpy(&e.size, &buf[offset + 2], 2);
+            u16_be type, entry_size;
+            memcpy(&type, &buf[offset], 2);
+            memcpy(&entry_size, &buf[offset + 2], 2);
             offset += 4;
 
-            if (offset + e.size > size)
+            if (offset + entry_size > size)
                 return false;
 
-            e.data.assign(buf.begin() + offset, buf.begin() + offset + e.size);
-            offset += e.size;
+            e.type = type;
+            e.data = buf.subspan(offset, entry_size);
+            offset += entry_size;
             return true;
         };
 
@@ -83,16 +71,60 @@ bool NPBindFile::Load(const std::string& path) {
             offset = size;
         }
 
-        m_bodies.push_back(std::move(body));
+        fn(body);
     }
 
+    return true;
+}
+
+NPBindEntryRaw ToRaw(const NPBindEntryView& e) {
+    NPBindEntryRaw raw;
+    raw.type.FromSwap(e.type);
+    raw.size.FromSwap(static_cast<u16>(e.data.size()));
+    raw.data.assign(e.data.begin(), e.data.end());
+    return raw;
+}
+
+} // namespace
+
+bool NPBindView::Open(std::span<const u8> buffer) {
+    m_body_count = 0;
+    m_digest = {};
+
+    const bool ok = ParseNpBind(buffer, m_header, [this](const NPBindBodyView& body) {
+        if (m_body_count < MaxBodies) {
+            m_bodies[m_body_count++] = body;
+        }
+    });
+    if (!ok)
+        return false;
+
+    // Digest is typically the last 20 bytes, independent of offset
+    m_digest = buffer.last(20);
+    return true;
+}
+
+bool NPBindFile::Load(const std::string& path) {
+    Clear(); // Clear any existing data
+
+    const Common::FS::MappedFile file(path);
+    if (!file.IsOpen())
+        return false;
+
+    const bool ok = ParseNpBind(file.Span(), m_header, [this](const NPBindBodyView& view) {
+        NPBindBody body;
+        body.npcommid = ToRaw(view.npcommid);
+        body.trophy = ToRaw(view.trophy);
+        body.unk1 = ToRaw(view.unk1);
+        body.unk2 = ToRaw(view.unk2);
+        m_bodies.push_back(std::move(body));
+    });
+    if (!ok)
+        return false;
+
     // Read digest if available
-    if (size >= 20) {
-        // Digest is typically the last 20 bytes, independent of offset
-        memcpy(m_digest, &buf[size - 20], 20);
-    } else {
-        memset(m_digest, 0, 20);
-    }
+    // Digest is typically the last 20 bytes, independent of offset
+    memcpy(m_digest, file.Data() + file.Size() - 20, 20);
 
     return true;
 }
@@ -2,8 +2,12 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #pragma once
+#include <array>
 #include <cstdint>
+#include <cstring>
+#include <span>
 #include <string>
+#include <string_view>
 #include <vector>
 #include "common/endian.h"
 #include "common/types.h"
@@ -35,6 +39,50 @@ struct NPBindBody {
     // The 0x98 padding after these entries is skipped while parsing
 };
 
+struct NPBindEntryView {
+    u16 type = 0;
+    std::span<const u8> data;
+};
+
+struct NPBindBodyView {
+    NPBindEntryView npcommid;
+    NPBindEntryView trophy;
+    NPBindEntryView unk1;
+    NPBindEntryView unk2;
+};
+
+/**
+ * Read-only view over an npbind.dat buffer, typically a Common::FS::MappedFile.
+ * Entries point straight into the buffer, which must outlive the view.
+ */
+class NPBindView {
+public:
+    // Games normally carry one body, a handful at most
+    static constexpr size_t MaxBodies = 16;
+
+    bool Open(std::span<const u8> buffer);
+
+    const NpBindHeader& Header() const {
+        return m_header;
+    }
+    std::span<const NPBindBodyView> Bodies() const {
+        return {m_bodies.data(), m_body_count};
+    }
+    std::string_view NpCommId(size_t index) const {
+        const auto& data = m_bodies.at(index).npcommid.data;
+        return {reinterpret_cast<const char*>(data.data()), data.size()};
+    }
+    std::span<const u8> Digest() const {
+        return m_digest;
+    }
+
+private:
+    NpBindHeader m_header{};
+    std::array<NPBindBodyView, MaxBodies> m_bodies{};
+    size_t m_body_count = 0;
+    std::span<const u8> m_digest;
+};
+
 class NPBindFile {
 private:
     NpBindHeader m_header;
@@ -8,6 +8,7 @@
 #include "common/assert.h"
 #include "common/io_file.h"
 #include "common/logging/log.h"
+#include "common/mapped_file.h"
 #include "core/file_format/psf.h"
 
 static const std::unordered_map<std::string_view, u32> psf_known_max_sizes = {
@@ -32,21 +33,18 @@ bool PSF::Open(const std::filesystem::path& filepath) {
         last_write = system_clock::from_time_t(tp);
     }
 
-    Common::FS::IOFile file(filepath, Common::FS::FileAccessMode::Read);
+    const Common::FS::MappedFile file(filepath);
     if (!file.IsOpen()) {
         return false;
     }
-
-    const u64 psfSize = file.GetSize();
-    ASSERT_MSG(psfSize != 0, "SFO file at {} is empty!", filepath.string());
-    std::vector<u8> psf(psfSize);
-    file.Seek(0);
-    file.Read(psf);
-    file.Close();
-    return Open(psf);
+    return Open(file.Span());
 }
 
 bool PSF::Open(const std::vector<u8>& psf_buffer) {
+    return Open(std::span<const u8>{psf_buffer});
+}
+
+bool PSF::Open(std::span<const u8> psf_buffer) {
     const u8* psf_data = psf_buffer.data();
 
     entry_list.clear();
@@ -54,6 +52,11 @@ bool PSF::Open(const std::vector<u8>& psf_buffer) {
     map_strings.clear();
     map_integers.clear();
 
+    if (psf_buffer.size() < sizeof(PSFHeader)) {
+        LOG_ERROR(Core, "PSF buffer is too small");
+        return false;
+    }
+
     // Parse file contents
     PSFHeader header{};
     std::memcpy(&header, psf_data, sizeof(header));
@@ -293,3 +296,138 @@ std::pair<std::vector<PSF::Entry>::const_iterator, size_t> PSF::FindEntry(
         std::ranges::find_if(entry_list, [&](const auto& entry) { return entry.key == key; });
     return {entry, std::distance(entry_list.begin(), entry)};
 }
+
+static constexpr u32 HashKey(std::string_view key) {
+    // FNV-1a
+    u32 hash = 2166136261u;
+    for (const char c : key) {
+        hash = (hash ^ static_cast<u8>(c)) * 16777619u;
+    }
+    return hash;
+}
+
+bool PSFView::Open(std::span<const u8> psf_buffer) {
+    buffer = {};
+    num_entries = 0;
+    slots.fill(EmptySlot);
+
+    if (psf_buffer.size() < sizeof(PSFHeader)) {
+        LOG_ERROR(Core, "PSF buffer is too small");
+        return false;
+    }
+
+    PSFHeader header{};
+    std::memcpy(&header, psf_buffer.data(), sizeof(header));
+
+    if (header.magic != PSF_MAGIC) {
+        LOG_ERROR(Core, "Invalid PSF magic number");
+        return false;
+    }
+    if (header.version != PSF_VERSION_1_1 && header.version != PSF_VERSION_1_0) {
+        LOG_ERROR(Core, "Unsupported PSF version: 0x{:08x}", header.version);
+        return false;
+    }
+
+    const u64 size = psf_buffer.size();
+    const u32 entries = header.index_table_entries;
+    if (entries > MaxEntries ||
+        sizeof(PSFHeader) + u64{entries} * sizeof(PSFRawEntry) > size ||
+        header.key_table_offset >= size || header.data_table_offset > size) {
+        LOG_ERROR(Core, "Malformed PSF header");
+        return false;
+    }
+
+    buffer = psf_buffer;
+    key_table_offset = header.key_table_offset;
+    data_table_offset = header.data_table_offset;
+
+    for (u32 i = 0; i < entries; i++) {
+        const PSFRawEntry raw_entry = RawEntry(i);
+
+        const u64 key_pos = u64{key_table_offset} + raw_entry.key_offset;
+        const u64 data_pos = u64{data_table_offset} + raw_entry.data_offset;
+        if (key_pos >= size || data_pos + raw_entry.param_len > size ||
+            !std::memchr(buffer.data() + key_pos, 0, size - key_pos)) {
+            LOG_ERROR(Core, "PSF entry {} is out of bounds", i);
+            buffer = {};
+            return false;
+        }
+
+        // Keep the first entry on duplicate keys, like PSF::FindEntry does
+        const std::string_view key = Key(raw_entry);
+        for (u32 slot = HashKey(key) % NumSlots;; slot = (slot + 1) % NumSlots) {
+            if (slots[slot] == EmptySlot) {
+                slots[slot] = static_cast<u8>(i + 1);
+                break;
+            }
+            if (Key(RawEntry(slots[slot] - 1)) == key) {
+                break;
+            }
+        }
+    }
+
+    num_entries = entries;
+    return true;
+}
+
+PSFRawEntry PSFView::RawEntry(u32 index) const {
+    PSFRawEntry raw_entry{};
+    std::memcpy(&raw_entry, buffer.data() + sizeof(PSFHeader) + index * sizeof(PSFRawEntry),
+                sizeof(raw_entry));
+    return raw_entry;
+}
+
+std::string_view PSFView::Key(const PSFRawEntry& entry) const {
+    return reinterpret_cast<const char*>(buffer.data() + key_table_offset + entry.key_offset);
+}
+
+std::optional<PSFRawEntry> PSFView::Find(std::string_view key, PSFEntryFmt fmt) const {
+    if (num_entries == 0) {
+        return {};
+    }
+    for (u32 slot = HashKey(key) % NumSlots; slots[slot] != EmptySlot;
+         slot = (slot + 1) % NumSlots) {
+        const PSFRawEntry raw_entry = RawEntry(slots[slot] - 1);
+        if (Key(raw_entry) == key) {
+            if (static_cast<PSFEntryFmt>(raw_entry.param_fmt.Raw()) != fmt) {
+                LOG_ERROR(Core, "PSF: Unexpected format for key {}", key);
+                return {};
+            }
+            return raw_entry;
+        }
+    }
+    return {};
+}
+
+std::optional<std::span<const u8>> PSFView::GetBinary(std::string_view key) const {
+    const auto raw_entry = Find(key, PSFEntryFmt::Binary);
+    if (!raw_entry) {
+        return {};
+    }
+    return buffer.subspan(data_table_offset + raw_entry->data_offset, raw_entry->param_len);
+}
+
+std::optional<std::string_view> PSFView::GetString(std::string_view key) const {
+    const auto raw_entry = Find(key, PSFEntryFmt::Text);
+    if (!raw_entry) {
+        return {};
+    }
+    const char* data =
+        reinterpret_cast<const char*>(buffer.data() + data_table_offset + raw_entry->data_offset);
+    // Stop at the NULL terminator, but never read past the stored length
+    const void* terminator = std::memchr(data, 0, raw_entry->param_len);
+    const size_t length = terminator ? static_cast<const char*>(terminator) - data
+                                     : static_cast<size_t>(raw_entry->param_len);
+    return std::string_view{data, length};
+}
+
+std::optional<s32> PSFView::GetInteger(std::string_view key) const {
+    const auto raw_entry = Find(key, PSFEntryFmt::Integer);
+    if (!raw_entry || raw_entry->param_len != sizeof(s32)) {
+        return {};
+    }
+    s32 integer;
+    std::memcpy(&integer, buffer.data() + data_table_offset + raw_entry->data_offset,
+                sizeof(integer));
+    return integer;
+}
@@ -5,8 +5,10 @@
 
 #pragma once
 
+#include <array>
 #include <chrono>
 #include <filesystem>
+#include <optional>
 #include <span>
 #include <string>
 #include <string_view>
@@ -60,6 +62,7 @@ public:
 
     bool Open(const std::filesystem::path& filepath);
     bool Open(const std::vector<u8>& psf_buffer);
+    bool Open(std::span<const u8> psf_buffer);
 
     [[nodiscard]] std::vector<u8> Encode() const;
     void Encode(std::vector<u8>& buf) const;
@@ -95,3 +98,41 @@ private:
     [[nodiscard]] std::pair<std::vector<Entry>::const_iterator, size_t> FindEntry(
         std::string_view key) const;
 };
+
+/**
+ * Read-only view over an encoded PSF buffer, typically a Common::FS::MappedFile.
+ *
+ * Keys and values are handed out as views into the buffer, which must outlive the view. Lookups
+ * go through a small inline hash table, so opening and querying does not allocate.
+ */
+class PSFView {
+public:
+    static constexpr u32 MaxEntries = 255;
+
+    PSFView() = default;
+
+    bool Open(std::span<const u8> psf_buffer);
+
+    [[nodiscard]] std::optional<std::span<const u8>> GetBinary(std::string_view key) const;
+    [[nodiscard]] std::optional<std::string_view> GetString(std::string_view key) const;
+    [[nodiscard]] std::optional<s32> GetInteger(std::string_view key) const;
+
+    [[nodiscard]] u32 EntryCount() const {
+        return num_entries;
+    }
+
+private:
+    static constexpr u32 NumSlots = 512;
+    static constexpr u8 EmptySlot = 0;
+
+    [[nodiscard]] PSFRawEntry RawEntry(u32 index) const;
+    [[nodiscard]] std::string_view Key(const PSFRawEntry& entry) const;
+    [[nodiscard]] std::optional<PSFRawEntry> Find(std::string_view key, PSFEntryFmt fmt) const;
+
+    std::span<const u8> buffer;
+    u32 key_table_offset = 0;
+    u32 data_table_offset = 0;
+    u32 num_entries = 0;
+    // Entry index + 1 for each occupied slot, linear probing
+    std::array<u8, NumSlots> slots{};
+};
@@ -1,15 +1,24 @@
 // SPDX-FileCopyrightText: Copyright 2024-2026 shadPS4 Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <charconv>
+#include <map>
 #include "common/aes.h"
+#include "common/crypto.h"
 #include "common/key_manager.h"
 #include "common/logging/log.h"
+#include "common/mapped_file.h"
 #include "common/path_util.h"
 #include "core/file_format/trp.h"
 
 static void DecryptEFSM(std::span<const u8, 16> trophyKey, std::span<const u8, 16> NPcommID,
                         std::span<const u8, 16> efsmIv, std::span<const u8> ciphertext,
                         std::span<u8> decrypted) {
+    if (Crypto::HasAesNi()) {
+        Crypto{}.decryptEFSM(trophyKey, NPcommID, efsmIv, ciphertext, decrypted);
+        return;
+    }
+
     // Step 1: Encrypt NPcommID
     std::array<u8, 16> trophyIv{};
     std::array<u8, 16> trpKey;
@@ -18,8 +27,41 @@ static void DecryptEFSM(std::span<const u8, 16> trophyKey, std::span<const u8, 1
                      trophyIv.data(), trpKey.data(), trpKey.size(), false);
 
     // Step 2: Decrypt EFSM
-    aes::decrypt_cbc(ciphertext.data(), ciphertext.size(), trpKey.data(), trpKey.size(),
-                     const_cast<u8*>(efsmIv.data()), decrypted.data(), decrypted.size(), nullptr);
+    std::array<u8, 16> iv;
+    std::copy(efsmIv.begin(), efsmIv.end(), iv.begin());
+    aes::decrypt_cbc(ciphertext.data(), ciphertext.size(), trpKey.data(), trpKey.size(), iv.data(),
+                     decrypted.data(), decrypted.size(), nullptr);
+}
+
+static constexpr u32 TRP_STAMP_MAGIC = 0x53505254; // "TRPS"
+static constexpr u32 TRP_STAMP_VERSION = 1;
+static constexpr std::string_view TRP_STAMP_NAME = "trp.stamp";
+
+static TrpStamp MakeStamp(const TrpHeader& header) {
+    TrpStamp stamp{};
+    stamp.magic = TRP_STAMP_MAGIC;
+    stamp.version = TRP_STAMP_VERSION;
+    std::memcpy(stamp.digest.data(), header.digest, stamp.digest.size());
+    stamp.file_size = header.file_size;
+    stamp.entry_num = header.entry_num;
+    return stamp;
+}
+
+static bool StampMatches(const std::filesystem::path& outputPath, const TrpStamp& stamp) {
+    const Common::FS::IOFile file(outputPath / TRP_STAMP_NAME, Common::FS::FileAccessMode::Read);
+    TrpStamp existing{};
+    return file.ReadObject(existing) && existing == stamp;
+}
+
+// Standard file names are trophyXX.trp, returns -1 for anything else
+static int TrpFileIndex(const std::filesystem::path& path) {
+    const std::string name = path.filename().string();
+    int index = -1;
+    if (name.size() < 8 ||
+        std::from_chars(name.data() + 6, name.data() + 8, index).ec != std::errc{}) {
+        return -1;
+    }
+    return index;
 }
 
 TRP::TRP() = default;
@@ -42,65 +84,42 @@ static void hexToBytes(const char* hex, unsigned char* dst) {
     }
 }
 
-bool TRP::Extract(const std::filesystem::path& trophyPath, int index, std::string npCommId,
-                  const std::filesystem::path& outputPath, bool mergeBasePath) {
-    std::filesystem::path trophyDir = trophyPath / "sce_sys/trophy";
-    if (!std::filesystem::exists(trophyDir) && !mergeBasePath) {
-        LOG_WARNING(Common_Filesystem, "Trophy directory doesn't exist: {}", trophyDir.string());
-        return false;
-    }
-
-    // Collect all .trp files in the directory
+std::vector<std::filesystem::path> TRP::ListTrpFiles(const std::filesystem::path& trophyPath,
+                                                     bool mergeBasePath) {
+    const std::filesystem::path trophyDir = trophyPath / "sce_sys/trophy";
     std::vector<std::filesystem::path> trpFiles;
+    std::error_code ec;
+
     if (mergeBasePath &&
         (trophyPath.string().ends_with("-patch") || trophyPath.string().ends_with("-UPDATE"))) {
+        // The update's own files win, so the base game directory only fills the gaps
         std::map<int, std::filesystem::path> trophyFileMap;
-        std::filesystem::path trophyBaseDir;
-
-        if (std::filesystem::exists(trophyDir)) {
-            for (const auto& entry : std::filesystem::directory_iterator(trophyDir)) {
+        const auto collect = [&trophyFileMap, &ec](const std::filesystem::path& dir) {
+            for (const auto& entry : std::filesystem::directory_iterator(dir, ec)) {
                 if (entry.is_regular_file() && entry.path().extension() == ".trp") {
-                    // standard filename: trophyXX.trp
-                    int fileIndex = std::stoi(entry.path().filename().string().substr(6, 2));
-                    trophyFileMap.insert({fileIndex, entry.path()});
+                    if (const int fileIndex = TrpFileIndex(entry.path()); fileIndex >= 0) {
+                        trophyFileMap.try_emplace(fileIndex, entry.path());
+                    }
                 }
             }
-        }
+        };
 
-        if (trophyPath.string().ends_with("-patch")) {
-            trophyBaseDir = trophyPath.string().erase(trophyPath.string().length() - 6);
-        } else if (trophyPath.string().ends_with("-UPDATE")) {
-            trophyBaseDir = trophyPath.string().erase(trophyPath.string().length() - 7);
+        std::string trophyBaseDir = trophyPath.string();
+        if (trophyBaseDir.ends_with("-patch")) {
+            trophyBaseDir.erase(trophyBaseDir.length() - 6);
+        } else {
+            trophyBaseDir.erase(trophyBaseDir.length() - 7);
         }
 
-        trophyBaseDir = trophyBaseDir / "sce_sys/trophy";
-        if (std::filesystem::exists(trophyBaseDir)) {
-            for (const auto& entry : std::filesystem::directory_iterator(trophyBaseDir)) {
-                if (entry.is_regular_file() && entry.path().extension() == ".trp") {
-                    // standard filename: trophyXX.trp
-                    bool skip = false;
-                    int fileIndex = std::stoi(entry.path().filename().string().substr(6, 2));
-
-                    // file already mapped
-                    for (auto const& [key, value] : trophyFileMap) {
-                        if (key == fileIndex) {
-                            skip = true;
-                            break;
-                        }
-                    }
-
-                    if (!skip) {
-                        trophyFileMap.insert({fileIndex, entry.path()});
-                    }
-                }
-            }
-        }
+        collect(trophyDir);
+        collect(std::filesystem::path(trophyBaseDir) / "sce_sys/trophy");
 
+        trpFiles.reserve(trophyFileMap.size());
         for (auto const& [key, value] : trophyFileMap) {
             trpFiles.push_back(value);
         }
     } else {
-        for (const auto& entry : std::filesystem::directory_iterator(trophyDir)) {
+        for (const auto& entry : std::filesystem::directory_iterator(trophyDir, ec)) {
             if (entry.is_regular_file() && entry.path().extension() == ".trp") {
                 trpFiles.push_back(entry.path());
             }
@@ -110,8 +129,20 @@ bool TRP::Extract(const std::filesystem::path& trophyPath, int index, std::strin
         std::sort(trpFiles.begin(), trpFiles.end());
     }
 
+    return trpFiles;
+}
+
+bool TRP::Extract(const std::filesystem::path& trophyPath, int index, std::string npCommId,
+                  const std::filesystem::path& outputPath, bool mergeBasePath) {
+    std::filesystem::path trophyDir = trophyPath / "sce_sys/trophy";
+    if (!std::filesystem::exists(trophyDir) && !mergeBasePath) {
+        LOG_WARNING(Common_Filesystem, "Trophy directory doesn't exist: {}", trophyDir.string());
+        return false;
+    }
+
+    const std::vector<std::filesystem::path> trpFiles = ListTrpFiles(trophyPath, mergeBasePath);
     if (trpFiles.size() == 0) {
-        LOG_WARNING(Common_Filesystem, "No trophy file in game folder or base folder from ",
+        LOG_WARNING(Common_Filesystem, "No trophy file in game folder or base folder from {}",
                     trophyDir.string());
         return false;
     }
@@ -122,82 +153,94 @@ bool TRP::Extract(const std::filesystem::path& trophyPath, int index, std::strin
         return false;
     }
 
-    // Select the file at the given index
-    std::filesystem::path gameSysDir = trpFiles[index];
-    LOG_INFO(Common_Filesystem, "Using trophy file: {}", gameSysDir.filename().string());
-
-    const auto& user_key_vec =
-        KeyManager::GetInstance()->GetAllKeys().TrophyKeySet.ReleaseTrophyKey;
-
-    if (user_key_vec.size() != 16) {
-        LOG_INFO(Common_Filesystem, "Trophy decryption key is not specified");
-        return false;
-    }
+    return ExtractFile(trpFiles[index], npCommId, outputPath);
+}
 
-    std::array<u8, 16> user_key{};
-    std::copy(user_key_vec.begin(), user_key_vec.end(), user_key.begin());
+bool TRP::ExtractFile(const std::filesystem::path& trpFile, const std::string& npCommId,
+                      const std::filesystem::path& outputPath) {
+    LOG_INFO(Common_Filesystem, "Using trophy file: {}", trpFile.filename().string());
 
     bool success = true;
     int trpFileIndex = 0;
+    TrpHeader header;
 
     try {
-        const auto& it = gameSysDir;
+        const auto& it = trpFile;
         if (it.extension() != ".trp") {
             return false;
         }
-        Common::FS::IOFile file(it, Common::FS::FileAccessMode::Read);
+        const Common::FS::MappedFile file(it);
         if (!file.IsOpen()) {
             LOG_ERROR(Common_Filesystem, "Unable to open trophy file: {}", it.string());
             return false;
         }
+        const std::span<const u8> trp = file.Span();
 
-        TrpHeader header;
-        if (!file.Read(header)) {
+        if (trp.size() < sizeof(TrpHeader)) {
             LOG_ERROR(Common_Filesystem, "Failed to read TRP header from {}", it.string());
             return false;
         }
+        std::memcpy(&header, trp.data(), sizeof(TrpHeader));
 
         if (header.magic != TRP_MAGIC) {
             LOG_ERROR(Common_Filesystem, "Wrong trophy magic number in {}", it.string());
             return false;
         }
 
-        s64 seekPos = sizeof(TrpHeader);
-        // Create output directories
-        if (!std::filesystem::create_directories(outputPath / "Icons") ||
-            !std::filesystem::create_directories(outputPath / "Xml")) {
+        if (StampMatches(outputPath, MakeStamp(header))) {
+            LOG_DEBUG(Common_Filesystem, "Trophy files of {} are up to date", npCommId);
+            return true;
+        }
+
+        const auto trophy_key = KeyManager::GetInstance()->GetKeyTable().ReleaseTrophyKey;
+        if (!trophy_key) {
+            LOG_INFO(Common_Filesystem, "Trophy decryption key is not specified");
+            return false;
+        }
+        const std::array<u8, 16>& user_key = *trophy_key;
+
+        u64 seekPos = sizeof(TrpHeader);
+        // Create output directories, they exist already if an older file was extracted
+        std::error_code ec;
+        std::filesystem::create_directories(outputPath / "Icons", ec);
+        std::filesystem::create_directories(outputPath / "Xml", ec);
+        if (!std::filesystem::is_directory(outputPath / "Icons") ||
+            !std::filesystem::is_directory(outputPath / "Xml")) {
             LOG_ERROR(Common_Filesystem, "Failed to create output directories for {}", npCommId);
             return false;
         }
 
         // Process each entry in the TRP file
         for (int i = 0; i < header.entry_num; i++) {
-            if (!file.Seek(seekPos)) {
-                LOG_ERROR(Common_Filesystem, "Failed to seek to TRP entry offset");
+            if (seekPos + sizeof(TrpEntry) > trp.size()) {
+                LOG_ERROR(Common_Filesystem, "Failed to read TRP entry");
                 success = false;
                 break;
             }
-            seekPos += static_cast<s64>(header.entry_size);
 
             TrpEntry entry;
-            if (!file.Read(entry)) {
-                LOG_ERROR(Common_Filesystem, "Failed to read TRP entry");
+            std::memcpy(&entry, trp.data() + seekPos, sizeof(TrpEntry));
+            seekPos += header.entry_size;
+
+            if (entry.entry_pos > trp.size() || entry.entry_len > trp.size() - entry.entry_pos) {
+                LOG_ERROR(Common_Filesystem, "TRP entry {} is out of bounds", i);
                 success = false;
-                break;
+                continue;
             }
+            const std::span<const u8> data = trp.subspan(entry.entry_pos, entry.entry_len);
 
-            std::string_view name(entry.entry_name);
+            const std::string_view name(entry.entry_name,
+                                        strnlen(entry.entry_name, sizeof(entry.entry_name)));
 
             if (entry.flag == ENTRY_FLAG_PNG) {
-                if (!ProcessPngEntry(file, entry, outputPath, name)) {
+                if (!ProcessPngEntry(data, outputPath, name)) {
                     success = false;
                     // Continue with next entry
                 }
             } else if (entry.flag == ENTRY_FLAG_ENCRYPTED_XML) {
                 // Check if we have a valid NPCommID for decryption
                 if (npCommId.size() >= 12 && npCommId[0] == 'N' && npCommId[1] == 'P') {
-                    if (!ProcessEncryptedXmlEntry(file, entry, outputPath, name, user_key,
-                                                  npCommId)) {
+                    if (!ProcessEncryptedXmlEntry(data, outputPath, name, user_key, npCommId)) {
                         success = false;
                         // Continue with next entry
                     }
@@ -224,28 +267,24 @@ bool TRP::Extract(const std::filesystem::path& trophyPath, int index, std::strin
     if (success) {
         LOG_INFO(Common_Filesystem, "Successfully extracted {} trophy files for {}", trpFileIndex,
                  npCommId);
+        // Written last, so an interrupted extraction runs again next time
+        Common::FS::IOFile stampFile(outputPath / TRP_STAMP_NAME,
+                                     Common::FS::FileAccessMode::Write);
+        if (!stampFile.WriteObject(MakeStamp(header))) {
+            LOG_WARNING(Common_Filesystem, "Failed to write trophy stamp for {}", npCommId);
+        }
     }
 
     return success;
 }
 
-bool TRP::ProcessPngEntry(Common::FS::IOFile& file, const TrpEntry& entry,
-                          const std::filesystem::path& outputPath, std::string_view name) {
-    if (!file.Seek(entry.entry_pos)) {
-        LOG_ERROR(Common_Filesystem, "Failed to seek to PNG entry offset");
-        return false;
-    }
-
-    std::vector<u8> icon(entry.entry_len);
-    if (!file.Read(icon)) {
-        LOG_ERROR(Common_Filesystem, "Failed to read PNG data");
-        return false;
-    }
-
+bool TRP::ProcessPngEntry(std::span<const u8> data, const std::filesystem::path& outputPath,
+                          std::string_view name) {
+    // Written straight out of the mapping, no intermediate buffer
     auto outputFile = outputPath / "Icons" / name;
-    size_t written = Common::FS::IOFile::WriteBytes(outputFile, icon);
-    if (written != icon.size()) {
-        LOG_ERROR(Common_Filesystem, "PNG write failed: wanted {} bytes, wrote {}", icon.size(),
+    size_t written = Common::FS::IOFile::WriteBytes(outputFile, data);
+    if (written != data.size()) {
+        LOG_ERROR(Common_Filesystem, "PNG write failed: wanted {} bytes, wrote {}", data.size(),
                   written);
         return false;
     }
@@ -253,43 +292,24 @@ bool TRP::ProcessPngEntry(Common::FS::IOFile& file, const TrpEntry& entry,
     return true;
 }
 
-bool TRP::ProcessEncryptedXmlEntry(Common::FS::IOFile& file, const TrpEntry& entry,
+bool TRP::ProcessEncryptedXmlEntry(std::span<const u8> data,
                                    const std::filesystem::path& outputPath, std::string_view name,
                                    const std::array<u8, 16>& user_key,
                                    const std::string& npCommId) {
     constexpr size_t IV_LEN = 16;
 
-    if (!file.Seek(entry.entry_pos)) {
-        LOG_ERROR(Common_Filesystem, "Failed to seek to encrypted XML entry offset");
-        return false;
-    }
-
-    std::array<u8, IV_LEN> esfmIv;
-    if (!file.Read(esfmIv)) {
-        LOG_ERROR(Common_Filesystem, "Failed to read IV for encrypted XML");
-        return false;
-    }
-
-    if (entry.entry_len <= IV_LEN) {
+    if (data.size() <= IV_LEN) {
         LOG_ERROR(Common_Filesystem, "Encrypted XML entry too small");
         return false;
     }
 
-    // Skip to the encrypted data (after IV)
-    if (!file.Seek(entry.entry_pos + IV_LEN)) {
-        LOG_ERROR(Common_Filesystem, "Failed to seek to encrypted data");
-        return false;
-    }
-
-    std::vector<u8> ESFM(entry.entry_len - IV_LEN);
-    std::vector<u8> XML(entry.entry_len - IV_LEN);
+    std::array<u8, IV_LEN> esfmIv;
+    std::memcpy(esfmIv.data(), data.data(), IV_LEN);
 
-    if (!file.Read(ESFM)) {
-        LOG_ERROR(Common_Filesystem, "Failed to read encrypted XML data");
-        return false;
-    }
+    // The encrypted data follows the IV
+    const std::span<const u8> ESFM = data.subspan(IV_LEN);
+    std::vector<u8> XML(ESFM.size());
 
-    // Decrypt the data - FIX: Don't check return value since DecryptEFSM returns void
     std::span<const u8, 16> key_span(user_key);
 
     // Convert npCommId string to span (pad or truncate to 16 bytes)
@@ -304,7 +324,7 @@ bool TRP::ProcessEncryptedXmlEntry(Common::FS::IOFile& file, const TrpEntry& ent
     removePadding(XML);
 
     // Create output filename (replace ESFM with XML)
-    std::string xml_name(entry.entry_name);
+    std::string xml_name(name);
     size_t pos = xml_name.find("ESFM");
     if (pos != std::string::npos) {
         xml_name.replace(pos, 4, "XML");
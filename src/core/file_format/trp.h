@@ -3,6 +3,10 @@
 
 #pragma once
 
+#include <array>
+#include <filesystem>
+#include <span>
+#include <string_view>
 #include <vector>
 #include "common/endian.h"
 #include "common/io_file.h"
@@ -32,19 +36,40 @@ struct TrpEntry {
     unsigned char padding[12];
 };
 
+// Written next to the extracted files. Identifies the .trp file they came from by the SHA-1
+// digest in its header, so an unchanged file is not extracted again.
+struct TrpStamp {
+    u32 magic;
+    u32 version;
+    std::array<u8, 20> digest;
+    u64 file_size;
+    u32 entry_num;
+
+    bool operator==(const TrpStamp&) const = default;
+};
+
 class TRP {
 public:
     TRP();
     ~TRP();
+
+    // Returns the .trp files of a game, ordered by trophy index. With mergeBasePath, an update
+    // falls back to the files of its base game for the indices it does not provide.
+    static std::vector<std::filesystem::path> ListTrpFiles(const std::filesystem::path& trophyPath,
+                                                           bool mergeBasePath = false);
+
     bool Extract(const std::filesystem::path& trophyPath, int index, std::string npCommId,
                  const std::filesystem::path& outputPath, bool mergeBasePath = false);
+    // Extracts a single .trp file. Does nothing if outputPath holds a stamp of the same file.
+    bool ExtractFile(const std::filesystem::path& trpFile, const std::string& npCommId,
+                     const std::filesystem::path& outputPath);
 
 private:
-    bool ProcessPngEntry(Common::FS::IOFile& file, const TrpEntry& entry,
-                         const std::filesystem::path& outputPath, std::string_view name);
-    bool ProcessEncryptedXmlEntry(Common::FS::IOFile& file, const TrpEntry& entry,
-                                  const std::filesystem::path& outputPath, std::string_view name,
-                                  const std::array<u8, 16>& user_key, const std::string& npCommId);
+    bool ProcessPngEntry(std::span<const u8> data, const std::filesystem::path& outputPath,
+                         std::string_view name);
+    bool ProcessEncryptedXmlEntry(std::span<const u8> data, const std::filesystem::path& outputPath,
+                                  std::string_view name, const std::array<u8, 16>& user_key,
+                                  const std::string& npCommId);
 
     std::array<u8, 16> esfmIv{};
     static constexpr int iv_len = 16;
@@ -5,10 +5,15 @@
 
 #include <filesystem>
 #include <string>
+#include <string_view>
 #include <vector>
 #include <QString>
 
+#include "common/dir_listing.h"
+#include "common/mapped_file.h"
+#include "common/string_pool.h"
 #include "common/types.h"
+#include "core/file_format/npbind.h"
 #include "core/file_format/psf.h"
 
 struct GameInfo {
@@ -20,14 +25,13 @@ struct GameInfo {
 
     std::string name;
     std::string serial;
-    std::string app_ver;
-    std::string region;
-    std::string fw;
+    // Values shared by many games are interned, every copy points at the same pooled string
+    Common::InternedString app_ver;
+    Common::InternedString region;
+    Common::InternedString fw;
     std::string save_dir;
-    std::string category;
-    std::string sdk_ver;
-    std::vector<std::string>
-        np_comm_ids; // normally there is only one np_comm_id, but found games with multiple ids
+    Common::InternedString category;
+    Common::InternedString sdk_ver;
 
     u64 size_on_disk = UINT64_MAX;
 };
@@ -50,19 +54,35 @@ static QString GetRegion(char region) {
     }
 }
 
-static void SceUpdateChecker(const std::string sceItem, std::string& gameItem,
-                             std::filesystem::path& update_folder,
-                             std::filesystem::path& patch_folder, std::string& game_folder) {
+/// Each sce_sys directory an asset may come from, listed once so that resolving several assets
+/// does not cost an exists() round-trip per candidate.
+struct SceSysListings {
+    std::filesystem::path update_folder;
+    std::filesystem::path patch_folder;
+    std::filesystem::path game_folder;
+    Common::FS::DirectoryListing update;
+    Common::FS::DirectoryListing patch;
+    Common::FS::DirectoryListing game;
+
+    explicit SceSysListings(const std::filesystem::path& game_path)
+        : update_folder(std::filesystem::path(game_path) += "-UPDATE"),
+          patch_folder(std::filesystem::path(game_path) += "-patch"), game_folder(game_path),
+          update(update_folder / "sce_sys"), patch(patch_folder / "sce_sys"),
+          game(game_folder / "sce_sys") {}
+};
 
-    std::filesystem::path game_folder_path = game_folder;
+static void SceUpdateChecker(std::string_view sceItem, std::string& gameItem,
+                             const SceSysListings& listings) {
     std::filesystem::path gameItemPath;
 
-    if (std::filesystem::exists(update_folder / "sce_sys" / sceItem)) {
-        gameItemPath = update_folder / "sce_sys" / sceItem;
-    } else if (std::filesystem::exists(patch_folder / "sce_sys" / sceItem)) {
-        gameItemPath = patch_folder / "sce_sys" / sceItem;
+    if (const std::string* name = listings.update.Find(sceItem)) {
+        gameItemPath = listings.update_folder / "sce_sys" / *name;
+    } else if (const std::string* name = listings.patch.Find(sceItem)) {
+        gameItemPath = listings.patch_folder / "sce_sys" / *name;
+    } else if (const std::string* name = listings.game.Find(sceItem)) {
+        gameItemPath = listings.game_folder / "sce_sys" / *name;
     } else {
-        gameItemPath = game_folder_path / "sce_sys" / sceItem;
+        gameItemPath = listings.game_folder / "sce_sys" / sceItem;
     }
 
     gameItem = gameItemPath.string();
@@ -72,17 +92,14 @@ static GameInfo readGameInfo(const std::filesystem::path& filePath) {
     GameInfo game;
     game.path = filePath.string();
     std::string param_sfo_path;
-    std::filesystem::path game_update_path = filePath;
-    game_update_path += "-UPDATE";
-    std::filesystem::path game_patch_path = filePath;
-    game_patch_path += "-patch";
-    SceUpdateChecker("param.sfo", param_sfo_path, game_update_path, game_patch_path, game.path);
+    const SceSysListings listings(filePath);
+    SceUpdateChecker("param.sfo", param_sfo_path, listings);
 
     PSF psf;
     if (psf.Open(param_sfo_path)) {
-        SceUpdateChecker("icon0.png", game.icon_path, game_update_path, game_patch_path, game.path);
-        SceUpdateChecker("pic1.png", game.pic_path, game_update_path, game_patch_path, game.path);
-        SceUpdateChecker("snd0.at9", game.snd0_path, game_update_path, game_patch_path, game.path);
+        SceUpdateChecker("icon0.png", game.icon_path, listings);
+        SceUpdateChecker("pic1.png", game.pic_path, listings);
+        SceUpdateChecker("snd0.at9", game.snd0_path, listings);
 
         if (const auto title = psf.GetString("TITLE"); title.has_value()) {
             game.name = *title;
@@ -122,4 +139,25 @@ static GameInfo readGameInfo(const std::filesystem::path& filePath) {
     return game;
 }
 
+/// Reads the NP communication ids of a game from npbind.dat, preferring the update's copy.
+/// Normally there is only one id, but some games carry several. They are only needed by the
+/// trophy viewer and exports, so they are read on demand instead of being kept per game.
+static std::vector<std::string> ReadNpCommIds(const GameInfo& game) {
+    const std::filesystem::path game_folder =
+        game.update_path.empty() ? game.path : game.update_path;
+
+    std::vector<std::string> np_comm_ids;
+    const Common::FS::MappedFile npbind_file(game_folder / "sce_sys" / "npbind.dat");
+    NPBindView npbind;
+    if (!npbind_file.IsOpen() || !npbind.Open(npbind_file.Span())) {
+        return np_comm_ids;
+    }
+    for (size_t i = 0; i < npbind.Bodies().size(); ++i) {
+        if (const std::string_view np_comm_id = npbind.NpCommId(i); !np_comm_id.empty()) {
+            np_comm_ids.emplace_back(np_comm_id);
+        }
+    }
+    return np_comm_ids;
+}
+
 } // namespace GameInfoTools
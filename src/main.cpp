@@ -1,6 +1,7 @@
 // SPDX-FileCopyrightText: Copyright 2025-2026 shadLauncher4 Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <cstdlib>
 #include <iostream>
 #include <QApplication>
 #include <QMessageBox>
@@ -8,6 +9,7 @@
 #include "common/logging/backend.h"
 #include "common/logging/log.h"
 #include "qt_ui/gui_application.h"
+#include "qt_ui/library_benchmark.h"
 #include "qt_ui/stylesheets.h"
 
 int main(int argc, char* argv[]) {
@@ -20,6 +22,19 @@ int main(int argc, char* argv[]) {
     QString emulator_arg = "";
     QString game_arg = "";
 
+    // Library sizes of the benchmark options, anything but a number in range is rejected
+    const auto parse_library_size = [](const QString& text, const char* usage) {
+        bool ok = false;
+        const int size = text.toInt(&ok);
+        if (!ok || size < 1 || size > LibraryBenchmark::max_size) {
+            std::cerr << "Error: Invalid library size '" << text.toStdString()
+                      << "', expected 1 to " << LibraryBenchmark::max_size << "\nUsage: " << usage
+                      << "\n";
+            exit(1);
+        }
+        return size;
+    };
+
     // Map of argument strings to lambda functions
     std::unordered_map<std::string, std::function<void(int&)>> arg_map = {
         {"-h",
@@ -33,6 +48,11 @@ int main(int argc, char* argv[]) {
                  "  -g, --game <ID|path>          Specify game to launch.\n"
                  "  -d                            Alias for '-e default'.\n"
                  "  -h, --help                    Display this help message.\n"
+                 "  --generate-library <dir> <count>\n"
+                 "                                Write a synthetic game library for testing.\n"
+                 "  --benchmark-library <dir> [sizes]\n"
+                 "                                Time game list refreshes of synthetic libraries "
+                 "of the given comma separated sizes (default 1000,10000,50000).\n"
                  " -- ...                         Parameters passed to the emulator core.";
              QMessageBox::information(nullptr, "tr(shadLauncher4 command line options)", helpMsg);
              exit(0);
@@ -60,6 +80,34 @@ int main(int argc, char* argv[]) {
          }},
         {"--emulator", [&](int& i) { arg_map["-e"](i); }},
         {"-d", [&](int&) { emulator_arg = "default"; }},
+        {"--generate-library",
+         [&](int& i) {
+             if (i + 2 >= argc) {
+                 std::cerr << "Error: Missing arguments for --generate-library\n";
+                 exit(1);
+             }
+             const std::filesystem::path dir = argv[i + 1];
+             const int count = parse_library_size(QString(argv[i + 2]),
+                                                  "--generate-library <dir> <count>");
+             exit(LibraryBenchmark::GenerateLibrary(dir, count) ? 0 : 1);
+         }},
+        {"--benchmark-library",
+         [&](int& i) {
+             if (i + 1 >= argc) {
+                 std::cerr << "Error: Missing argument for --benchmark-library\n";
+                 exit(1);
+             }
+             const std::filesystem::path dir = argv[i + 1];
+             std::vector<int> sizes = LibraryBenchmark::default_sizes;
+             if (i + 2 < argc) {
+                 sizes.clear();
+                 for (const QString& size : QString(argv[i + 2]).split(',')) {
+                     sizes.push_back(
+                         parse_library_size(size, "--benchmark-library <dir> [sizes]"));
+                 }
+             }
+             exit(LibraryBenchmark::Run(dir, sizes));
+         }},
     };
 
     // Parse command-line arguments using the map
@@ -0,0 +1,145 @@
+// SPDX-FileCopyrightText: Copyright 2025-2026 shadLauncher4 Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <QCoreApplication>
+#include <QMetaObject>
+#include <QPointer>
+
+#include "background_art_loader.h"
+
+BackgroundArtLoader::BackgroundArtLoader(int neighbours, QObject* parent)
+    : QObject(parent), m_neighbours(std::max(neighbours, 0)) {
+    SetMaxSize({1920, 1080});
+}
+
+BackgroundArtLoader::~BackgroundArtLoader() {
+    CancelAll();
+}
+
+void BackgroundArtLoader::SetMaxSize(const QSize& size) {
+    if (size.isEmpty() || size == m_max_size) {
+        return;
+    }
+    m_max_size = size;
+
+    // 4 bytes per pixel, one more image than the window so stepping back is free as well
+    const u64 image_bytes = static_cast<u64>(size.width()) * static_cast<u64>(size.height()) * 4;
+    const u64 images = static_cast<u64>(2 * m_neighbours + 2);
+    m_budget = std::clamp(image_bytes * images, min_budget, max_budget);
+
+    m_lru.clear();
+    m_entries.clear();
+    m_used = 0;
+}
+
+void BackgroundArtLoader::Request(const std::string& path,
+                                  const std::vector<std::string>& neighbours) {
+    m_current = path;
+
+    // Drop the loads that are neither the selection nor next to it anymore
+    for (auto it = m_loads.begin(); it != m_loads.end();) {
+        if (it->first == path ||
+            std::find(neighbours.begin(), neighbours.end(), it->first) != neighbours.end()) {
+            ++it;
+            continue;
+        }
+        it->second.cancel->store(true);
+        IconDecodePool::Instance().Cancel(it->second.task);
+        it = m_loads.erase(it);
+    }
+
+    if (path.empty()) {
+        Q_EMIT ArtReady({});
+    } else if (const QImage* image = Find(path)) {
+        Q_EMIT ArtReady(*image);
+    } else if (const auto it = m_loads.find(path); it != m_loads.end()) {
+        IconDecodePool::Instance().Promote(it->second.task, IconDecodePool::Priority::Visible);
+    } else {
+        Submit(path, IconDecodePool::Priority::Visible);
+    }
+
+    for (const std::string& neighbour : neighbours) {
+        if (!neighbour.empty() && !m_entries.contains(neighbour) && !m_loads.contains(neighbour)) {
+            Submit(neighbour, IconDecodePool::Priority::NearViewport);
+        }
+    }
+}
+
+void BackgroundArtLoader::CancelAll() {
+    for (auto& [path, load] : m_loads) {
+        load.cancel->store(true);
+        IconDecodePool::Instance().Cancel(load.task);
+    }
+    m_loads.clear();
+    m_current.clear();
+}
+
+void BackgroundArtLoader::Submit(const std::string& path, IconDecodePool::Priority priority) {
+    auto cancel = std::make_shared<std::atomic<bool>>(false);
+    const QSize max_size = m_max_size;
+    auto work = [path, max_size, cancel, receiver = QPointer<BackgroundArtLoader>(this)] {
+        QImage image(QString::fromStdString(path));
+        if (cancel->load()) {
+            return;
+        }
+        if (!image.isNull()) {
+            // Painting only ever scales the art down to the view, so larger pixels are wasted
+            if (image.width() > max_size.width() && image.height() > max_size.height()) {
+                image = image.scaled(max_size, Qt::KeepAspectRatioByExpanding,
+                                     Qt::SmoothTransformation);
+            }
+            image = image.convertToFormat(image.hasAlphaChannel()
+                                              ? QImage::Format_ARGB32_Premultiplied
+                                              : QImage::Format_RGB32);
+        }
+        // The loader may be gone by now, so only the GUI thread looks at it
+        QMetaObject::invokeMethod(
+            QCoreApplication::instance(),
+            [path, image, cancel, receiver] {
+                if (receiver && !cancel->load()) {
+                    receiver->OnLoaded(path, image);
+                }
+            },
+            Qt::QueuedConnection);
+    };
+    auto task = IconDecodePool::Instance().Submit(priority, std::move(work), cancel);
+    m_loads.insert_or_assign(path, Load{std::move(task), std::move(cancel)});
+}
+
+void BackgroundArtLoader::OnLoaded(const std::string& path, const QImage& image) {
+    m_loads.erase(path);
+    Store(path, image);
+    if (path == m_current) {
+        Q_EMIT ArtReady(image);
+    }
+}
+
+const QImage* BackgroundArtLoader::Find(const std::string& path) {
+    const auto it = m_entries.find(path);
+    if (it == m_entries.end()) {
+        return nullptr;
+    }
+    m_lru.splice(m_lru.begin(), m_lru, it->second);
+    return &it->second->image;
+}
+
+void BackgroundArtLoader::Store(const std::string& path, const QImage& image) {
+    if (const auto it = m_entries.find(path); it != m_entries.end()) {
+        m_used -= static_cast<u64>(it->second->image.sizeInBytes());
+        m_lru.erase(it->second);
+        m_entries.erase(it);
+    }
+
+    // Games without art are remembered too, so they are not looked up again
+    m_lru.push_front(Entry{path, image});
+    m_entries.emplace(path, m_lru.begin());
+    m_used += static_cast<u64>(image.sizeInBytes());
+
+    // Keep the newest entry even if it exceeds the budget on its own
+    while (m_used > m_budget && m_lru.size() > 1) {
+        m_used -= static_cast<u64>(m_lru.back().image.sizeInBytes());
+        m_entries.erase(m_lru.back().path);
+        m_lru.pop_back();
+    }
+}
@@ -0,0 +1,82 @@
+// SPDX-FileCopyrightText: Copyright 2025-2026 shadLauncher4 Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <atomic>
+#include <list>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <QImage>
+#include <QObject>
+#include <QSize>
+
+#include "common/types.h"
+#include "icon_decode_pool.h"
+
+/**
+ * Loads the background art (PIC1.PNG) of the selected game off the GUI thread.
+ *
+ * Images are decoded on the icon decode pool, downscaled to the screen size and kept in a small
+ * byte bounded cache, together with the art of the games next to the selection. Moving the
+ * selection by a few entries then shows art that is ready already. Loads of art that is neither
+ * selected nor next to the selection anymore are dropped before they start.
+ */
+class BackgroundArtLoader : public QObject {
+    Q_OBJECT
+
+public:
+    static constexpr u64 min_budget = 64_MB;
+    static constexpr u64 max_budget = 512_MB;
+
+    /** Neighbours is how many games on each side of the selection are passed to Request */
+    explicit BackgroundArtLoader(int neighbours, QObject* parent = nullptr);
+    ~BackgroundArtLoader() override;
+
+    /**
+     * Art is downscaled to cover this size, usually the screen size in device pixels. The cache is
+     * sized to hold the selection, its neighbours and the art scrolled away last at this size.
+     */
+    void SetMaxSize(const QSize& size);
+
+    /**
+     * Shows the art at path. Emits ArtReady right away if it is cached, otherwise once it is
+     * loaded. The art of neighbours is loaded into the cache with a lower priority.
+     */
+    void Request(const std::string& path, const std::vector<std::string>& neighbours);
+
+    /** Drops all queued loads and forgets the selection, for example when the list is cleared */
+    void CancelAll();
+
+Q_SIGNALS:
+    /** The art of the selection, null if it could not be loaded */
+    void ArtReady(const QImage& image);
+
+private:
+    struct Load {
+        std::shared_ptr<IconDecodePool::Task> task;
+        std::shared_ptr<std::atomic<bool>> cancel;
+    };
+    struct Entry {
+        std::string path;
+        QImage image;
+    };
+    using EntryList = std::list<Entry>;
+
+    void Submit(const std::string& path, IconDecodePool::Priority priority);
+    void OnLoaded(const std::string& path, const QImage& image);
+    const QImage* Find(const std::string& path);
+    void Store(const std::string& path, const QImage& image);
+
+    // Everything below is only touched on the GUI thread, workers post their results back
+    std::string m_current;
+    std::unordered_map<std::string, Load> m_loads;
+    EntryList m_lru; // Most recently used first
+    std::unordered_map<std::string, EntryList::iterator> m_entries;
+    const int m_neighbours;
+    QSize m_max_size;
+    u64 m_budget = min_budget;
+    u64 m_used = 0;
+};
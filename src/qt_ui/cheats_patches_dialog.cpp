@@ -26,12 +26,15 @@
 #include <QTextEdit>
 #include <QVBoxLayout>
 #include <QXmlStreamReader>
+#include <QtConcurrent>
 
 #include "cheats_patches_dialog.h"
 #include "cheats_patches_repository_config.h"
 #include "common/memory_patcher.h"
 #include "common/path_util.h"
 #include "core/emulator_state.h"
+#include "patch_repository_index.h"
+#include "patch_repository_sync.h"
 #include "ui_cheats_patches_dialog.h"
 
 CheatsPatches::CheatsPatches(std::shared_ptr<GUISettings> gui_settings,
@@ -337,6 +340,9 @@ void CheatsPatches::onSaveButtonClicked() {
     textStream << newXmlData;
     file.close();
 
+    // Compile the enabled patches now rather than when the game is launched
+    (void)QtConcurrent::run(&MemoryPatcher::UpdatePatchIndex);
+
     if (xmlReader.hasError()) {
         QMessageBox::critical(this, tr("Error"),
                               tr("Failed to parse XML: ") + "\n" + xmlReader.errorString());
@@ -383,8 +389,11 @@ void CheatsPatches::downloadCheats(const QString& source, const QString& gameSer
 
     connect(m_downloader, &Downloader::SignalDownloadFinished, this,
             [this, source, cheatsBaseUrl, gameSerial, gameVersion,
-             showMessageBox](const QByteArray& data) {
-                const QString textContent = QString::fromUtf8(data);
+             showMessageBox](const QString& path) {
+                QFile indexFile(path);
+                const QString textContent = indexFile.open(QIODevice::ReadOnly)
+                                                ? QString::fromUtf8(indexFile.readAll())
+                                                : QString();
                 QRegularExpression regex(
                     QString("%1_%2[^=]*\\.json").arg(gameSerial).arg(gameVersion));
 
@@ -405,7 +414,7 @@ void CheatsPatches::downloadCheats(const QString& source, const QString& gameSer
                     auto* fileDl = new Downloader(m_gui_settings, std::nullopt, std::nullopt, this);
 
                     connect(fileDl, &Downloader::SignalDownloadFinished, this,
-                            [this, fileDl](const QByteArray&) {
+                            [this, fileDl](const QString&) {
                                 fileDl->deleteLater();
                                 populateFileListCheats();
                             });
@@ -458,30 +467,20 @@ void CheatsPatches::populateFileListPatches() {
 
     foreach (const QString& folder, folders) {
         QString folderPath = dir.filePath(folder);
-        QDir subDir(folderPath);
-
-        QString filesJsonPath = subDir.filePath("files.json");
-        QFile file(filesJsonPath);
-
-        if (file.open(QIODevice::ReadOnly)) {
-            QByteArray fileData = file.readAll();
-            file.close();
 
-            QJsonDocument jsonDoc(QJsonDocument::fromJson(fileData));
-            QJsonObject jsonObj = jsonDoc.object();
-
-            for (auto it = jsonObj.constBegin(); it != jsonObj.constEnd(); ++it) {
-                QString fileName = it.key();
-                QJsonArray serials = it.value().toArray();
+        // Only folders with a files.json are repositories
+        if (!QFile::exists(QDir(folderPath).filePath("files.json"))) {
+            continue;
+        }
 
-                if (serials.contains(QJsonValue(m_gameSerial))) {
-                    QString fileEntry = fileName + " | " + folder;
-                    if (!matchingFiles.contains(fileEntry)) {
-                        if (folder == "shadPS4") {
-                            shadPS4entry = fileEntry;
-                        }
-                        matchingFiles << fileEntry;
+        for (const auto& file : PatchRepositoryIndex::Update(folderPath).files) {
+            if (file.title_ids.contains(m_gameSerial)) {
+                QString fileEntry = file.name + " | " + folder;
+                if (!matchingFiles.contains(fileEntry)) {
+                    if (folder == "shadPS4") {
+                        shadPS4entry = fileEntry;
                     }
+                    matchingFiles << fileEntry;
                 }
             }
         }
@@ -536,38 +535,44 @@ void CheatsPatches::downloadPatches(const QString repository, const bool showMes
     auto* dl = new Downloader(m_gui_settings, std::nullopt, std::nullopt, this);
 
     connect(dl, &Downloader::SignalDownloadFinished, this,
-            [this, repository, dl, showMessageBox](const QByteArray& data) {
-                const QJsonArray items = QJsonDocument::fromJson(data).array();
+            [this, repository, dl, showMessageBox](const QString& path) {
+                QFile apiFile(path);
+                const QJsonArray items =
+                    apiFile.open(QIODevice::ReadOnly)
+                        ? QJsonDocument::fromJson(apiFile.readAll()).array()
+                        : QJsonArray();
+                dl->deleteLater();
 
                 QDir patchesDir(Common::FS::GetUserPath(Common::FS::PathType::PatchesDir));
                 patchesDir.mkpath(repository);
-                patchesDir.cd(repository);
-
-                for (const auto& v : items) {
-                    const QJsonObject o = v.toObject();
-                    const QString name = o["name"].toString();
-                    const QString downloadUrl = o["download_url"].toString();
 
-                    if (!name.endsWith(".xml"))
-                        continue;
-
-                    auto* fileDl = new Downloader(m_gui_settings, std::nullopt, std::nullopt, this);
+                const QString repositoryDir = patchesDir.filePath(repository);
+                auto* sync = new PatchRepositorySync(repositoryDir, this);
 
-                    fileDl->DownloadJSONWithCache(downloadUrl.toStdString(),
-                                                  patchesDir.filePath(name), false, QString(), 0);
+                connect(sync, &PatchRepositorySync::Finished, this,
+                        [this, repository, repositoryDir, sync, showMessageBox](bool changed,
+                                                                                int) {
+                            sync->deleteLater();
+                            // Only a changed repository needs its title IDs collected again
+                            if (changed || !QDir(repositoryDir).exists("files.json")) {
+                                createFilesJson(repository);
+                            }
 
-                    connect(fileDl, &Downloader::SignalDownloadFinished, fileDl,
-                            &QObject::deleteLater);
-                }
+                            if (showMessageBox)
+                                QMessageBox::information(this, tr("Download Complete"),
+                                                         DownloadComplete_MSG);
 
-                if (showMessageBox)
-                    QMessageBox::information(this, tr("Download Complete"), DownloadComplete_MSG);
+                            populateFileListPatches();
+                            compatibleVersionNotice(repository);
+                        });
 
-                createFilesJson(repository);
-                populateFileListPatches();
-                compatibleVersionNotice(repository);
+                connect(sync, &PatchRepositorySync::Failed, this,
+                        [this, sync](const QString& err) {
+                            QMessageBox::warning(this, tr("Download Error"), err);
+                            sync->deleteLater();
+                        });
 
-                dl->deleteLater();
+                sync->Start(items);
             });
 
     connect(dl, &Downloader::SignalDownloadError, this, [this, dl](const QString& err) {
@@ -583,51 +588,19 @@ void CheatsPatches::downloadPatches(const QString repository, const bool showMes
 
 void CheatsPatches::compatibleVersionNotice(const QString repository) {
     QDir patchesDir(Common::FS::GetUserPath(Common::FS::PathType::PatchesDir));
-    QDir dir = patchesDir.filePath(repository);
+    const auto index = PatchRepositoryIndex::Update(patchesDir.filePath(repository));
+    for (const QString& error : index.errors) {
+        QMessageBox::warning(this, tr("Error"), error);
+    }
 
-    QStringList xmlFiles = dir.entryList(QStringList() << "*.xml", QDir::Files);
     QStringList incompatMessages;
 
-    foreach (const QString& xmlFile, xmlFiles) {
-        QFile file(dir.filePath(xmlFile));
-        if (!file.open(QIODevice::ReadOnly | QIODevice::Text)) {
-            QMessageBox::warning(this, tr("Error"),
-                                 QString(tr("Failed to open file:") + "\n%1").arg(xmlFile));
-            continue;
-        }
-
-        QXmlStreamReader xmlReader(&file);
-        QSet<QString> appVersionsSet;
-        bool foundMatchingID = false;
-
-        while (!xmlReader.atEnd() && !xmlReader.hasError()) {
-            QXmlStreamReader::TokenType token = xmlReader.readNext();
-            if (token == QXmlStreamReader::StartElement) {
-                if (xmlReader.name() == QStringLiteral("ID")) {
-                    QString id = xmlReader.readElementText();
-                    if (id == m_gameSerial) {
-                        foundMatchingID = true;
-                    }
-                } else if (xmlReader.name() == QStringLiteral("Metadata")) {
-                    if (foundMatchingID) {
-                        QString appVer = xmlReader.attributes().value("AppVer").toString();
-                        if (!appVer.isEmpty()) {
-                            appVersionsSet.insert(appVer);
-                        }
-                    }
-                }
-            }
-        }
-
-        if (xmlReader.hasError()) {
-            QMessageBox::warning(this, tr("Error"),
-                                 QString(tr("XML ERROR:") + "\n%1").arg(xmlReader.errorString()));
-        }
-
-        if (!foundMatchingID) {
+    for (const auto& file : index.files) {
+        if (!file.title_ids.contains(m_gameSerial)) {
             continue;
         }
 
+        const QStringList& appVersionsSet = file.app_versions;
         for (const QString& appVer : appVersionsSet) {
             if (appVer == QLatin1String("mask") || appVer == m_gameVersion) {
                 return;
@@ -655,53 +628,17 @@ void CheatsPatches::compatibleVersionNotice(const QString repository) {
 }
 
 void CheatsPatches::createFilesJson(const QString& repository) {
-
     QDir dir(Common::FS::GetUserPath(Common::FS::PathType::PatchesDir));
-    QString fullPath = dir.filePath(repository);
-    if (!dir.exists(fullPath)) {
-        dir.mkpath(fullPath);
-    }
-    dir.setPath(fullPath);
-
-    QJsonObject filesObject;
-    QStringList xmlFiles = dir.entryList(QStringList() << "*.xml", QDir::Files);
-
-    foreach (const QString& xmlFile, xmlFiles) {
-        QFile file(dir.filePath(xmlFile));
-        if (!file.open(QIODevice::ReadOnly | QIODevice::Text)) {
-            QMessageBox::warning(this, tr("Error"),
-                                 QString(tr("Failed to open file:") + "\n%1").arg(xmlFile));
-            continue;
-        }
-
-        QXmlStreamReader xmlReader(&file);
-        QJsonArray titleIdsArray;
 
-        while (!xmlReader.atEnd() && !xmlReader.hasError()) {
-            QXmlStreamReader::TokenType token = xmlReader.readNext();
-            if (token == QXmlStreamReader::StartElement) {
-                if (xmlReader.name() == QStringLiteral("ID")) {
-                    titleIdsArray.append(xmlReader.readElementText());
-                }
-            }
-        }
-
-        if (xmlReader.hasError()) {
-            QMessageBox::warning(this, tr("Error"),
-                                 QString(tr("XML ERROR:") + "\n%1").arg(xmlReader.errorString()));
-        }
-        filesObject[xmlFile] = titleIdsArray;
+    // Only files that changed since the last call are parsed again
+    const auto index = PatchRepositoryIndex::Update(dir.filePath(repository));
+    for (const QString& error : index.errors) {
+        QMessageBox::warning(this, tr("Error"), error);
     }
 
-    QFile jsonFile(dir.absolutePath() + "/files.json");
-    if (!jsonFile.open(QIODevice::WriteOnly)) {
-        QMessageBox::warning(this, tr("Error"), tr("Failed to open files.json for writing"));
-        return;
+    if (index.changed) {
+        (void)QtConcurrent::run(&MemoryPatcher::UpdatePatchIndex);
     }
-
-    QJsonDocument jsonDoc(filesObject);
-    jsonFile.write(jsonDoc.toJson());
-    jsonFile.close();
 }
 
 void CheatsPatches::clearListCheats() {
@@ -1,16 +1,81 @@
 ﻿// SPDX-FileCopyrightText: Copyright 2025-2026 shadLauncher4 Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
+#include <filesystem>
 #include <optional>
+#include <system_error>
+#include <utility>
 #include <QApplication>
 #include <QDebug>
 #include <QFile>
+#include <QFileInfo>
 #include <QNetworkRequest>
 #include <QTimer>
+#include "common/path_util.h"
 #include "downloader.h"
 #include "gui_settings.h"
 #include "progress_dialog.h"
 
+namespace {
+
+// The partial file is forced to disk this often, so a crash loses at most this much of it
+constexpr u64 sync_interval = 8_MB;
+
+// Identifies the version of the file a partial download belongs to
+QByteArray Validator(const QNetworkReply* reply) {
+    // If-Range only accepts a strong ETag
+    const QByteArray etag = reply->rawHeader("ETag");
+    if (!etag.isEmpty() && !etag.startsWith("W/")) {
+        return etag;
+    }
+    return reply->rawHeader("Last-Modified");
+}
+
+// Where a partial file came from, it may only be continued from the same version of the same file
+struct PartMeta {
+    QByteArray url;
+    qint64 total = -1; // Size of the whole file, -1 if the server did not send it
+    QByteArray validator;
+};
+
+// One line each for the URL, the total size and the validator
+std::optional<PartMeta> ReadMeta(const QString& path) {
+    QFile file(path);
+    if (!file.open(QIODevice::ReadOnly)) {
+        return std::nullopt;
+    }
+    const QList<QByteArray> lines = file.readAll().split('\n');
+    bool ok = false;
+    PartMeta meta;
+    if (lines.size() >= 3) {
+        meta.url = lines[0].trimmed();
+        meta.total = lines[1].trimmed().toLongLong(&ok);
+        meta.validator = lines[2].trimmed();
+    }
+    if (!ok || meta.url.isEmpty() || meta.validator.isEmpty()) {
+        return std::nullopt;
+    }
+    return meta;
+}
+
+void WriteMeta(const QString& path, const PartMeta& meta) {
+    QFile file(path);
+    if (file.open(QIODevice::WriteOnly)) {
+        file.write(meta.url + '\n' + QByteArray::number(meta.total) + '\n' + meta.validator);
+    }
+}
+
+// The size after the slash of Content-Range: bytes <first>-<last>/<size>, -1 if it is unknown
+qint64 ContentRangeTotal(const QByteArray& content_range) {
+    const qsizetype slash = content_range.lastIndexOf('/');
+    bool ok = false;
+    const qint64 total = slash < 0 ? -1 : content_range.mid(slash + 1).toLongLong(&ok);
+    return ok ? total : -1;
+}
+
+} // namespace
+
 Downloader::Downloader(std::shared_ptr<GUISettings> gui_settings, std::optional<GUISave> etag,
                        std::optional<GUISave> last_modified, QWidget* parent)
     : QObject(parent), m_manager(new QNetworkAccessManager(this)), m_parent(parent),
@@ -18,11 +83,7 @@ Downloader::Downloader(std::shared_ptr<GUISettings> gui_settings, std::optional<
       m_last_modified(std::move(last_modified)) {}
 
 Downloader::~Downloader() {
-    if (m_reply) {
-        m_reply->abort();
-        m_reply->deleteLater();
-        m_reply = nullptr;
-    }
+    AbortAll();
 
     if (m_progress_dialog) {
         m_progress_dialog->close();
@@ -33,19 +94,62 @@ Downloader::~Downloader() {
 void Downloader::DownloadJSONWithCache(const std::string& url, const QString& local_path,
                                        bool show_progress_dialog,
                                        const QString& progress_dialog_title, int delayMs) {
+    AbortAll();
     m_localPath = local_path;
-    m_data.clear();
+    m_partPath = local_path + ".part";
+    m_metaPath = local_path + ".part.meta";
+    m_url = QUrl(QString::fromStdString(url));
     m_abort = false;
+    m_resume_retried = false;
     m_closeDelayMs = delayMs;
 
-    QNetworkRequest request(QUrl(QString::fromStdString(url)));
+    // --- Begin the download, a partial file is always continued in one piece
+    const std::optional<PartMeta> meta = ReadMeta(m_metaPath);
+    if (m_parallel_chunks > 1 && (!meta || meta->url != m_url.toEncoded())) {
+        StartProbe();
+    } else {
+        StartSingle(true);
+    }
+
+    // --- Optional progress dialog
+    if (show_progress_dialog) {
+        const int maximum = 100;
+        if (!m_progress_dialog) {
+            m_progress_dialog = new ProgressDialog(progress_dialog_title, tr("Please wait..."),
+                                                   tr("Abort"), 0, maximum, true, m_parent);
+            m_progress_dialog->setAutoClose(true);
+            m_progress_dialog->setAutoReset(false);
+            m_progress_dialog->show();
+
+            connect(m_progress_dialog, &QProgressDialog::canceled, this, [this]() {
+                // The partial file is kept, so the next attempt continues where this one stopped
+                m_abort = true;
+                AbortAll();
+                m_progress_dialog = nullptr;
+                Q_EMIT SignalDownloadCanceled();
+            });
+
+            connect(m_progress_dialog, &QProgressDialog::finished, this,
+                    [this]() { m_progress_dialog = nullptr; });
+        } else {
+            m_progress_dialog->setWindowTitle(progress_dialog_title);
+            m_progress_dialog->SetRange(0, maximum);
+            m_progress_dialog->show();
+        }
+    }
+}
+
+void Downloader::SetParallelChunks(int count) {
+    m_parallel_chunks = std::max(count, 1);
+}
+
+QNetworkRequest Downloader::MakeRequest(const QUrl& url) const {
+    QNetworkRequest request(url);
     request.setAttribute(QNetworkRequest::RedirectPolicyAttribute,
                          QNetworkRequest::NoLessSafeRedirectPolicy);
 
-    const bool hasLocalCache = QFile::exists(local_path);
-
     // --- Add caching headers if optional values are provided
-    if (hasLocalCache) {
+    if (QFile::exists(m_localPath)) {
         if (m_etag && !m_etag->key.isEmpty()) {
             const QString etagValue = m_gui_settings->GetValue(*m_etag).toString();
             if (!etagValue.isEmpty())
@@ -58,166 +162,396 @@ void Downloader::DownloadJSONWithCache(const std::string& url, const QString& lo
                 request.setRawHeader("If-Modified-Since", lastModifiedValue.toUtf8());
         }
     } else {
-        qDebug() << "Downloader: No local cache, forcing full download for" << local_path;
+        qDebug() << "Downloader: No local cache, forcing full download for" << m_localPath;
+    }
+    return request;
+}
+
+void Downloader::StartSingle(bool allow_resume) {
+    QNetworkRequest request = MakeRequest(m_url);
+
+    m_resume_offset = 0;
+    m_resume_total = -1;
+    const std::optional<PartMeta> meta =
+        allow_resume ? ReadMeta(m_metaPath) : std::optional<PartMeta>{};
+    const qint64 part_size = QFileInfo(m_partPath).size();
+    // A partial file of another URL, for example an older release fetched to the same path, or one
+    // longer than the whole file can not be continued
+    if (meta && meta->url == m_url.toEncoded() && part_size > 0 &&
+        (meta->total < 0 || part_size < meta->total)) {
+        // The server answers with the whole file instead if it changed since the partial one
+        m_resume_offset = part_size;
+        m_resume_total = meta->total;
+        request.setRawHeader("Range", "bytes=" + QByteArray::number(part_size) + "-");
+        request.setRawHeader("If-Range", meta->validator);
+        request.setRawHeader("Accept-Encoding", "identity");
+        qDebug() << "Downloader: Resuming" << m_localPath << "at" << part_size;
+    } else {
+        RemovePart();
     }
 
-    // --- Begin the download
     m_reply = m_manager->get(request);
     m_reply->setParent(this);
 
     // --- Connect download signals
+    connect(m_reply, &QNetworkReply::metaDataChanged, this, &Downloader::OnMetaDataChanged);
     connect(m_reply, &QNetworkReply::readyRead, this, &Downloader::OnReadyRead);
     connect(m_reply, &QNetworkReply::downloadProgress, this, &Downloader::OnDownloadProgress);
     connect(m_reply, &QNetworkReply::finished, this, &Downloader::OnFinished);
     connect(m_reply, &QNetworkReply::errorOccurred, this, &Downloader::OnError);
+}
 
-    // --- Optional progress dialog
-    if (show_progress_dialog) {
-        const int maximum = 100;
-        if (!m_progress_dialog) {
-            m_progress_dialog = new ProgressDialog(progress_dialog_title, tr("Please wait..."),
-                                                   tr("Abort"), 0, maximum, true, m_parent);
-            m_progress_dialog->setAutoClose(true);
-            m_progress_dialog->setAutoReset(false);
-            m_progress_dialog->show();
-
-            connect(m_progress_dialog, &QProgressDialog::canceled, this, [this]() {
-                m_abort = true;
-                if (m_reply)
-                    m_reply->abort();
-                m_progress_dialog = nullptr;
-                Q_EMIT SignalDownloadCanceled();
-            });
+void Downloader::OnMetaDataChanged() {
+    if (m_abort || !m_reply || m_part.IsOpen()) {
+        return;
+    }
 
-            connect(m_progress_dialog, &QProgressDialog::finished, this,
-                    [this]() { m_progress_dialog = nullptr; });
+    const int status_code = m_reply->attribute(QNetworkRequest::HttpStatusCodeAttribute).toInt();
+    const std::filesystem::path part_path = Common::FS::PathFromQString(m_partPath);
+    if (status_code == 206 && m_resume_offset > 0) {
+        // Content-Range: bytes <first>-<last>/<size>
+        const QByteArray content_range = m_reply->rawHeader("Content-Range");
+        const QByteArray expected = "bytes " + QByteArray::number(m_resume_offset) + "-";
+        const qint64 total = ContentRangeTotal(content_range);
+        if (!content_range.startsWith(expected) ||
+            (m_resume_total >= 0 && total >= 0 && total != m_resume_total)) {
+            DropReply(m_reply);
+            StartSingle(false);
+            return;
+        }
+        m_part.Open(part_path, Common::FS::FileAccessMode::Append);
+    } else if (status_code == 200) {
+        m_resume_offset = 0;
+        m_part.Open(part_path, Common::FS::FileAccessMode::Write);
+
+        // Encoded bodies are stored decoded, their byte offsets cannot be resumed
+        const QByteArray validator = Validator(m_reply);
+        if (!validator.isEmpty() && m_reply->rawHeader("Content-Encoding").isEmpty()) {
+            const QVariant length = m_reply->header(QNetworkRequest::ContentLengthHeader);
+            PartMeta meta;
+            meta.url = m_url.toEncoded();
+            meta.total = length.isValid() ? length.toLongLong() : -1;
+            meta.validator = validator;
+            WriteMeta(m_metaPath, meta);
         } else {
-            m_progress_dialog->setWindowTitle(progress_dialog_title);
-            m_progress_dialog->SetRange(0, maximum);
-            m_progress_dialog->show();
+            QFile::remove(m_metaPath);
         }
+    } else {
+        return; // Redirects, 304 and errors carry no file data
+    }
+    m_unsynced = 0;
+
+    if (!m_part.IsOpen()) {
+        Fail(tr("Cannot write output file."));
     }
 }
 
 void Downloader::OnReadyRead() {
-    if (m_abort)
+    if (m_abort || !m_reply)
         return;
-    m_data.append(m_reply->readAll());
-    Q_EMIT SignalBufferUpdate(
-        m_data.size(),
-        static_cast<int>(m_reply->header(QNetworkRequest::ContentLengthHeader).toLongLong()));
+    const QByteArray data = m_reply->readAll();
+    if (m_part.IsOpen() && !WritePart(data)) {
+        Fail(tr("Cannot write output file."));
+    }
 }
 
 void Downloader::OnDownloadProgress(qint64 bytesReceived, qint64 bytesTotal) {
     if (m_abort)
         return;
-    if (m_progress_dialog && bytesTotal > 0) {
-        m_progress_dialog->SetRange(0, static_cast<int>(bytesTotal));
-        m_progress_dialog->SetValue(static_cast<int>(bytesReceived));
-        QApplication::processEvents();
-    }
+    UpdateProgress(m_resume_offset + bytesReceived,
+                   bytesTotal > 0 ? m_resume_offset + bytesTotal : -1);
 }
 
 void Downloader::OnFinished() {
-    if (m_abort) {
-        if (m_reply) {
-            m_reply->deleteLater();
-            m_reply = nullptr;
-        }
-        return;
-    }
-
     if (!m_reply)
         return;
+    QNetworkReply* reply = std::exchange(m_reply, nullptr);
+    reply->deleteLater();
+    if (m_abort)
+        return;
 
-    const int status_code = m_reply->attribute(QNetworkRequest::HttpStatusCodeAttribute).toInt();
+    const int status_code = reply->attribute(QNetworkRequest::HttpStatusCodeAttribute).toInt();
 
     // --- Handle HTTP 304: Not Modified
     if (status_code == 304) {
-        QFile file(m_localPath);
-        if (file.open(QIODevice::ReadOnly)) {
-            Q_EMIT SignalDownloadFinished(file.readAll());
-            file.close();
-        } else {
-            Q_EMIT SignalDownloadError(tr("Local file missing after 304."));
-        }
-        if (m_progress_dialog)
-            CloseProgressDialog();
-        m_reply->deleteLater();
-        m_reply = nullptr;
+        m_part.Close();
+        FinishFromCache(tr("Local file missing after 304."));
+        return;
+    }
+
+    // --- Handle HTTP 416: the partial file is not a prefix of the file anymore
+    if (status_code == 416 && m_resume_offset > 0 && !m_resume_retried) {
+        m_part.Close();
+        m_resume_retried = true;
+        StartSingle(false);
         return;
     }
 
     // --- Handle HTTP errors
     if (status_code >= 400) {
-        qWarning() << "HTTP error" << status_code << "on URL:" << m_reply->url();
+        qWarning() << "HTTP error" << status_code << "on URL:" << reply->url();
         QFile::remove(m_localPath);
-        Q_EMIT SignalDownloadError(QString("HTTP error %1").arg(status_code));
-        if (m_progress_dialog)
-            CloseProgressDialog();
-        m_reply->deleteLater();
-        m_reply = nullptr;
+        m_part.Close();
+        RemovePart();
+        Fail(QString("HTTP error %1").arg(status_code));
         return;
     }
 
-    // --- Handle network errors
-    if (m_reply->error() != QNetworkReply::NoError) {
-        QFile file(m_localPath);
-        if (file.open(QIODevice::ReadOnly)) {
-            Q_EMIT SignalDownloadFinished(file.readAll());
-            file.close();
-        } else {
-            Q_EMIT SignalDownloadError(m_reply->errorString());
-        }
-        if (m_progress_dialog)
-            CloseProgressDialog();
-        m_reply->deleteLater();
-        m_reply = nullptr;
+    // --- Handle network errors, the partial file stays for the next attempt
+    if (reply->error() != QNetworkReply::NoError) {
+        m_part.Close();
+        FinishFromCache(reply->errorString());
+        return;
+    }
+
+    // --- HTTP 200 OK: Update optional ETag / Last-Modified and move the file into place
+    StoreValidators(reply);
+    Complete();
+}
+
+void Downloader::OnError(QNetworkReply::NetworkError) {
+    if (m_abort || !m_reply)
+        return;
+
+    // OnFinished starts over without the partial file
+    const int status_code = m_reply->attribute(QNetworkRequest::HttpStatusCodeAttribute).toInt();
+    if (status_code == 416 && m_resume_offset > 0 && !m_resume_retried)
+        return;
+
+    QString error = m_reply->errorString();
+    Q_EMIT SignalDownloadError(error);
+
+    if (m_progress_dialog)
+        CloseProgressDialog();
+}
+
+void Downloader::StartProbe() {
+    QNetworkRequest request = MakeRequest(m_url);
+    request.setRawHeader("Accept-Encoding", "identity");
+    m_probe = m_manager->head(request);
+    m_probe->setParent(this);
+    connect(m_probe, &QNetworkReply::finished, this, &Downloader::OnProbeFinished);
+}
+
+void Downloader::OnProbeFinished() {
+    if (!m_probe)
+        return;
+    QNetworkReply* probe = std::exchange(m_probe, nullptr);
+    probe->deleteLater();
+    if (m_abort)
+        return;
+
+    const int status_code = probe->attribute(QNetworkRequest::HttpStatusCodeAttribute).toInt();
+    if (status_code == 304) {
+        FinishFromCache(tr("Local file missing after 304."));
+        return;
+    }
+
+    // Ranges of different versions must not mix, so splitting needs a validator for If-Range
+    const qint64 size = probe->header(QNetworkRequest::ContentLengthHeader).toLongLong();
+    const QByteArray validator = Validator(probe);
+    if (probe->error() == QNetworkReply::NoError && status_code == 200 &&
+        size >= parallel_threshold && probe->rawHeader("Accept-Ranges").contains("bytes") &&
+        !validator.isEmpty()) {
+        StartChunks(probe->url(), size, validator);
+    } else {
+        StartSingle(true);
+    }
+}
+
+void Downloader::StartChunks(const QUrl& url, qint64 size, const QByteArray& validator) {
+    RemovePart();
+    if (m_part.Open(Common::FS::PathFromQString(m_partPath), Common::FS::FileAccessMode::Write);
+        !m_part.IsOpen() || !m_part.SetSize(static_cast<u64>(size))) {
+        m_part.Close();
+        Fail(tr("Cannot write output file."));
+        return;
+    }
+    m_unsynced = 0;
+    m_resume_offset = 0;
+
+    // url is the final one after redirects, the ranges do not need to follow them again
+    const qint64 chunk_size = (size + m_parallel_chunks - 1) / m_parallel_chunks;
+    for (qint64 first = 0; first < size; first += chunk_size) {
+        const qint64 end = std::min(first + chunk_size, size);
+        QNetworkRequest request(url);
+        request.setAttribute(QNetworkRequest::RedirectPolicyAttribute,
+                             QNetworkRequest::NoLessSafeRedirectPolicy);
+        request.setRawHeader("Range", "bytes=" + QByteArray::number(first) + "-" +
+                                          QByteArray::number(end - 1));
+        request.setRawHeader("If-Range", validator);
+        request.setRawHeader("Accept-Encoding", "identity");
+
+        QNetworkReply* reply = m_manager->get(request);
+        reply->setParent(this);
+        const std::size_t index = m_chunks.size();
+        connect(reply, &QNetworkReply::readyRead, this, [this, index] { OnChunkReadyRead(index); });
+        connect(reply, &QNetworkReply::finished, this, [this, index] { OnChunkFinished(index); });
+        m_chunks.push_back(Chunk{.reply = reply, .next = first, .end = end});
+    }
+    qDebug() << "Downloader: Fetching" << m_localPath << "in" << m_chunks.size() << "ranges";
+    UpdateProgress(0, size);
+}
+
+void Downloader::OnChunkReadyRead(std::size_t index) {
+    if (m_abort || index >= m_chunks.size())
+        return;
+    Chunk& chunk = m_chunks[index];
+    const QByteArray data = chunk.reply->readAll();
+
+    // A full response means the file changed since the probe or ranges are not supported
+    const int status_code =
+        chunk.reply->attribute(QNetworkRequest::HttpStatusCodeAttribute).toInt();
+    if (status_code != 206 || data.size() > chunk.end - chunk.next) {
+        Fail(tr("The server sent an unexpected response."));
+        return;
+    }
+    if (!m_part.Seek(chunk.next) || !WritePart(data)) {
+        Fail(tr("Cannot write output file."));
+        return;
+    }
+    chunk.next += data.size();
+
+    qint64 missing = 0;
+    for (const Chunk& other : m_chunks) {
+        missing += other.end - other.next;
+    }
+    const qint64 total = m_chunks.back().end;
+    UpdateProgress(total - missing, total);
+}
+
+void Downloader::OnChunkFinished(std::size_t index) {
+    if (m_abort || index >= m_chunks.size())
+        return;
+    Chunk& chunk = m_chunks[index];
+    if (chunk.reply->error() != QNetworkReply::NoError) {
+        Fail(chunk.reply->errorString());
+        return;
+    }
+    if (chunk.next != chunk.end) {
+        Fail(tr("The server sent an unexpected response."));
         return;
     }
+    chunk.done = true;
+
+    if (std::ranges::all_of(m_chunks, &Chunk::done)) {
+        // Every range was answered by the version the probe saw, so any reply has its headers
+        StoreValidators(chunk.reply);
+        for (Chunk& other : m_chunks) {
+            other.reply->deleteLater();
+        }
+        m_chunks.clear();
+        Complete();
+    }
+}
 
-    // --- HTTP 200 OK: Save response and update optional ETag / Last-Modified
-    const QString new_etag = QString::fromUtf8(m_reply->rawHeader("ETag"));
+void Downloader::StoreValidators(const QNetworkReply* reply) {
+    const QString new_etag = QString::fromUtf8(reply->rawHeader("ETag"));
     if (m_etag && !new_etag.isEmpty())
         m_gui_settings->SetValue(*m_etag, new_etag);
 
-    const QString new_last_modified = QString::fromUtf8(m_reply->rawHeader("Last-Modified"));
+    const QString new_last_modified = QString::fromUtf8(reply->rawHeader("Last-Modified"));
     if (m_last_modified && !new_last_modified.isEmpty())
         m_gui_settings->SetValue(*m_last_modified, new_last_modified);
+}
 
-    QFile file(m_localPath);
-    if (file.open(QIODevice::WriteOnly)) {
-        file.write(m_data);
-        file.close();
-    } else {
-        Q_EMIT SignalDownloadError(tr("Cannot write output file."));
-        if (m_progress_dialog)
-            CloseProgressDialog();
-        m_reply->deleteLater();
-        m_reply = nullptr;
-        return;
+void Downloader::AbortAll() {
+    DropReply(m_reply);
+    DropReply(m_probe);
+
+    // Parallel ranges leave holes in the file, it cannot be continued
+    const bool chunked = !m_chunks.empty();
+    for (Chunk& chunk : m_chunks) {
+        DropReply(chunk.reply);
+    }
+    m_chunks.clear();
+    m_part.Close();
+    if (chunked) {
+        RemovePart();
     }
+}
 
-    if (m_progress_dialog)
-        CloseProgressDialog(m_closeDelayMs);
+void Downloader::DropReply(QNetworkReply*& reply) {
+    if (!reply)
+        return;
+    // Disconnect first, aborting emits finished right away
+    reply->disconnect(this);
+    reply->abort();
+    reply->deleteLater();
+    reply = nullptr;
+}
 
-    Q_EMIT SignalDownloadFinished(m_data);
+bool Downloader::WritePart(const QByteArray& data) {
+    const size_t size = static_cast<size_t>(data.size());
+    if (m_part.WriteRaw<u8>(data.constData(), size) != size) {
+        return false;
+    }
+    m_unsynced += size;
+    if (m_unsynced >= sync_interval) {
+        m_unsynced = 0;
+        return m_part.Commit();
+    }
+    return true;
+}
 
-    m_reply->deleteLater();
-    m_reply = nullptr;
+void Downloader::RemovePart() {
+    QFile::remove(m_partPath);
+    QFile::remove(m_metaPath);
 }
 
-void Downloader::OnError(QNetworkReply::NetworkError) {
-    if (m_abort)
+void Downloader::FinishFromCache(const QString& fallback_error) {
+    if (!QFile::exists(m_localPath)) {
+        Fail(fallback_error);
         return;
+    }
+    if (m_progress_dialog)
+        CloseProgressDialog();
+    Q_EMIT SignalDownloadFinished(m_localPath);
+}
 
-    QString error = m_reply ? m_reply->errorString() : tr("Unknown network error");
-    Q_EMIT SignalDownloadError(error);
+void Downloader::Complete() {
+    // A body without data still makes an (empty) file
+    if (!m_part.IsOpen()) {
+        m_part.Open(Common::FS::PathFromQString(m_partPath), Common::FS::FileAccessMode::Write);
+    }
+    const bool written = m_part.Commit();
+    m_part.Close();
+
+    std::error_code ec;
+    if (written) {
+        std::filesystem::rename(Common::FS::PathFromQString(m_partPath),
+                                Common::FS::PathFromQString(m_localPath), ec);
+    }
+    if (!written || ec) {
+        RemovePart();
+        Fail(tr("Cannot write output file."));
+        return;
+    }
+    QFile::remove(m_metaPath);
 
+    if (m_progress_dialog)
+        CloseProgressDialog(m_closeDelayMs);
+
+    Q_EMIT SignalDownloadFinished(m_localPath);
+}
+
+void Downloader::Fail(const QString& error) {
+    AbortAll();
+    Q_EMIT SignalDownloadError(error);
     if (m_progress_dialog)
         CloseProgressDialog();
 }
 
+void Downloader::UpdateProgress(qint64 received, qint64 total) {
+    Q_EMIT SignalBufferUpdate(received, total);
+    if (m_progress_dialog && total > 0) {
+        // In KiB, so files over 2 GiB fit the range of the dialog
+        m_progress_dialog->SetRange(0, static_cast<int>(total / 1024));
+        m_progress_dialog->SetValue(static_cast<int>(received / 1024));
+        QApplication::processEvents();
+    }
+}
+
 void Downloader::CloseProgressDialog(int delayMs) {
     if (!m_progress_dialog)
         return;
@@ -4,18 +4,35 @@
 #pragma once
 #include <memory>
 #include <optional>
+#include <vector>
 #include <QByteArray>
 #include <QNetworkReply>
 #include <QObject>
 #include <QPointer>
+#include <QUrl>
+#include "common/io_file.h"
+#include "common/types.h"
 #include "gui_save.h"
 
 class GUISettings;
 class ProgressDialog;
 
+/**
+ * Downloads a file to local_path without holding it in memory.
+ *
+ * Data is streamed into local_path.part and moved over local_path once complete, so an existing
+ * file stays intact until the new one is whole. An interrupted download leaves the partial file
+ * behind together with its URL, total size and the ETag or Last-Modified value it was fetched
+ * with. The next download of the same URL to the same path continues it with a Range request that
+ * the server only honours if the file did not change in between, anything else starts over.
+ * Large files can be fetched as several ranges in parallel.
+ */
 class Downloader : public QObject {
     Q_OBJECT
 public:
+    /** Files at least this large are split into ranges when parallel chunks are enabled */
+    static constexpr qint64 parallel_threshold = 32_MB;
+
     Downloader(std::shared_ptr<GUISettings> gui_settings,
                std::optional<GUISave> etag = std::nullopt,
                std::optional<GUISave> last_modified = std::nullopt, QWidget* parent = nullptr);
@@ -26,31 +43,72 @@ public:
                                bool show_progress_dialog = true,
                                const QString& progress_dialog_title = QString(), int delayMs = 0);
 
+    /** Number of parallel ranges used for large files, 1 disables splitting */
+    void SetParallelChunks(int count);
+
     void CloseProgressDialog(int delayMs = 0);
     ProgressDialog* GetProgressDialog() const;
 
 signals:
-    void SignalDownloadFinished(const QByteArray& data);
+    /** path is the local path passed to DownloadJSONWithCache */
+    void SignalDownloadFinished(const QString& path);
     void SignalDownloadError(const QString& error);
     void SignalDownloadCanceled();
-    void SignalBufferUpdate(qint64 received, int total);
+    void SignalBufferUpdate(qint64 received, qint64 total);
 
 private slots:
+    void OnMetaDataChanged();
     void OnReadyRead();
     void OnDownloadProgress(qint64 bytesReceived, qint64 bytesTotal);
     void OnFinished();
     void OnError(QNetworkReply::NetworkError code);
 
 private:
+    struct Chunk {
+        QNetworkReply* reply = nullptr;
+        qint64 next = 0; // Offset of the next byte this range writes
+        qint64 end = 0;  // One past the last byte of the range
+        bool done = false;
+    };
+
+    QNetworkRequest MakeRequest(const QUrl& url) const;
+    void StartSingle(bool allow_resume);
+    void StartProbe();
+    void OnProbeFinished();
+    void StartChunks(const QUrl& url, qint64 size, const QByteArray& validator);
+    void OnChunkReadyRead(std::size_t index);
+    void OnChunkFinished(std::size_t index);
+    /// Remembers the ETag and Last-Modified of a complete download for the next conditional GET
+    void StoreValidators(const QNetworkReply* reply);
+    void AbortAll();
+    void DropReply(QNetworkReply*& reply);
+
+    bool WritePart(const QByteArray& data);
+    void RemovePart();
+    void FinishFromCache(const QString& fallback_error);
+    void Complete();
+    void Fail(const QString& error);
+    void UpdateProgress(qint64 received, qint64 total);
+
     QString m_localPath;
+    QString m_partPath;
+    QString m_metaPath; // URL, size and validator of the partial file, for resuming it
+    QUrl m_url;
     std::shared_ptr<GUISettings> m_gui_settings;
-    QByteArray m_data;
+    Common::FS::IOFile m_part;
+    qint64 m_resume_offset = 0;
+    qint64 m_resume_total = -1; // Size of the whole file the partial one belongs to, if known
+    u64 m_unsynced = 0;
+    bool m_resume_retried = false;
     bool m_abort = false;
     bool m_keep_progress_dialog_open = false;
     int m_closeDelayMs = 0;
+    int m_parallel_chunks = 1;
 
     ProgressDialog* m_progress_dialog = nullptr;
     QNetworkReply* m_reply = nullptr;
+    QNetworkReply* m_probe = nullptr;
+    std::vector<Chunk> m_chunks;
     QNetworkAccessManager* m_manager = nullptr;
     QWidget* m_parent = nullptr;
     std::optional<GUISave> m_etag;
@@ -1,22 +1,298 @@
 // SPDX-FileCopyrightText: Copyright 2025-2026 shadLauncher4 Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
-#include <common/path_util.h>
+#include <algorithm>
+#include <cstring>
+#include <optional>
+#include <string_view>
+#include <system_error>
+#include <QCoreApplication>
+#include <QDateTime>
+#include <QFile>
+#include <QHash>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QPointer>
+#include <QTimeZone>
+#include <QtConcurrent>
+
+#include "common/io_file.h"
+#include "common/path_util.h"
 #include "downloader.h"
 #include "game_compatibility.h"
 #include "gui_settings.h"
 
-#include <QJsonArray>
-#include <QJsonDocument>
+namespace fs = std::filesystem;
+
+namespace {
+
+constexpr u32 snapshot_magic = 0x44434C53; // "SLCD"
+constexpr u32 snapshot_version = 1;
+
+// Layout: header, entries sorted by title ID, string offsets (string_count + 1), string data.
+// Every field of an entry is the index of an interned UTF-8 string.
+struct SnapshotHeader {
+    u32 magic;
+    u32 version;
+    u64 json_size;
+    s64 json_mtime;
+    u32 entry_count;
+    u32 string_count;
+    u64 reserved;
+};
+static_assert(sizeof(SnapshotHeader) == 40);
+
+struct SnapshotEntry {
+    u32 title_id;
+    u32 status; // Key of GameCompatibility::m_status_data
+    u32 last_tested_date;
+    u32 latest_version;
+    u32 issue_number;
+};
+static_assert(sizeof(SnapshotEntry) == 20);
+
+struct JsonStamp {
+    u64 size;
+    s64 mtime;
+};
+
+std::optional<JsonStamp> ReadJsonStamp(const fs::path& path) {
+    std::error_code ec;
+    const u64 size = fs::file_size(path, ec);
+    if (ec) {
+        return std::nullopt;
+    }
+    const auto time = fs::last_write_time(path, ec);
+    if (ec) {
+        return std::nullopt;
+    }
+    return JsonStamp{size, static_cast<s64>(time.time_since_epoch().count())};
+}
+
+SnapshotHeader ReadHeader(std::span<const u8> snapshot) {
+    SnapshotHeader header;
+    std::memcpy(&header, snapshot.data(), sizeof(header));
+    return header;
+}
+
+SnapshotEntry ReadEntry(std::span<const u8> snapshot, u32 index) {
+    SnapshotEntry entry;
+    std::memcpy(&entry, snapshot.data() + sizeof(SnapshotHeader) + u64{index} * sizeof(entry),
+                sizeof(entry));
+    return entry;
+}
+
+u32 ReadOffset(std::span<const u8> snapshot, const SnapshotHeader& header, u32 index) {
+    u32 offset;
+    std::memcpy(&offset,
+                snapshot.data() + sizeof(SnapshotHeader) +
+                    u64{header.entry_count} * sizeof(SnapshotEntry) + u64{index} * sizeof(u32),
+                sizeof(offset));
+    return offset;
+}
+
+std::string_view ReadString(std::span<const u8> snapshot, const SnapshotHeader& header,
+                            u32 index) {
+    const u64 data_offset = sizeof(SnapshotHeader) +
+                            u64{header.entry_count} * sizeof(SnapshotEntry) +
+                            (u64{header.string_count} + 1) * sizeof(u32);
+    const u32 begin = ReadOffset(snapshot, header, index);
+    const u32 end = ReadOffset(snapshot, header, index + 1);
+    return {reinterpret_cast<const char*>(snapshot.data()) + data_offset + begin, end - begin};
+}
+
+/**
+ * Checks the whole snapshot once, so lookups can trust every offset and index in it. This is a
+ * single pass over plain integers and far cheaper than parsing the JSON file.
+ */
+bool ValidateSnapshot(std::span<const u8> snapshot) {
+    if (snapshot.size() < sizeof(SnapshotHeader)) {
+        return false;
+    }
+    const SnapshotHeader header = ReadHeader(snapshot);
+    if (header.magic != snapshot_magic || header.version != snapshot_version) {
+        return false;
+    }
+
+    const u64 data_offset = sizeof(SnapshotHeader) +
+                            u64{header.entry_count} * sizeof(SnapshotEntry) +
+                            (u64{header.string_count} + 1) * sizeof(u32);
+    if (snapshot.size() < data_offset) {
+        return false;
+    }
+    u32 previous = 0;
+    for (u32 i = 0; i <= header.string_count; ++i) {
+        const u32 offset = ReadOffset(snapshot, header, i);
+        if (offset < previous) {
+            return false;
+        }
+        previous = offset;
+    }
+    if (snapshot.size() - data_offset < previous) {
+        return false;
+    }
+
+    for (u32 i = 0; i < header.entry_count; ++i) {
+        const SnapshotEntry entry = ReadEntry(snapshot, i);
+        if (std::max({entry.title_id, entry.status, entry.last_tested_date,
+                      entry.latest_version, entry.issue_number}) >= header.string_count) {
+            return false;
+        }
+        if (i > 0 && ReadString(snapshot, header, ReadEntry(snapshot, i - 1).title_id) >=
+                         ReadString(snapshot, header, entry.title_id)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool SnapshotMatches(std::span<const u8> snapshot, const std::optional<JsonStamp>& stamp) {
+    if (!stamp || snapshot.size() < sizeof(SnapshotHeader)) {
+        return false;
+    }
+    const SnapshotHeader header = ReadHeader(snapshot);
+    return header.json_size == stamp->size && header.json_mtime == stamp->mtime;
+}
+
+QString NormalizeStatusString(const QString& value) {
+    QString result = value;
+
+    if (result.startsWith("status-"))
+        result = result.mid(7);
+
+    if (!result.isEmpty())
+        result[0] = result[0].toUpper();
+
+    if (result.startsWith("Unknown"))
+        result = "NoResult";
+
+    return result;
+}
+
+class SnapshotBuilder {
+public:
+    u32 Intern(const QString& value) {
+        const QByteArray utf8 = value.toUtf8();
+        const auto it = m_indices.constFind(utf8);
+        if (it != m_indices.cend()) {
+            return it.value();
+        }
+        const u32 index = static_cast<u32>(m_offsets.size());
+        m_offsets.push_back(static_cast<u32>(m_data.size()));
+        m_data.append(utf8);
+        m_indices.insert(utf8, index);
+        return index;
+    }
+
+    void Add(const QString& title_id, const SnapshotEntry& entry) {
+        m_entries.emplace_back(title_id.toStdString(), entry);
+    }
+
+    std::vector<u8> Finish(const JsonStamp& stamp) {
+        std::ranges::sort(m_entries, {}, &std::pair<std::string, SnapshotEntry>::first);
+        const auto duplicate =
+            std::ranges::unique(m_entries, {}, &std::pair<std::string, SnapshotEntry>::first);
+        m_entries.erase(duplicate.begin(), duplicate.end());
+        m_offsets.push_back(static_cast<u32>(m_data.size()));
+
+        const SnapshotHeader header{
+            .magic = snapshot_magic,
+            .version = snapshot_version,
+            .json_size = stamp.size,
+            .json_mtime = stamp.mtime,
+            .entry_count = static_cast<u32>(m_entries.size()),
+            .string_count = static_cast<u32>(m_offsets.size() - 1),
+            .reserved = 0,
+        };
+        std::vector<u8> snapshot(sizeof(header) + m_entries.size() * sizeof(SnapshotEntry) +
+                                 m_offsets.size() * sizeof(u32) + m_data.size());
+        u8* out = snapshot.data();
+        std::memcpy(out, &header, sizeof(header));
+        out += sizeof(header);
+        for (const auto& [title_id, entry] : m_entries) {
+            std::memcpy(out, &entry, sizeof(entry));
+            out += sizeof(entry);
+        }
+        std::memcpy(out, m_offsets.data(), m_offsets.size() * sizeof(u32));
+        out += m_offsets.size() * sizeof(u32);
+        std::memcpy(out, m_data.constData(), m_data.size());
+        return snapshot;
+    }
+
+private:
+    std::vector<std::pair<std::string, SnapshotEntry>> m_entries;
+    std::vector<u32> m_offsets;
+    QByteArray m_data;
+    QHash<QByteArray, u32> m_indices;
+};
+
+/** Returns nothing if content holds no database */
+std::optional<std::vector<u8>> BuildSnapshotBytes(const QByteArray& content,
+                                                  const JsonStamp& stamp) {
+    // Set current_os automatically
+    QString current_os;
+#ifdef Q_OS_WIN
+    current_os = "os-windows";
+#elif defined(Q_OS_MAC)
+    current_os = "os-macOS";
+#elif defined(Q_OS_LINUX)
+    current_os = "os-linux";
+#else
+    current_os = "os-unknown";
+#endif
+    const QJsonObject json_data = QJsonDocument::fromJson(content).object();
+    if (json_data.isEmpty()) {
+        qDebug() << "Database Error - Empty JSON root";
+        return std::nullopt;
+    }
+
+    SnapshotBuilder builder;
+    for (auto game = json_data.begin(); game != json_data.end(); ++game) {
+        const QString game_id = game.key();
+        if (!game.value().isObject()) {
+            qDebug() << "Database Error - Unusable object:" << game_id;
+            continue;
+        }
+        const QJsonValue platform_value = game.value().toObject().value(current_os);
+        if (platform_value.isUndefined()) {
+            continue; // no entry for this platform
+        }
+        if (!platform_value.isObject()) {
+            qDebug() << "Database Error - Invalid platform object:" << current_os
+                     << "for game ID:" << game_id;
+            continue;
+        }
+        const QJsonObject platform_obj = platform_value.toObject();
+
+        QDateTime dt =
+            QDateTime::fromString(platform_obj.value("last_tested").toString(), Qt::ISODate);
+        dt.setTimeZone(QTimeZone::utc());
+
+        builder.Add(game_id,
+                    SnapshotEntry{
+                        .title_id = builder.Intern(game_id),
+                        .status = builder.Intern(NormalizeStatusString(
+                            platform_obj.value("status").toString("NoResult"))),
+                        .last_tested_date = builder.Intern(dt.toString("yyyy/MM/dd")),
+                        .latest_version = builder.Intern(platform_obj.value("version").toString()),
+                        .issue_number =
+                            builder.Intern(platform_obj.value("issue_number").toString()),
+                    });
+    }
+    return builder.Finish(stamp);
+}
+
+} // namespace
 
 GameCompatibility::GameCompatibility(std::shared_ptr<GUISettings> gui_settings, QWidget* parent)
     : QObject(parent), m_gui_settings(std::move(gui_settings)) {
-    const std::filesystem::path compat_path =
-        Common::FS::GetUserPath(Common::FS::PathType::UserDir) / "compatibility_data.json";
+    const fs::path user_dir = Common::FS::GetUserPath(Common::FS::PathType::UserDir);
+    m_json_path = user_dir / "compatibility_data.json";
+    m_snapshot_path = user_dir / "compatibility_data.bin";
 #ifdef _WIN32
-    m_filepath = QString::fromStdWString(compat_path.wstring()); // UTF-16 Windows
+    m_filepath = QString::fromStdWString(m_json_path.wstring()); // UTF-16 Windows
 #else
-    m_filepath = QString::fromUtf8(compat_path.u8string().c_str()); // UTF-8 Linux/macOS
+    m_filepath = QString::fromUtf8(m_json_path.u8string().c_str()); // UTF-8 Linux/macOS
 #endif
 
     m_downloader = new Downloader(m_gui_settings, GUI::compatibility_etag,
@@ -32,46 +308,60 @@ GameCompatibility::GameCompatibility(std::shared_ptr<GUISettings> gui_settings,
 }
 
 Compat::Status GameCompatibility::GetCompatibility(const std::string& title_id) {
-    if (m_compat_database.empty()) {
+    const std::shared_ptr<const Snapshot> current = m_snapshot.load();
+    if (!current || current->data.empty()) {
         return m_status_data.at("NoData");
     }
 
-    if (const auto it = m_compat_database.find(title_id); it != m_compat_database.cend()) {
-        return it->second;
+    const std::span<const u8> snapshot = current->data;
+    const SnapshotHeader header = ReadHeader(snapshot);
+    u32 first = 0;
+    u32 count = header.entry_count;
+    while (count > 0) {
+        const u32 step = count / 2;
+        const std::string_view probe =
+            ReadString(snapshot, header, ReadEntry(snapshot, first + step).title_id);
+        if (probe < title_id) {
+            first += step + 1;
+            count -= step + 1;
+        } else {
+            count = step;
+        }
+    }
+    if (first == header.entry_count) {
+        return m_status_data.at("NoResult");
+    }
+    const SnapshotEntry entry = ReadEntry(snapshot, first);
+    if (ReadString(snapshot, header, entry.title_id) != title_id) {
+        return m_status_data.at("NoResult");
     }
 
-    return m_status_data.at("NoResult");
+    const auto to_qstring = [&](u32 index) {
+        const std::string_view value = ReadString(snapshot, header, index);
+        return QString::fromUtf8(value.data(), static_cast<qsizetype>(value.size()));
+    };
+    const auto it = m_status_data.find(to_qstring(entry.status));
+    Compat::Status status = it != m_status_data.cend() ? it->second : m_status_data.at("NoResult");
+    status.last_tested_date = to_qstring(entry.last_tested_date);
+    status.latest_version = to_qstring(entry.latest_version);
+    status.issue_number = to_qstring(entry.issue_number);
+    return status;
 }
 
 Compat::Status GameCompatibility::GetStatusData(const QString& status) const {
     return m_status_data.at(status);
 }
 
-void GameCompatibility::HandleDownloadFinished(const QByteArray& content) {
-    qDebug() << "Database download finished";
-
-    // Create new map from database and write database to file if database was valid
-    if (ReadJSON(QJsonDocument::fromJson(content).object(), true)) {
-        // Write database to file
-        QFile file(m_filepath);
+void GameCompatibility::HandleDownloadFinished(const QString& path) {
+    qDebug() << "Database download finished:" << path;
 
-        if (file.exists()) {
-            qDebug() << "Database file found:" << m_filepath;
-        }
-
-        if (!file.open(QIODevice::WriteOnly)) {
-            qDebug() << "Could not write database to file:" << m_filepath;
-            return;
-        }
-
-        file.write(content);
-        file.close();
-
-        qDebug() << "Wrote database to file:" << m_filepath;
+    // An unchanged database, for example after a 304 response, needs no parsing
+    const std::shared_ptr<const Snapshot> current = m_snapshot.load();
+    if (current && SnapshotMatches(current->data, ReadJsonStamp(m_json_path))) {
+        Q_EMIT DownloadFinished();
+        return;
     }
-
-    // We have a new database in map, therefore refresh gamelist to new state
-    Q_EMIT DownloadFinished();
+    BuildSnapshot(true);
 }
 
 void GameCompatibility::HandleDownloadCanceled() {
@@ -84,27 +374,15 @@ void GameCompatibility::HandleDownloadError(const QString& error) {
 
 void GameCompatibility::RequestCompatibility(bool online) {
     if (!online) {
-        // Retrieve database from file
-        QFile file(m_filepath);
-
-        if (!file.exists()) {
+        if (!fs::exists(m_json_path)) {
             qDebug() << "Database file not found:" << m_filepath;
             return;
         }
-
-        if (!file.open(QIODevice::ReadOnly)) {
-            qDebug() << "Could not read database from file:" << m_filepath;
+        if (OpenSnapshot()) {
+            qDebug() << "Finished reading database snapshot for:" << m_filepath;
             return;
         }
-
-        const QByteArray content = file.readAll();
-        file.close();
-
-        qDebug() << "Finished reading database from file:" << m_filepath;
-
-        // Create new map from database
-        ReadJSON(QJsonDocument::fromJson(content).object(), online);
-
+        BuildSnapshot(false);
         return;
     }
     const std::string url =
@@ -118,62 +396,77 @@ void GameCompatibility::RequestCompatibility(bool online) {
     Q_EMIT DownloadStarted();
 }
 
-bool GameCompatibility::ReadJSON(const QJsonObject& json_data, bool after_download) {
-    // Set current_os automatically
-    QString current_os;
-#ifdef Q_OS_WIN
-    current_os = "os-windows";
-#elif defined(Q_OS_MAC)
-    current_os = "os-macOS";
-#elif defined(Q_OS_LINUX)
-    current_os = "os-linux";
-#else
-    current_os = "os-unknown";
-#endif
-    if (json_data.isEmpty()) {
-        qDebug() << "Database Error - Empty JSON root";
-        Q_EMIT DownloadError(tr("Error Downloading Compatibility Database"));
+bool GameCompatibility::OpenSnapshot() {
+    auto snapshot = std::make_shared<Snapshot>();
+    if (!snapshot->file.Open(m_snapshot_path) || !ValidateSnapshot(snapshot->file.Span()) ||
+        !SnapshotMatches(snapshot->file.Span(), ReadJsonStamp(m_json_path))) {
         return false;
     }
-    m_compat_database.clear();
-    for (const QString& game_id : json_data.keys()) {
-        const QJsonValue game_value = json_data.value(game_id);
-        if (!game_value.isObject()) {
-            qDebug() << "Database Error - Unusable object:" << game_id;
-            continue;
+    snapshot->data = snapshot->file.Span();
+    m_snapshot.store(std::move(snapshot));
+    return true;
+}
+
+void GameCompatibility::BuildSnapshot(bool after_download) {
+    const u64 generation = ++m_generation;
+    (void)QtConcurrent::run([json_path = m_json_path, filepath = m_filepath, generation,
+                             after_download, receiver = QPointer<GameCompatibility>(this)] {
+        // Stamp before reading, a file replaced in between is then parsed again next time
+        const std::optional<JsonStamp> stamp = ReadJsonStamp(json_path);
+        QByteArray content;
+        QFile file(filepath);
+        if (file.open(QIODevice::ReadOnly)) {
+            content = file.readAll();
+            qDebug() << "Finished reading database from file:" << filepath;
+        } else {
+            qDebug() << "Could not read database from file:" << filepath;
         }
-        const QJsonObject game_object = game_value.toObject();
-        for (const QString& platform_key : game_object.keys()) { // match platform
-            const QJsonValue platform_value = game_object.value(platform_key);
-            if (!platform_value.isObject()) {
-                qDebug() << "Database Error - Invalid platform object:" << platform_key
-                         << "for game ID:" << game_id;
-                continue;
-            }
-            if (platform_key != current_os) {
-                continue; // skip non-matching platform
-            }
-            const QJsonObject platform_obj = platform_value.toObject();
-
-            // Create and populate the status structure
-            QString normalized =
-                NormalizeStatusString(platform_obj.value("status").toString("NoResult"));
-            if (normalized.startsWith("Unknown")) {
-                normalized = "NoResult";
-            }
-            Compat::Status status = m_status_data.at(normalized);
-
-            QString isoDate = platform_obj.value("last_tested").toString();
-            QDateTime dt = QDateTime::fromString(isoDate, Qt::ISODate);
-            dt.setTimeZone(QTimeZone::utc());
-            status.last_tested_date = dt.toString("yyyy/MM/dd");
-            status.latest_version = platform_obj.value("version").toString();
-            status.issue_number = platform_obj.value("issue_number").toString();
-
-            // Add status to map
-            m_compat_database.emplace(game_id.toStdString(), std::move(status));
+
+        std::shared_ptr<const std::vector<u8>> snapshot;
+        if (auto bytes = BuildSnapshotBytes(content, stamp.value_or(JsonStamp{})); bytes) {
+            snapshot = std::make_shared<const std::vector<u8>>(std::move(*bytes));
         }
+        QMetaObject::invokeMethod(
+            QCoreApplication::instance(),
+            [receiver, generation, snapshot = std::move(snapshot), after_download] {
+                if (receiver) {
+                    receiver->OnSnapshotBuilt(generation, snapshot, after_download);
+                }
+            },
+            Qt::QueuedConnection);
+    });
+}
+
+void GameCompatibility::OnSnapshotBuilt(u64 generation,
+                                        std::shared_ptr<const std::vector<u8>> snapshot,
+                                        bool after_download) {
+    if (generation != m_generation) {
+        return;
+    }
+    if (!snapshot) {
+        // Keep the database we have
+        if (after_download) {
+            Q_EMIT DownloadError(tr("Error Downloading Compatibility Database"));
+            Q_EMIT DownloadFinished();
+        }
+        return;
     }
 
-    return true;
+    auto current = std::make_shared<Snapshot>();
+    current->bytes = std::move(snapshot);
+    current->data = *current->bytes;
+    m_snapshot.store(current);
+
+    // On Windows the file can only be replaced once no reader maps the old one anymore. If one
+    // still does, the write fails and the snapshot is simply built again on the next start.
+    (void)QtConcurrent::run([path = m_snapshot_path, bytes = current->bytes] {
+        Common::FS::WriteFileAtomically(path, *bytes);
+    });
+
+    // We have a new database, therefore refresh gamelist to new state
+    if (after_download) {
+        Q_EMIT DownloadFinished();
+    } else {
+        Q_EMIT DatabaseLoaded();
+    }
 }
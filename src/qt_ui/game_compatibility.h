@@ -3,11 +3,19 @@
 
 #pragma once
 
+#include <atomic>
+#include <filesystem>
+#include <map>
 #include <memory>
-#include <QJsonObject>
+#include <span>
+#include <string>
+#include <vector>
 #include <QString>
 #include <QWidget>
 
+#include "common/mapped_file.h"
+#include "common/types.h"
+
 class GUISettings;
 class Downloader;
 
@@ -43,27 +51,34 @@ private:
 	};
     /* clang-format on */
     std::shared_ptr<GUISettings> m_gui_settings;
-    std::map<std::string, Compat::Status> m_compat_database;
     QString m_filepath;
-    /** Creates new map from the database */
-    bool ReadJSON(const QJsonObject& json_data, bool after_download);
-    QString NormalizeStatusString(const QString& value) {
-        QString result = value;
-
-        if (result.startsWith("status-"))
-            result = result.mid(7);
+    std::filesystem::path m_json_path;
+    std::filesystem::path m_snapshot_path;
 
-        if (!result.isEmpty())
-            result[0] = result[0].toUpper();
+    // The database is a binary snapshot of the JSON file, either mapped from disk or freshly
+    // built by a worker. data views one of them.
+    struct Snapshot {
+        Common::FS::MappedFile file;
+        std::shared_ptr<const std::vector<u8>> bytes;
+        std::span<const u8> data;
+    };
+    // Game list workers look titles up while the GUI thread replaces the snapshot, so it is
+    // swapped as a whole and every reader keeps the one it started with alive
+    std::atomic<std::shared_ptr<const Snapshot>> m_snapshot;
+    u64 m_generation = 0; // Results of older loads are dropped
 
-        return result;
-    }
+    /** Maps the snapshot on disk if it was built from the current JSON file */
+    bool OpenSnapshot();
+    /** Parses the JSON file into a snapshot on a worker */
+    void BuildSnapshot(bool after_download);
+    void OnSnapshotBuilt(u64 generation, std::shared_ptr<const std::vector<u8>> snapshot,
+                         bool after_download);
     Downloader* m_downloader = nullptr;
 
 public:
     /** Handles reads, writes and downloads for the compatibility database */
     GameCompatibility(std::shared_ptr<GUISettings> gui_settings, QWidget* parent);
-    /** Returns the compatibility status for the requested title */
+    /** Returns the compatibility status for the requested title. Thread-safe. */
     Compat::Status GetCompatibility(const std::string& title_id);
     /** Returns the data for the requested status */
     Compat::Status GetStatusData(const QString& status) const;
@@ -71,12 +86,14 @@ public:
     void RequestCompatibility(bool online = false);
 
 Q_SIGNALS:
+    /** The database was read from the JSON file without a download */
+    void DatabaseLoaded();
     void DownloadStarted();
     void DownloadFinished();
     void DownloadCanceled();
     void DownloadError(const QString& error);
 private Q_SLOTS:
     void HandleDownloadError(const QString& error);
-    void HandleDownloadFinished(const QByteArray& content);
+    void HandleDownloadFinished(const QString& path);
     void HandleDownloadCanceled();
 };
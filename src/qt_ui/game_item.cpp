@@ -3,9 +3,10 @@
 
 #include "game_item.h"
 
-GameItem::GameItem() : QTableWidgetItem(), GameItemBase() {}
+GameItem::GameItem(game_info game, std::size_t index)
+    : GameItemBase(), m_game(std::move(game)), m_index(index) {}
 
-GameItem::GameItem(const QString& text, int type) : QTableWidgetItem(text, type), GameItemBase() {}
-
-GameItem::GameItem(const QIcon& icon, const QString& text, int type)
-    : QTableWidgetItem(icon, text, type), GameItemBase() {}
+void GameItem::SetIcon(const QPixmap& pixmap) {
+    std::lock_guard lock(pixmap_mutex);
+    m_icon = pixmap;
+}
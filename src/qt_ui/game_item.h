@@ -4,12 +4,33 @@
 #pragma once
 
 #include "game_item_base.h"
+#include "gui_game_info.h"
 
-#include <QTableWidgetItem>
+#include <QPixmap>
 
-class GameItem : public QTableWidgetItem, public GameItemBase {
+/** Icon and size on disk state of one game list row. It is not a table item, the table model
+ * only creates it once the row is about to be shown. */
+class GameItem : public GameItemBase {
 public:
-    GameItem();
-    GameItem(const QString& text, int type = Type);
-    GameItem(const QIcon& icon, const QString& text, int type = Type);
+    GameItem(game_info game, std::size_t index);
+
+    const game_info& Game() const {
+        return m_game;
+    }
+
+    /** Index of the game in the model, which does not change when sorting */
+    std::size_t Index() const {
+        return m_index;
+    }
+
+    const QPixmap& Icon() const {
+        return m_icon;
+    }
+
+    void SetIcon(const QPixmap& pixmap);
+
+private:
+    game_info m_game{};
+    std::size_t m_index{};
+    QPixmap m_icon{};
 };
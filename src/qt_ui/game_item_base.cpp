@@ -3,6 +3,7 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include "game_item_base.h"
+#include "icon_memory_cache.h"
 
 GameItemBase::GameItemBase() {
     m_icon_loading_aborted.reset(new std::atomic<bool>(false));
@@ -10,12 +11,23 @@ GameItemBase::GameItemBase() {
 }
 
 GameItemBase::~GameItemBase() {
+    IconMemoryCache::Instance().Remove(this);
     waitForIconLoading(true);
     waitForSizeOnDiskLoading(true);
 }
 
-void GameItemBase::getIconLoadFunc(int index) {
-    if (!m_icon_load_callback || m_icon_loading || m_icon_loading_aborted->load()) {
+void GameItemBase::getIconLoadFunc(int index, IconDecodePool::Priority priority) {
+    if (!m_icon_load_callback || m_icon_loading_aborted->load()) {
+        return;
+    }
+
+    if (m_icon_loading) {
+        if (priority == IconDecodePool::Priority::Visible) {
+            IconMemoryCache::Instance().Touch(this);
+        }
+        if (m_icon_load_task) {
+            IconDecodePool::Instance().Promote(m_icon_load_task, priority);
+        }
         return;
     }
 
@@ -23,12 +35,14 @@ void GameItemBase::getIconLoadFunc(int index) {
 
     *m_icon_loading_aborted = false;
     m_icon_loading = true;
-    m_icon_load_thread.reset(QThread::create([this, index]() {
-        if (m_icon_load_callback) {
-            m_icon_load_callback(index);
-        }
-    }));
-    m_icon_load_thread->start();
+    m_icon_load_task = IconDecodePool::Instance().Submit(
+        priority,
+        [this, index]() {
+            if (m_icon_load_callback) {
+                m_icon_load_callback(index);
+            }
+        },
+        m_icon_loading_aborted);
 }
 
 void GameItemBase::setIconLoadFunc(const icon_load_callback_t& func) {
@@ -39,6 +53,24 @@ void GameItemBase::setIconLoadFunc(const icon_load_callback_t& func) {
     *m_icon_loading_aborted = false;
 }
 
+bool GameItemBase::cancelPendingIconLoad() {
+    if (!m_icon_load_task || !IconDecodePool::Instance().Cancel(m_icon_load_task)) {
+        return false;
+    }
+
+    m_icon_load_task.reset();
+    m_icon_loading = false;
+    return true;
+}
+
+void GameItemBase::releaseIcon() {
+    waitForIconLoading(true);
+
+    m_icon_loading = false;
+    *m_icon_loading_aborted = false;
+    m_icon_mips.clear();
+}
+
 void GameItemBase::getSizeCalcFunc() {
     if (!m_size_calc_callback || m_size_on_disk_loading || m_size_on_disk_loading_aborted->load()) {
         return;
@@ -65,9 +97,12 @@ void GameItemBase::setSizeCalcFunc(const size_calc_callback_t& func) {
 void GameItemBase::waitForIconLoading(bool abort) {
     *m_icon_loading_aborted = abort;
 
-    if (m_icon_load_thread && m_icon_load_thread->isRunning()) {
-        m_icon_load_thread->wait();
-        m_icon_load_thread.reset();
+    if (m_icon_load_task) {
+        if (abort) {
+            IconDecodePool::Instance().Cancel(m_icon_load_task);
+        }
+        IconDecodePool::Instance().Wait(m_icon_load_task);
+        m_icon_load_task.reset();
     }
 }
 
@@ -7,8 +7,12 @@
 #include <functional>
 #include <memory>
 #include <shared_mutex>
+#include <vector>
+#include <QPixmap>
 #include <QThread>
 
+#include "icon_decode_pool.h"
+
 using icon_load_callback_t = std::function<void(int)>;
 using size_calc_callback_t = std::function<void()>;
 
@@ -17,8 +21,14 @@ public:
     GameItemBase();
     virtual ~GameItemBase();
 
-    void getIconLoadFunc(int index);
+    /** Queues the icon load, or moves an already queued one up to the given priority */
+    void getIconLoadFunc(int index,
+                         IconDecodePool::Priority priority = IconDecodePool::Priority::Visible);
     void setIconLoadFunc(const icon_load_callback_t& func);
+    /** Drops a queued icon load that has not started yet, so it can be requested again later */
+    bool cancelPendingIconLoad();
+    /** Forgets the loaded icon after the view dropped it, the next request loads it again */
+    void releaseIcon();
 
     void getSizeCalcFunc();
     void setSizeCalcFunc(const size_calc_callback_t& func);
@@ -52,10 +62,20 @@ public:
         m_image_change_callback = func;
     }
 
+    /** Downscaled versions of the full composed icon, smallest first. Only touched on the GUI
+     * thread. */
+    const std::vector<QPixmap>& getIconMips() const {
+        return m_icon_mips;
+    }
+
+    void setIconMips(std::vector<QPixmap> mips) {
+        m_icon_mips = std::move(mips);
+    }
+
     std::shared_mutex pixmap_mutex;
 
 private:
-    std::unique_ptr<QThread> m_icon_load_thread;
+    std::shared_ptr<IconDecodePool::Task> m_icon_load_task;
     std::unique_ptr<QThread> m_size_calc_thread;
     std::atomic<bool> m_size_on_disk_loading{false};
     std::atomic<bool> m_icon_loading{false};
@@ -65,4 +85,5 @@ private:
     std::shared_ptr<std::atomic<bool>> m_icon_loading_aborted;
     std::shared_ptr<std::atomic<bool>> m_size_on_disk_loading_aborted;
     std::function<void()> m_image_change_callback = nullptr;
+    std::vector<QPixmap> m_icon_mips;
 };
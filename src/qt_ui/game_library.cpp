@@ -0,0 +1,328 @@
+// SPDX-FileCopyrightText: Copyright 2025-2026 shadLauncher4 Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <numeric>
+#include <QCollator>
+#include <QStringList>
+
+#include "game_library.h"
+
+namespace {
+
+constexpr qsizetype gram_length = 3;
+
+u64 Trigram(const QChar* chars) {
+    return (u64{chars[0].unicode()} << 32) | (u64{chars[1].unicode()} << 16) | chars[2].unicode();
+}
+
+} // namespace
+
+EntrySet::EntrySet(std::size_t size, bool filled)
+    : m_words((size + 63) / 64, filled ? ~u64{0} : u64{0}), m_size(size) {
+    if (filled && size % 64 != 0) {
+        m_words.back() = (u64{1} << (size % 64)) - 1;
+    }
+}
+
+bool EntrySet::None() const {
+    return std::all_of(m_words.begin(), m_words.end(), [](u64 word) { return word == 0; });
+}
+
+EntrySet& EntrySet::operator&=(const EntrySet& other) {
+    for (std::size_t i = 0; i < m_words.size(); ++i) {
+        m_words[i] &= i < other.m_words.size() ? other.m_words[i] : 0;
+    }
+    return *this;
+}
+
+EntrySet& EntrySet::operator|=(const EntrySet& other) {
+    for (std::size_t i = 0; i < std::min(m_words.size(), other.m_words.size()); ++i) {
+        m_words[i] |= other.m_words[i];
+    }
+    return *this;
+}
+
+EntrySet& EntrySet::Subtract(const EntrySet& other) {
+    for (std::size_t i = 0; i < std::min(m_words.size(), other.m_words.size()); ++i) {
+        m_words[i] &= ~other.m_words[i];
+    }
+    return *this;
+}
+
+void GameLibrary::Assign(std::vector<game_info> games, const std::map<QString, QString>& titles,
+                         const std::map<QString, QString>& notes) {
+    const std::size_t count = games.size();
+
+    QCollator collator;
+    collator.setCaseSensitivity(Qt::CaseInsensitive);
+    collator.setNumericMode(true);
+
+    std::vector<QString> display_names(count);
+    std::vector<QString> serials(count);
+    std::vector<QCollatorSortKey> sort_keys;
+    sort_keys.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        serials[i] = QString::fromStdString(games[i]->info.serial);
+        if (const auto it = titles.find(serials[i]); it != titles.cend()) {
+            display_names[i] = it->second;
+        } else {
+            display_names[i] = QString::fromStdString(games[i]->info.name);
+        }
+        sort_keys.push_back(collator.sortKey(display_names[i]));
+    }
+
+    // Sort alphabetically by title (localized if available), comparing precomputed keys only
+    std::vector<std::size_t> order(count);
+    std::iota(order.begin(), order.end(), std::size_t{0});
+    std::stable_sort(order.begin(), order.end(), [&](std::size_t lhs, std::size_t rhs) {
+        return sort_keys[lhs].compare(sort_keys[rhs]) < 0;
+    });
+
+    Clear();
+    m_games.reserve(count);
+    m_display_names.reserve(count);
+    m_folded_names.reserve(count);
+    m_serials.reserve(count);
+    m_folded_serials.reserve(count);
+    m_folded_notes.reserve(count);
+
+    for (const std::size_t i : order) {
+        m_games.push_back(std::move(games[i]));
+        m_folded_names.push_back(display_names[i].toLower());
+        m_display_names.push_back(std::move(display_names[i]));
+        m_folded_serials.push_back(serials[i].toLower());
+        if (const auto it = notes.find(serials[i]); it != notes.cend()) {
+            m_folded_notes.push_back(it->second.toLower());
+        } else {
+            m_folded_notes.emplace_back();
+        }
+        m_serials.push_back(std::move(serials[i]));
+    }
+
+    for (std::size_t i = 0; i < count; ++i) {
+        for (int field = 0; field < FieldCount; ++field) {
+            AddPostings(static_cast<Field>(field), i);
+        }
+    }
+    UpdateFacets();
+}
+
+void GameLibrary::Clear() {
+    m_games.clear();
+    m_display_names.clear();
+    m_folded_names.clear();
+    m_serials.clear();
+    m_folded_serials.clear();
+    m_folded_notes.clear();
+
+    for (Postings& postings : m_postings) {
+        postings.clear();
+    }
+    for (auto& facet : m_facets) {
+        facet.clear();
+    }
+    m_has_update = {};
+    m_has_custom_config = {};
+    m_last_text.clear();
+    m_last_text_result = {};
+}
+
+void GameLibrary::SetNotes(const QString& serial, const QString& notes) {
+    const QString folded_notes = notes.toLower();
+    for (std::size_t i = 0; i < m_games.size(); ++i) {
+        if (m_serials[i] != serial || m_folded_notes[i] == folded_notes) {
+            continue;
+        }
+        RemovePostings(Notes, i);
+        m_folded_notes[i] = folded_notes;
+        AddPostings(Notes, i);
+    }
+    m_last_text.clear();
+}
+
+void GameLibrary::UpdateFacets() {
+    const std::size_t count = m_games.size();
+
+    for (auto& facet : m_facets) {
+        facet.clear();
+    }
+    m_has_update = EntrySet(count);
+    m_has_custom_config = EntrySet(count);
+
+    const auto add = [this, count](Facet facet, const QString& value, std::size_t index) {
+        auto it = m_facets[facet].find(value);
+        if (it == m_facets[facet].end()) {
+            it = m_facets[facet].emplace(value, EntrySet(count)).first;
+        }
+        it->second.Set(index);
+    };
+
+    for (std::size_t i = 0; i < count; ++i) {
+        const GUIGameInfo& game = *m_games[i];
+        add(Region, QString::fromStdString(game.info.region).toLower(), i);
+        add(Firmware, QString::fromStdString(game.info.fw).toLower(), i);
+        add(Compatibility, game.compat.text.toLower(), i);
+        if (!game.info.update_path.empty()) {
+            m_has_update.Set(i);
+        }
+        if (game.has_custom_config) {
+            m_has_custom_config.Set(i);
+        }
+    }
+}
+
+EntrySet GameLibrary::Match(const QString& query) const {
+    EntrySet result(m_games.size(), true);
+
+    // Only rebuild the text part of the query if it contains facets, so the text keeps its
+    // spacing otherwise
+    QStringList text_words;
+    bool has_facets = false;
+    for (const QString& word : query.split(QChar(' '), Qt::SkipEmptyParts)) {
+        if (const qsizetype colon = word.indexOf(QChar(':')); colon > 0) {
+            EntrySet facet_result;
+            if (MatchFacet(word.left(colon).toLower(), word.mid(colon + 1).toLower(),
+                           facet_result)) {
+                result &= facet_result;
+                has_facets = true;
+                continue;
+            }
+        }
+        text_words.append(word);
+    }
+
+    const QString text = (has_facets ? text_words.join(QChar(' ')) : query).toLower();
+    if (!text.isEmpty()) {
+        result &= MatchText(text);
+    }
+    return result;
+}
+
+const QString& GameLibrary::FieldText(Field field, std::size_t index) const {
+    switch (field) {
+    case Name:
+        return m_folded_names[index];
+    case SerialField:
+        return m_folded_serials[index];
+    default:
+        return m_folded_notes[index];
+    }
+}
+
+void GameLibrary::AddPostings(Field field, std::size_t index) {
+    const QString& text = FieldText(field, index);
+    for (qsizetype i = 0; i + gram_length <= text.size(); ++i) {
+        std::vector<u32>& postings = m_postings[field][Trigram(text.constData() + i)];
+        const auto it = std::lower_bound(postings.begin(), postings.end(), index);
+        if (it == postings.end() || *it != index) {
+            postings.insert(it, static_cast<u32>(index));
+        }
+    }
+}
+
+void GameLibrary::RemovePostings(Field field, std::size_t index) {
+    const QString& text = FieldText(field, index);
+    for (qsizetype i = 0; i + gram_length <= text.size(); ++i) {
+        const auto found = m_postings[field].find(Trigram(text.constData() + i));
+        if (found == m_postings[field].end()) {
+            continue;
+        }
+        std::vector<u32>& postings = found->second;
+        const auto it = std::lower_bound(postings.begin(), postings.end(), index);
+        if (it != postings.end() && *it == index) {
+            postings.erase(it);
+        }
+        if (postings.empty()) {
+            m_postings[field].erase(found);
+        }
+    }
+}
+
+bool GameLibrary::MatchesText(std::size_t index, const QString& text) const {
+    return m_folded_names[index].contains(text) || m_folded_serials[index].contains(text) ||
+           m_folded_notes[index].contains(text);
+}
+
+EntrySet GameLibrary::MatchText(const QString& text) const {
+    EntrySet result(m_games.size());
+
+    if (!m_last_text.isEmpty() && text.contains(m_last_text) &&
+        m_last_text_result.size() == m_games.size()) {
+        // Everything matching the longer text also matched the previous one
+        m_last_text_result.ForEach([&](std::size_t index) {
+            if (MatchesText(index, text)) {
+                result.Set(index);
+            }
+        });
+    } else if (text.size() < gram_length) {
+        for (std::size_t i = 0; i < m_games.size(); ++i) {
+            if (MatchesText(i, text)) {
+                result.Set(i);
+            }
+        }
+    } else {
+        // Every trigram of the text occurs in a match, so only the entries listed for the
+        // rarest one need to be compared
+        for (int field = 0; field < FieldCount; ++field) {
+            const std::vector<u32>* rarest = nullptr;
+            for (qsizetype i = 0; i + gram_length <= text.size(); ++i) {
+                const auto it = m_postings[field].find(Trigram(text.constData() + i));
+                if (it == m_postings[field].end()) {
+                    rarest = nullptr;
+                    break;
+                }
+                if (!rarest || it->second.size() < rarest->size()) {
+                    rarest = &it->second;
+                }
+            }
+            if (!rarest) {
+                continue;
+            }
+            for (const u32 index : *rarest) {
+                if (!result.Test(index) &&
+                    FieldText(static_cast<Field>(field), index).contains(text)) {
+                    result.Set(index);
+                }
+            }
+        }
+    }
+
+    m_last_text = text;
+    m_last_text_result = result;
+    return result;
+}
+
+bool GameLibrary::MatchFacet(const QString& key, const QString& value, EntrySet& result) const {
+    if (key == QStringLiteral("is")) {
+        if (QStringLiteral("update").startsWith(value)) {
+            result = m_has_update;
+            return true;
+        }
+        if (QStringLiteral("custom").startsWith(value)) {
+            result = m_has_custom_config;
+            return true;
+        }
+        return false;
+    }
+
+    Facet facet;
+    if (key == QStringLiteral("region")) {
+        facet = Region;
+    } else if (key == QStringLiteral("fw")) {
+        facet = Firmware;
+    } else if (key == QStringLiteral("compat")) {
+        facet = Compatibility;
+    } else {
+        return false;
+    }
+
+    // Values are few, so the prefix match can look at all of them
+    result = EntrySet(m_games.size());
+    for (const auto& [facet_value, entries] : m_facets[facet]) {
+        if (facet_value.startsWith(value)) {
+            result |= entries;
+        }
+    }
+    return true;
+}
@@ -0,0 +1,157 @@
+// SPDX-FileCopyrightText: Copyright 2025-2026 shadLauncher4 Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+#include <bit>
+#include <map>
+#include <unordered_map>
+#include <vector>
+#include <QString>
+
+#include "common/types.h"
+#include "gui_game_info.h"
+
+/** Set of library entries with one bit per game index, so sets combine 64 entries at a time */
+class EntrySet {
+public:
+    EntrySet() = default;
+    explicit EntrySet(std::size_t size, bool filled = false);
+
+    std::size_t size() const {
+        return m_size;
+    }
+
+    bool Test(std::size_t index) const {
+        return (m_words[index / 64] >> (index % 64)) & 1;
+    }
+    void Set(std::size_t index) {
+        m_words[index / 64] |= u64{1} << (index % 64);
+    }
+    void Reset(std::size_t index) {
+        m_words[index / 64] &= ~(u64{1} << (index % 64));
+    }
+
+    bool None() const;
+
+    EntrySet& operator&=(const EntrySet& other);
+    EntrySet& operator|=(const EntrySet& other);
+    /** Removes the entries of other */
+    EntrySet& Subtract(const EntrySet& other);
+
+    /** Calls func with the index of every entry in the set, in ascending order */
+    template <typename Func>
+    void ForEach(Func&& func) const {
+        for (std::size_t word = 0; word < m_words.size(); ++word) {
+            for (u64 bits = m_words[word]; bits != 0; bits &= bits - 1) {
+                func(word * 64 + static_cast<std::size_t>(std::countr_zero(bits)));
+            }
+        }
+    }
+
+private:
+    std::vector<u64> m_words;
+    std::size_t m_size{};
+};
+
+/**
+ * The parsed game library.
+ *
+ * Besides the games themselves it keeps struct-of-arrays columns of the values that sorting and
+ * filtering touch for every entry, so those passes walk contiguous arrays instead of chasing a
+ * shared_ptr and converting std::strings per comparison. Column values are addressed by the
+ * index of the game in Games().
+ *
+ * Searching goes through an index built along with the columns: trigram postings of the case
+ * folded names, serials and notes, and a set of entries per facet value.
+ */
+class GameLibrary {
+public:
+    /**
+     * Replaces the library contents, rebuilds the columns and the search index and sorts by
+     * display name
+     */
+    void Assign(std::vector<game_info> games, const std::map<QString, QString>& titles,
+                const std::map<QString, QString>& notes);
+    void Clear();
+
+    const std::vector<game_info>& Games() const {
+        return m_games;
+    }
+    std::size_t size() const {
+        return m_games.size();
+    }
+    bool empty() const {
+        return m_games.empty();
+    }
+    std::vector<game_info>::const_iterator begin() const {
+        return m_games.cbegin();
+    }
+    std::vector<game_info>::const_iterator end() const {
+        return m_games.cend();
+    }
+    const game_info& operator[](std::size_t index) const {
+        return m_games[index];
+    }
+
+    /** Custom title if one is set, otherwise the title from param.sfo */
+    const QString& DisplayName(std::size_t index) const {
+        return m_display_names[index];
+    }
+    const QString& FoldedName(std::size_t index) const {
+        return m_folded_names[index];
+    }
+    const QString& Serial(std::size_t index) const {
+        return m_serials[index];
+    }
+    const QString& FoldedSerial(std::size_t index) const {
+        return m_folded_serials[index];
+    }
+
+    /** Re-indexes the notes of every game with this serial */
+    void SetNotes(const QString& serial, const QString& notes);
+    /** Rebuilds the facets of the values that change after parsing, like compatibility */
+    void UpdateFacets();
+
+    /**
+     * Returns the entries matching a search box query. Words of the form key:value restrict the
+     * result to a facet, matching values by prefix:
+     * - region:<name>, fw:<version>, compat:<status>
+     * - is:update, is:custom (games with a custom config)
+     * The rest of the query has to be part of the name, the serial or the notes of a game.
+     */
+    EntrySet Match(const QString& query) const;
+
+private:
+    enum Field { Name, SerialField, Notes, FieldCount };
+    enum Facet { Region, Firmware, Compatibility, FacetCount };
+    using Postings = std::unordered_map<u64, std::vector<u32>>;
+
+    const QString& FieldText(Field field, std::size_t index) const;
+    void AddPostings(Field field, std::size_t index);
+    void RemovePostings(Field field, std::size_t index);
+    bool MatchesText(std::size_t index, const QString& text) const;
+    EntrySet MatchText(const QString& text) const;
+    /** Returns false if key is no facet */
+    bool MatchFacet(const QString& key, const QString& value, EntrySet& result) const;
+
+    std::vector<game_info> m_games;
+
+    // Hot columns
+    std::vector<QString> m_display_names;
+    std::vector<QString> m_folded_names;
+    std::vector<QString> m_serials;
+    std::vector<QString> m_folded_serials;
+    std::vector<QString> m_folded_notes;
+
+    // Search index
+    std::array<Postings, FieldCount> m_postings;
+    std::array<std::map<QString, EntrySet>, FacetCount> m_facets; // Keyed by folded value
+    EntrySet m_has_update;
+    EntrySet m_has_custom_config;
+
+    // The previous text query. Typing narrows a query, so its result bounds the next one.
+    mutable QString m_last_text;
+    mutable EntrySet m_last_text_result;
+};
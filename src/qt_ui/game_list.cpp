@@ -4,17 +4,80 @@
 
 #include "game_item.h"
 #include "game_list.h"
+#include "game_list_table_model.h"
 
 #include <QApplication>
 #include <QHeaderView>
 #include <QMenu>
 
-GameList::GameList() : QTableWidget(), GameListBase() {
-    m_icon_ready_callback = [this](const game_info& game, const GameItemBase* item) {
-        Q_EMIT IconReady(game, item);
+GameList::GameList() : QTableView(), GameListBase() {
+    m_model = new GameListTableModel(this);
+    m_filter_model = new GameListFilterModel(this);
+    m_filter_model->setSourceModel(m_model);
+    setModel(m_filter_model);
+
+    m_icon_ready_callback = [this](const game_info& game, const GameItemBase* item,
+                                   const QImage& image, const QList<QImage>& mips) {
+        Q_EMIT IconReady(game, item, image, mips);
     };
 }
 
+int GameList::rowCount() const {
+    return m_filter_model->rowCount();
+}
+
+int GameList::columnCount() const {
+    return m_model->columnCount();
+}
+
+void GameList::SetColumnHeader(GUI::GameListColumns column, const QString& text) {
+    m_model->setHeaderData(static_cast<int>(column), Qt::Horizontal, text);
+}
+
+void GameList::SetFilter(std::function<bool(std::size_t index)> filter) {
+    m_filter_model->SetFilter(std::move(filter));
+}
+
+game_info GameList::Game(const QModelIndex& index) const {
+    if (const QVariant var = index.data(GUI::game_role); var.canConvert<game_info>()) {
+        return var.value<game_info>();
+    }
+    return nullptr;
+}
+
+game_info GameList::SelectedGame() const {
+    const QModelIndex current = currentIndex();
+    if (!current.isValid() || !selectionModel()->isRowSelected(current.row())) {
+        return nullptr;
+    }
+    return Game(current);
+}
+
+std::vector<game_info> GameList::NeighbourGames(int count) const {
+    std::vector<game_info> games;
+    const int current = currentIndex().row();
+    if (current < 0) {
+        return games;
+    }
+    for (int distance = 1; distance <= count; ++distance) {
+        for (const int row : {current + distance, current - distance}) {
+            if (row >= 0 && row < model()->rowCount()) {
+                games.push_back(Game(model()->index(row, 0)));
+            }
+        }
+    }
+    return games;
+}
+
+GameItem* GameList::Item(int row) const {
+    return m_model->Item(m_filter_model->mapToSource(m_filter_model->index(row, 0)).row());
+}
+
+GameItem* GameList::ExistingItem(int row) const {
+    return m_model->ExistingItem(
+        m_filter_model->mapToSource(m_filter_model->index(row, 0)).row());
+}
+
 void GameList::SyncHeaderActions(QList<QAction*>& actions,
                                  std::function<bool(int)> get_visibility) {
     bool is_dirty = false;
@@ -84,9 +147,8 @@ void GameList::CreateHeaderActions(QList<QAction*>& actions,
 }
 
 void GameList::ClearList() {
-
     clearSelection();
-    clearContents();
+    m_model->Clear();
 }
 
 void GameList::FixNarrowColumns() {
@@ -106,23 +168,22 @@ void GameList::FixNarrowColumns() {
 }
 
 void GameList::mousePressEvent(QMouseEvent* event) {
-    if (QTableWidgetItem* item = itemAt(event->pos());
-        !item || !item->data(Qt::UserRole).isValid()) {
+    if (!indexAt(event->pos()).isValid()) {
         clearSelection();
-        setCurrentItem(nullptr); // Needed for currentItemChanged
+        setCurrentIndex({}); // Needed for currentChanged
     }
-    QTableWidget::mousePressEvent(event);
+    QTableView::mousePressEvent(event);
 }
 
 void GameList::mouseMoveEvent(QMouseEvent* event) {
-    QTableWidget::mouseMoveEvent(event);
+    QTableView::mouseMoveEvent(event);
 }
 
 void GameList::mouseDoubleClickEvent(QMouseEvent* ev) {
     if (!ev)
         return;
 
-    // Qt's itemDoubleClicked signal doesn't distinguish between mouse buttons and there is no
+    // Qt's doubleClicked signal doesn't distinguish between mouse buttons and there is no
     // simple way to get the pressed button. So we have to ignore this event when another button is
     // pressed.
     if (ev->button() != Qt::LeftButton) {
@@ -130,7 +191,7 @@ void GameList::mouseDoubleClickEvent(QMouseEvent* ev) {
         return;
     }
 
-    QTableWidget::mouseDoubleClickEvent(ev);
+    QTableView::mouseDoubleClickEvent(ev);
 }
 
 void GameList::keyPressEvent(QKeyEvent* event) {
@@ -141,16 +202,16 @@ void GameList::keyPressEvent(QKeyEvent* event) {
         return;
     }
 
-    QTableWidget::keyPressEvent(event);
+    QTableView::keyPressEvent(event);
 }
 
 void GameList::leaveEvent(QEvent* event) {
-    QTableWidget::leaveEvent(event);
+    QTableView::leaveEvent(event);
 }
 
 void GameList::FocusAndSelectFirstEntryIfNoneIs() {
-    if (QTableWidgetItem* item = itemAt(0, 0); item && selectedIndexes().isEmpty()) {
-        setCurrentItem(item);
+    if (const QModelIndex first = indexAt({0, 0}); first.isValid() && selectedIndexes().isEmpty()) {
+        setCurrentIndex(first);
     }
 
     setFocus();
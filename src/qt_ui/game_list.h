@@ -8,20 +8,44 @@
 #include <QKeyEvent>
 #include <QList>
 #include <QMouseEvent>
-#include <QTableWidget>
+#include <QTableView>
 
 #include "game_list_base.h"
+#include "gui_settings.h"
 
 #include <functional>
 
 class GameItem;
+class GameListFilterModel;
+class GameListTableModel;
 
-class GameList : public QTableWidget, public GameListBase {
+class GameList : public QTableView, public GameListBase {
     Q_OBJECT
 
 public:
     GameList();
 
+    int rowCount() const;
+    int columnCount() const;
+
+    void SetColumnHeader(GUI::GameListColumns column, const QString& text);
+
+    /** Only shows the games for which filter returns true. It takes the index of a game in the
+     * game data passed to Populate. */
+    void SetFilter(std::function<bool(std::size_t index)> filter);
+
+    /** Game shown in the row of index, if any */
+    game_info Game(const QModelIndex& index) const;
+    /** Returns the game of the selected row, if any */
+    game_info SelectedGame() const;
+    /** Games in the rows around the current one, nearest first */
+    std::vector<game_info> NeighbourGames(int count) const;
+
+    /** Returns the icon state of a row, creating it on first use */
+    GameItem* Item(int row) const;
+    /** Returns the icon state of a row if it was created already */
+    GameItem* ExistingItem(int row) const;
+
     void SyncHeaderActions(QList<QAction*>& actions, std::function<bool(int)> get_visibility);
     void CreateHeaderActions(QList<QAction*>& actions, std::function<bool(int)> get_visibility,
                              std::function<void(int, bool)> set_visibility);
@@ -36,7 +60,8 @@ public Q_SLOTS:
 
 Q_SIGNALS:
     void FocusToSearchBar();
-    void IconReady(const game_info& game, const GameItemBase* item);
+    void IconReady(const game_info& game, const GameItemBase* item, const QImage& image,
+                   const QList<QImage>& mips);
 
 protected:
     void mousePressEvent(QMouseEvent* event) override;
@@ -44,4 +69,7 @@ protected:
     void mouseDoubleClickEvent(QMouseEvent* event) override;
     void keyPressEvent(QKeyEvent* event) override;
     void leaveEvent(QEvent* event) override;
+
+    GameListTableModel* m_model{};
+    GameListFilterModel* m_filter_model{};
 };
@@ -3,26 +3,51 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include "game_list_base.h"
+#include "icon_cache.h"
+#include "icon_memory_cache.h"
 
 #include <QDir>
 #include <QPainter>
 
+#include <array>
 #include <cmath>
+#include <map>
+#include <mutex>
 #include <unordered_set>
 
+namespace {
+
+// Returns a config overlay scaled to a square of the given pixel size. Every icon of a size uses
+// the same few overlays, so they are only smooth scaled once.
+QImage ScaledOverlay(const QString& path, int pixel_size) {
+    static std::mutex mutex;
+    static std::map<std::pair<QString, int>, QImage> overlays;
+
+    std::lock_guard lock(mutex);
+    auto [it, inserted] = overlays.try_emplace({path, pixel_size});
+    if (inserted) {
+        it->second = QImage(path).scaled(QSize(pixel_size, pixel_size), Qt::KeepAspectRatio,
+                                         Qt::TransformationMode::SmoothTransformation);
+    }
+    return it->second;
+}
+
+} // namespace
+
 GameListBase::GameListBase() {}
 
-void GameListBase::RepaintIcons(std::vector<game_info>& game_data, const QColor& icon_color,
-                                const QSize& icon_size, qreal device_pixel_ratio) {
+void GameListBase::RepaintIcons(const std::vector<game_info>& game_data,
+                                const QColor& icon_color, const QSize& icon_size,
+                                qreal device_pixel_ratio) {
     m_icon_size = icon_size;
     m_icon_color = icon_color;
 
-    QPixmap placeholder(icon_size * device_pixel_ratio);
-    placeholder.setDevicePixelRatio(device_pixel_ratio);
-    placeholder.fill(Qt::transparent);
+    m_icon_placeholder = QPixmap(icon_size * device_pixel_ratio);
+    m_icon_placeholder.setDevicePixelRatio(device_pixel_ratio);
+    m_icon_placeholder.fill(Qt::transparent);
 
-    for (game_info& game : game_data) {
-        game->pxmap = placeholder;
+    for (const game_info& game : game_data) {
+        game->pxmap = m_icon_placeholder;
 
         if (GameItemBase* item = game->item) {
             item->setIconLoadFunc(
@@ -41,8 +66,35 @@ void GameListBase::IconLoadFunction(game_info game, qreal device_pixel_ratio,
         return;
     }
 
-    if (game->icon.isNull() && (game->info.icon_path.empty() ||
-                                !game->icon.load(QString::fromStdString(game->info.icon_path)))) {
+    const QColor color = GetGridCompatibilityColor(game->compat.color);
+
+    IconCache::Key key;
+    key.icon_path = game->info.icon_path;
+    key.size = m_icon_size;
+    key.device_pixel_ratio = device_pixel_ratio;
+    key.config_overlay = !m_is_list_layout && game->has_custom_config;
+    key.pad_config_overlay = !m_is_list_layout && game->has_custom_pad_config;
+    key.compat_color = color;
+    key.background_color = m_icon_color;
+    const bool cacheable = !key.icon_path.empty() && key.ReadIconTime();
+
+    // A cached composition skips decoding ICON0.PNG, painting and scaling altogether
+    if (cacheable) {
+        if (std::optional<QImage> image = IconCache::Instance().Load(key)) {
+            if (game->item && (!cancel || !cancel->load()) && m_icon_ready_callback) {
+                m_icon_ready_callback(game, game->item, *image, IconMips(*image, image->width()));
+            }
+            return;
+        }
+    }
+
+    // QImage can be decoded and painted off the GUI thread, QPixmap can not
+    IconMemoryCache& memory_cache = IconMemoryCache::Instance();
+    QImage icon = memory_cache.Source(game->info.icon_path);
+    if (icon.isNull() && !game->info.icon_path.empty()) {
+        if (icon.load(QString::fromStdString(game->info.icon_path))) {
+            memory_cache.StoreSource(game->info.icon_path, icon);
+        }
         // TODO log if fails?
     }
 
@@ -50,22 +102,23 @@ void GameListBase::IconLoadFunction(game_info game, qreal device_pixel_ratio,
         return;
     }
 
-    const QColor color = GetGridCompatibilityColor(game->compat.color);
-    {
-        std::lock_guard lock(game->item->pixmap_mutex);
-        game->pxmap = PaintedPixmap(game->icon, device_pixel_ratio, game->has_custom_config,
-                                    game->has_custom_pad_config, color);
+    QList<QImage> mips;
+    const QImage image = PaintedImage(icon, device_pixel_ratio, game->has_custom_config,
+                                      game->has_custom_pad_config, color, &mips);
+
+    if (cacheable && !icon.isNull()) {
+        IconCache::Instance().Store(key, image);
     }
 
     if (!cancel || !cancel->load()) {
         if (m_icon_ready_callback)
-            m_icon_ready_callback(game, game->item);
+            m_icon_ready_callback(game, game->item, image, mips);
     }
 }
 
-QPixmap GameListBase::PaintedPixmap(const QPixmap& icon, qreal device_pixel_ratio,
-                                    bool paint_config_icon, bool paint_pad_config_icon,
-                                    const QColor& compatibility_color) const {
+QImage GameListBase::PaintedImage(const QImage& icon, qreal device_pixel_ratio,
+                                  bool paint_config_icon, bool paint_pad_config_icon,
+                                  const QColor& compatibility_color, QList<QImage>* mips) const {
     QSize canvas_size(320, 176);
     QSize icon_size(icon.size());
     QPoint target_pos;
@@ -94,7 +147,7 @@ QPixmap GameListBase::PaintedPixmap(const QPixmap& icon, qreal device_pixel_rati
     }
 
     // Create a canvas large enough to fit our entire scaled icon
-    QPixmap canvas(canvas_size * device_pixel_ratio);
+    QImage canvas(canvas_size * device_pixel_ratio, QImage::Format_ARGB32_Premultiplied);
     canvas.setDevicePixelRatio(device_pixel_ratio);
     canvas.fill(m_icon_color);
 
@@ -104,8 +157,7 @@ QPixmap GameListBase::PaintedPixmap(const QPixmap& icon, qreal device_pixel_rati
 
     // Draw the icon onto our canvas
     if (!icon.isNull()) {
-        painter.drawPixmap(target_pos.x(), target_pos.y(), icon_size.width(), icon_size.height(),
-                           icon);
+        painter.drawImage(QRect(target_pos, icon_size), icon);
     }
 
     // Draw config icons if necessary
@@ -122,12 +174,10 @@ QPixmap GameListBase::PaintedPixmap(const QPixmap& icon, qreal device_pixel_rati
             icon_path = ":/images/controllers.png";
         }
 
-        QPixmap custom_config_icon(icon_path);
+        QImage custom_config_icon =
+            ScaledOverlay(icon_path, static_cast<int>(width * device_pixel_ratio));
         custom_config_icon.setDevicePixelRatio(device_pixel_ratio);
-        painter.drawPixmap(origin,
-                           custom_config_icon.scaled(QSize(width, width) * device_pixel_ratio,
-                                                     Qt::KeepAspectRatio,
-                                                     Qt::TransformationMode::SmoothTransformation));
+        painter.drawImage(origin, custom_config_icon);
     }
 
     // Draw game compatibility icons if necessary
@@ -147,8 +197,83 @@ QPixmap GameListBase::PaintedPixmap(const QPixmap& icon, qreal device_pixel_rati
     painter.end();
 
     // Scale and return our final image
-    return canvas.scaled(m_icon_size * device_pixel_ratio, Qt::KeepAspectRatio,
-                         Qt::TransformationMode::SmoothTransformation);
+    QImage image = canvas.scaled(m_icon_size * device_pixel_ratio, Qt::KeepAspectRatio,
+                                 Qt::TransformationMode::SmoothTransformation);
+    if (mips) {
+        // Built from the full size canvas, so zooming in shows sharper levels than the final image
+        *mips = IconMips(canvas, image.width() * 2);
+    }
+    return image;
+}
+
+QList<QImage> GameListBase::IconMips(const QImage& image, int max_width) {
+    static constexpr std::array<int, 4> mip_widths = {512, 256, 128, 64};
+
+    QList<QImage> mips;
+    QImage level = image;
+    for (const int width : mip_widths) {
+        if (width > max_width || width >= level.width()) {
+            continue;
+        }
+        // Each level is scaled from the previous one, which is cheaper than from the full image
+        level = level.scaledToWidth(width, Qt::TransformationMode::SmoothTransformation);
+        mips.prepend(level);
+    }
+    return mips;
+}
+
+const QPixmap* GameListBase::NearestIconMip(const GameItemBase* item, int width) {
+    const std::vector<QPixmap>& mips = item->getIconMips();
+    if (mips.empty()) {
+        return nullptr;
+    }
+    for (const QPixmap& mip : mips) {
+        if (mip.width() >= width) {
+            return &mip;
+        }
+    }
+    return &mips.back();
+}
+
+void GameListBase::TrackIcon(GameItemBase* item, const QImage& image,
+                             const QList<QImage>& mips) {
+    u64 bytes = static_cast<u64>(image.sizeInBytes());
+    std::vector<QPixmap> mip_pixmaps;
+    mip_pixmaps.reserve(mips.size());
+    for (const QImage& mip : mips) {
+        mip_pixmaps.push_back(QPixmap::fromImage(mip));
+        bytes += static_cast<u64>(mip.sizeInBytes());
+    }
+    item->setIconMips(std::move(mip_pixmaps));
+
+    IconMemoryCache::Instance().TrackIcon(item, bytes, [this, item] { ReleaseIcon(item); });
+}
+
+bool GameListBase::UpdateIconPrefetch(GameItemBase* item, int index, int distance, int page) {
+    if (!item) {
+        return false;
+    }
+    if (distance == 0) {
+        IconMemoryCache::Instance().Touch(item);
+        return false;
+    }
+    if (distance <= page) {
+        item->getIconLoadFunc(index, IconDecodePool::Priority::NearViewport);
+        return false;
+    }
+    return item->cancelPendingIconLoad();
+}
+
+void GameListBase::DrawBackground(QPainter& painter, const QImage& image, const QRect& area) {
+    if (image.cacheKey() != m_background_key || area.size() != m_background_area) {
+        m_background = QPixmap::fromImage(image).scaled(
+            area.size(), Qt::KeepAspectRatioByExpanding, Qt::SmoothTransformation);
+        m_background_key = image.cacheKey();
+        m_background_area = area.size();
+    }
+    const int x = area.x() + (area.width() - m_background.width()) / 2;
+    const int y = area.y() + (area.height() - m_background.height()) / 2;
+    painter.drawPixmap(x, y, m_background);
 }
 
 QColor GameListBase::GetGridCompatibilityColor(const QString& string) const {
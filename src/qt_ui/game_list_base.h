@@ -7,6 +7,10 @@
 #include "gui_game_info.h"
 
 #include <QIcon>
+#include <QImage>
+#include <QList>
+#include <QPainter>
+#include <QPixmap>
 #include <QWidget>
 
 class GameListBase {
@@ -29,23 +33,58 @@ public:
         m_draw_compat_status_to_grid = enabled;
     }
 
-    virtual void RepaintIcons(std::vector<game_info>& game_data, const QColor& icon_color,
+    virtual void RepaintIcons(const std::vector<game_info>& game_data, const QColor& icon_color,
                               const QSize& icon_size, qreal device_pixel_ratio);
 
+    /** Cheaply shows the icons at another size while the zoom slider moves, by scaling the nearest
+     * mip level of each icon. RepaintIcons composes them properly once the slider settles. */
+    virtual void PreviewIconSize([[maybe_unused]] const QSize& icon_size,
+                                 [[maybe_unused]] qreal device_pixel_ratio) {}
+
     /** Sets the custom config icon. */
     static QIcon GetCustomConfigIcon(const game_info& game);
 
 protected:
     void IconLoadFunction(game_info game, qreal device_pixel_ratio,
                           std::shared_ptr<std::atomic<bool>> cancel);
-    QPixmap PaintedPixmap(const QPixmap& icon, qreal device_pixel_ratio,
-                          bool paint_config_icon = false, bool paint_pad_config_icon = false,
-                          const QColor& compatibility_color = {}) const;
+    QImage PaintedImage(const QImage& icon, qreal device_pixel_ratio,
+                        bool paint_config_icon = false, bool paint_pad_config_icon = false,
+                        const QColor& compatibility_color = {},
+                        QList<QImage>* mips = nullptr) const;
     QColor GetGridCompatibilityColor(const QString& string) const;
 
-    std::function<void(const game_info&, const GameItemBase*)> m_icon_ready_callback{};
+    /** Draws the background art centered and scaled to cover area. The scaled art is kept until
+     * the art or the size of area changes, so scrolling does not scale it again. */
+    void DrawBackground(QPainter& painter, const QImage& image, const QRect& area);
+
+    /** Prefetches the icon of an item within a page of the viewport and drops the queued load of
+     * an item further away. Visible items request their icon when painted. Returns true if a
+     * queued load was dropped. */
+    static bool UpdateIconPrefetch(GameItemBase* item, int index, int distance, int page);
+
+    /** Downscales image to the mip widths below max_width, smallest first */
+    static QList<QImage> IconMips(const QImage& image, int max_width);
+    /** Returns the smallest mip level of the item at least width pixels wide, or its largest */
+    static const QPixmap* NearestIconMip(const GameItemBase* item, int width);
+
+    /** Hands the mip levels to an item that now shows its icon and accounts for both in the icon
+     * memory budget */
+    void TrackIcon(GameItemBase* item, const QImage& image, const QList<QImage>& mips);
+    /** Called when the icon of an item was evicted from memory. Shows the placeholder instead and
+     * lets the item load its icon again. */
+    virtual void ReleaseIcon([[maybe_unused]] GameItemBase* item) {}
+
+    /** Called on a worker thread with the composed icon and its mip levels, which must become
+     * QPixmaps on the GUI thread */
+    std::function<void(const game_info&, const GameItemBase*, const QImage&,
+                       const QList<QImage>&)>
+        m_icon_ready_callback{};
     bool m_draw_compat_status_to_grid{};
     bool m_is_list_layout{};
     QSize m_icon_size{};
     QColor m_icon_color{};
+    QPixmap m_icon_placeholder{}; // Shared by every item without an icon
+    QPixmap m_background{};
+    qint64 m_background_key{}; // Art and view size m_background was scaled for
+    QSize m_background_area{};
 };
@@ -3,43 +3,29 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include "game_item.h"
+#include "game_list.h"
 #include "game_list_delegate.h"
 #include "gui_settings.h"
 
-#include <QHeaderView>
-
 GameListDelegate::GameListDelegate(QObject* parent) : TableItemDelegate(parent, true) {}
 
 void GameListDelegate::paint(QPainter* painter, const QStyleOptionViewItem& option,
                              const QModelIndex& index) const {
     TableItemDelegate::paint(painter, option, index);
 
-    // Find out if the icon or size items are visible
-    if (index.column() == static_cast<int>(GUI::GameListColumns::dir_size) ||
-        (m_has_icons && index.column() == static_cast<int>(GUI::GameListColumns::icon))) {
-        if (const QTableWidget* table = static_cast<const QTableWidget*>(parent())) {
-            // We need to remove the headers from our calculation. The visualItemRect starts at 0,0
-            // while the visibleRegion doesn't.
-            QRegion visible_region = table->visibleRegion();
-            visible_region.translate(-table->verticalHeader()->width(),
-                                     -table->horizontalHeader()->height());
-
-            if (const QTableWidgetItem* current_item = table->item(index.row(), index.column());
-                current_item &&
-                visible_region.boundingRect().intersects(table->visualItemRect(current_item))) {
-                if (GameItem* item = static_cast<GameItem*>(
-                        table->item(index.row(), static_cast<int>(GUI::GameListColumns::icon)))) {
-                    if (index.column() == static_cast<int>(GUI::GameListColumns::dir_size)) {
-                        if (!item->getSizeOnDiskLoading()) {
-                            item->getSizeCalcFunc();
-                        }
-                    } else if (m_has_icons &&
-                               index.column() == static_cast<int>(GUI::GameListColumns::icon)) {
-                        if (!item->getIconLoading()) {
-                            item->getIconLoadFunc(index.row());
-                        }
-                    }
+    // The view only paints cells inside its viewport, so the row is visible
+    const int column = index.column();
+    if (column == static_cast<int>(GUI::GameListColumns::dir_size) ||
+        (m_has_icons && column == static_cast<int>(GUI::GameListColumns::icon))) {
+        if (const GameList* table = static_cast<const GameList*>(parent())) {
+            GameItem* item = table->Item(index.row());
+            if (column == static_cast<int>(GUI::GameListColumns::dir_size)) {
+                if (!item->getSizeOnDiskLoading()) {
+                    item->getSizeCalcFunc();
                 }
+            } else {
+                // Also moves a prefetched load up once the row becomes visible
+                item->getIconLoadFunc(index.row());
             }
         }
     }
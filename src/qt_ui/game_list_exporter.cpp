@@ -81,52 +81,57 @@ void GameListExporter::ExportToFile(bool asCsv, int sortIndex, bool ascending,
 
     QTextStream out(&file);
 
-    std::vector<game_info> sortedGames = m_gameListFrame->GetGameInfo();
-
-    std::sort(
-        sortedGames.begin(), sortedGames.end(),
-        [sortIndex, ascending](const game_info& a, const game_info& b) {
-            const GameInfo& ga = a->info;
-            const GameInfo& gb = b->info;
-
-            auto cmp = [&](const QString& va, const QString& vb) {
-                return ascending ? va.localeAwareCompare(vb) < 0 : va.localeAwareCompare(vb) > 0;
-            };
-
-            switch (sortIndex) {
-            case 0:
-                return cmp(QString::fromStdString(ga.name), QString::fromStdString(gb.name));
-            case 1:
-                return cmp(QString::fromStdString(ga.serial), QString::fromStdString(gb.serial));
-            case 2:
-                return cmp(QString::fromStdString(ga.fw), QString::fromStdString(gb.fw));
-            case 3:
-                return cmp(QString::fromStdString(ga.app_ver), QString::fromStdString(gb.app_ver));
-            case 4:
-                return cmp(QString::fromStdString(ga.sdk_ver), QString::fromStdString(gb.sdk_ver));
-            case 5:
-                return cmp(QString::fromStdString(ga.category),
-                           QString::fromStdString(gb.category));
-            case 6:
-                return cmp(QString::fromStdString(ga.region), QString::fromStdString(gb.region));
-            case 7: {
-                auto joinNpCommIds = [](const std::vector<std::string>& ids) -> QString {
-                    if (ids.empty())
-                        return "";
-                    QString result = QString::fromStdString(ids[0]);
-                    for (size_t i = 1; i < ids.size(); ++i) {
-                        result += "," + QString::fromStdString(ids[i]);
-                    }
-                    return result;
-                };
-                return cmp(joinNpCommIds(ga.np_comm_ids), joinNpCommIds(gb.np_comm_ids));
-            }
-            case 8:
-                return cmp(QString::fromStdString(ga.path), QString::fromStdString(gb.path));
-            default:
-                return false;
-            }
-        });
+    const std::vector<game_info>& games = m_gameListFrame->GetGameInfo();
+
+    // Convert every value that takes part in the sort once, instead of twice per comparison
+    std::vector<ExportEntry> sortedGames;
+    sortedGames.reserve(games.size());
+    for (const game_info& game : games) {
+        const GameInfo& info = game->info;
+        ExportEntry& entry = sortedGames.emplace_back();
+        entry.game = game;
+        entry.np_comm_ids = JoinNpCommIds(GameInfoTools::ReadNpCommIds(info));
+
+        switch (sortIndex) {
+        case 0:
+            entry.sort_key = QString::fromStdString(info.name);
+            break;
+        case 1:
+            entry.sort_key = QString::fromStdString(info.serial);
+            break;
+        case 2:
+            entry.sort_key = QString::fromStdString(info.fw);
+            break;
+        case 3:
+            entry.sort_key = QString::fromStdString(info.app_ver);
+            break;
+        case 4:
+            entry.sort_key = QString::fromStdString(info.sdk_ver);
+            break;
+        case 5:
+            entry.sort_key = QString::fromStdString(info.category);
+            break;
+        case 6:
+            entry.sort_key = QString::fromStdString(info.region);
+            break;
+        case 7:
+            entry.sort_key = entry.np_comm_ids;
+            break;
+        case 8:
+            entry.sort_key = QString::fromStdString(info.path);
+            break;
+        default:
+            break;
+        }
+    }
+
+    if (sortIndex >= 0 && sortIndex <= 8) {
+        std::sort(sortedGames.begin(), sortedGames.end(),
+                  [ascending](const ExportEntry& a, const ExportEntry& b) {
+                      const int result = a.sort_key.localeAwareCompare(b.sort_key);
+                      return ascending ? result < 0 : result > 0;
+                  });
+    }
 
     if (asCsv)
         WriteCsv(out, sortedGames, sortIndex, ascending, includeCompat);
@@ -145,7 +150,17 @@ QString GameListExporter::EscapeCsv(const QString& s) {
     return "\"" + escaped + "\"";
 }
 
-void GameListExporter::WriteTxt(QTextStream& out, const std::vector<game_info>& games,
+QString GameListExporter::JoinNpCommIds(const std::vector<std::string>& ids) {
+    if (ids.empty())
+        return "";
+    QString result = QString::fromStdString(ids[0]);
+    for (size_t i = 1; i < ids.size(); ++i) {
+        result += "," + QString::fromStdString(ids[i]);
+    }
+    return result;
+}
+
+void GameListExporter::WriteTxt(QTextStream& out, const std::vector<ExportEntry>& games,
                                 int sortIndex, bool ascending, bool includeCompat) {
     QProgressDialog progressDlg("Exporting game list...", "Cancel", 0,
                                 static_cast<int>(games.size()));
@@ -212,25 +227,16 @@ void GameListExporter::WriteTxt(QTextStream& out, const std::vector<game_info>&
         if (progressDlg.wasCanceled())
             return;
 
-        const auto& g = games[i];
+        const auto& g = games[i].game;
 
         QString qpath;
         Common::FS::PathToQString(qpath, g->info.path);
 
-        auto joinNpCommIds = [](const std::vector<std::string>& ids) -> QString {
-            if (ids.empty())
-                return "";
-            QString result = QString::fromStdString(ids[0]);
-            for (size_t i = 1; i < ids.size(); ++i) {
-                result += "," + QString::fromStdString(ids[i]);
-            }
-            return result;
-        };
         QStringList row = {
             QString::fromStdString(g->info.name),    QString::fromStdString(g->info.serial),
             QString::fromStdString(g->info.fw),      QString::fromStdString(g->info.app_ver),
             QString::fromStdString(g->info.sdk_ver), QString::fromStdString(g->info.category),
-            QString::fromStdString(g->info.region),  joinNpCommIds(g->info.np_comm_ids)};
+            QString::fromStdString(g->info.region),  games[i].np_comm_ids};
 
         if (includeCompat) {
             row << g->compat.text << g->compat.latest_version << g->compat.last_tested_date
@@ -297,7 +303,7 @@ void GameListExporter::WriteTxt(QTextStream& out, const std::vector<game_info>&
     progressDlg.setValue(static_cast<int>(games.size()));
 }
 
-void GameListExporter::WriteCsv(QTextStream& out, const std::vector<game_info>& sortedGames,
+void GameListExporter::WriteCsv(QTextStream& out, const std::vector<ExportEntry>& sortedGames,
                                 int sortIndex, bool ascending, bool includeCompat) {
     if (sortedGames.empty())
         return;
@@ -308,16 +314,6 @@ void GameListExporter::WriteCsv(QTextStream& out, const std::vector<game_info>&
         return "\"" + escaped + "\"";
     };
 
-    auto joinNpCommIds = [](const std::vector<std::string>& ids) -> QString {
-        if (ids.empty())
-            return "";
-        QString result = QString::fromStdString(ids[0]);
-        for (size_t i = 1; i < ids.size(); ++i) {
-            result += "," + QString::fromStdString(ids[i]);
-        }
-        return result;
-    };
-
     // --- Define headers dynamically ---
     QStringList headers = {"Name",    "Serial",   "Firmware", "App Version",
                            "SDK Ver", "Category", "Region",   "NP Comm IDs"};
@@ -337,7 +333,7 @@ void GameListExporter::WriteCsv(QTextStream& out, const std::vector<game_info>&
 
     // --- Write rows ---
     for (int i = 0; i < sortedGames.size(); ++i) {
-        const auto& gptr = sortedGames[i];
+        const auto& gptr = sortedGames[i].game;
         const auto& info = gptr->info;
         const auto& status = gptr->compat;
 
@@ -351,7 +347,7 @@ void GameListExporter::WriteCsv(QTextStream& out, const std::vector<game_info>&
                            EscapeCsv(QString::fromStdString(info.sdk_ver)),
                            EscapeCsv(QString::fromStdString(info.category)),
                            EscapeCsv(QString::fromStdString(info.region)),
-                           EscapeCsv(joinNpCommIds(info.np_comm_ids))};
+                           EscapeCsv(sortedGames[i].np_comm_ids)};
 
         if (includeCompat) {
             row << EscapeCsv(status.text) << EscapeCsv(status.latest_version)
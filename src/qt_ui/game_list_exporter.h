@@ -28,12 +28,20 @@ public:
     void ShowExportDialog();
 
 private:
+    // A game together with the values that are expensive to produce, computed once per export
+    struct ExportEntry {
+        game_info game;
+        QString np_comm_ids;
+        QString sort_key;
+    };
+
     static QString EscapeCsv(const QString& s);
+    static QString JoinNpCommIds(const std::vector<std::string>& ids);
     void ExportToFile(bool asCsv, int sortIndex, bool ascending, const QString& filePath,
                       bool includeCompat);
-    void WriteTxt(QTextStream& out, const std::vector<game_info>& games, int sortIndex,
+    void WriteTxt(QTextStream& out, const std::vector<ExportEntry>& games, int sortIndex,
                   bool ascending, bool includeCompat);
-    void WriteCsv(QTextStream& out, const std::vector<game_info>& games, int sortIndex,
+    void WriteCsv(QTextStream& out, const std::vector<ExportEntry>& games, int sortIndex,
                   bool ascending, bool includeCompat);
 
 private:
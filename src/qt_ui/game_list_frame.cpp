@@ -17,23 +17,26 @@
 #include <QMenuBar>
 #include <QMessageBox>
 #include <QPushButton>
+#include <QScreen>
 #include <QScrollBar>
 #include <QtConcurrent>
 #include <core/user_settings.h>
 #include <fmt/core.h>
+#include "background_art_loader.h"
 #include "background_music_player.h"
 #include "change_log_dialog.h"
 #include "common/key_manager.h"
+#include "common/mapped_file.h"
 #include "common/singleton.h"
 #include "core/emulator_settings.h"
 #include "core/file_format/psf.h"
 #include "core/ipc/ipc_client.h"
 #include "game_list_frame.h"
 #include "game_list_grid.h"
-#include "game_list_grid_item.h"
 #include "game_list_table.h"
 #include "gui_application.h"
 #include "gui_settings.h"
+#include "icon_memory_cache.h"
 #include "localized.h"
 #include "npbind_dialog.h"
 #include "persistent_settings.h"
@@ -61,6 +64,13 @@
 #include "sfo_viewer_dialog.h"
 #include "trophy_viewer.h"
 
+namespace {
+
+// Games on each side of the selection whose background art is loaded ahead
+constexpr int background_art_neighbours = 2;
+
+} // namespace
+
 GameListFrame::GameListFrame(std::shared_ptr<GUISettings> gui_settings,
                              std::shared_ptr<EmulatorSettingsImpl> emu_settings,
                              std::shared_ptr<PersistentSettings> persistent_settings,
@@ -80,6 +90,9 @@ GameListFrame::GameListFrame(std::shared_ptr<GUISettings> gui_settings,
     m_sort_column = m_gui_settings->GetValue(GUI::game_list_sortCol).toInt();
     m_hidden_list =
         GUI::Utils::ListToSet(m_gui_settings->GetValue(GUI::game_list_hidden_list).toStringList());
+    IconMemoryCache::Instance().SetBudget(
+        std::max(m_gui_settings->GetValue(GUI::game_list_iconMemoryBudget).toULongLong(), 16ull) *
+        1_MB);
 
     m_old_layout_is_list = m_is_list_layout;
 
@@ -94,7 +107,7 @@ GameListFrame::GameListFrame(std::shared_ptr<GUISettings> gui_settings,
 
     m_game_grid = new GameListGrid(this, m_gui_settings);
     m_game_grid->installEventFilter(this);
-    m_game_grid->ScrollArea()->verticalScrollBar()->installEventFilter(this);
+    m_game_grid->verticalScrollBar()->installEventFilter(this);
 
     m_game_list = new GameListTable(this, m_gui_settings, m_persistent_settings);
     m_game_list->installEventFilter(this);
@@ -102,6 +115,11 @@ GameListFrame::GameListFrame(std::shared_ptr<GUISettings> gui_settings,
 
     m_game_compat = new GameCompatibility(m_gui_settings, this);
 
+    m_background_loader = new BackgroundArtLoader(background_art_neighbours, this);
+    if (const QScreen* screen = this->screen()) {
+        m_background_loader->SetMaxSize(screen->size() * screen->devicePixelRatio());
+    }
+
     m_central_widget = new QStackedWidget(this);
     m_central_widget->addWidget(m_game_list);
     m_central_widget->addWidget(m_game_grid);
@@ -138,8 +156,7 @@ GameListFrame::GameListFrame(std::shared_ptr<GUISettings> gui_settings,
     // Actions regarding showing/hiding columns
     auto add_column = [this](GUI::GameListColumns col, const QString& header_text,
                              const QString& action_text) {
-        m_game_list->setHorizontalHeaderItem(static_cast<int>(col),
-                                             new QTableWidgetItem(header_text));
+        m_game_list->SetColumnHeader(col, header_text);
         m_columnActs.append(new QAction(action_text, this));
     };
 
@@ -207,6 +224,11 @@ void GameListFrame::SaveSettings() {
 }
 
 void GameListFrame::CreateConnections() {
+    // Icons are only composed at their exact size once the zoom slider rests
+    m_resize_icons_timer.setSingleShot(true);
+    m_resize_icons_timer.setInterval(150);
+    connect(&m_resize_icons_timer, &QTimer::timeout, this, [this] { RepaintIcons(); });
+
     connect(m_game_list->horizontalHeader(), &QHeaderView::sectionClicked, this,
             &GameListFrame::OnColumnClicked);
     connect(m_game_list, &GameList::FocusToSearchBar, this, &GameListFrame::FocusToSearchBar);
@@ -220,7 +242,7 @@ void GameListFrame::CreateConnections() {
         m_path_entries.clear();
         m_path_list.clear();
         m_serials.clear();
-        m_game_data.clear();
+        m_game_data.Clear();
         m_notes.clear();
         m_games.pop_all();
     });
@@ -233,7 +255,7 @@ void GameListFrame::CreateConnections() {
 
         m_path_entries.clear();
         m_path_list.clear();
-        m_game_data.clear();
+        m_game_data.Clear();
         m_serials.clear();
         m_games.pop_all();
     });
@@ -245,7 +267,7 @@ void GameListFrame::CreateConnections() {
 
         m_path_entries.clear();
         m_path_list.clear();
-        m_game_data.clear();
+        m_game_data.Clear();
         m_serials.clear();
         m_games.pop_all();
 
@@ -266,22 +288,16 @@ void GameListFrame::CreateConnections() {
                 }
             });
     // context menu and clicks
-    connect(m_game_list, &QTableWidget::customContextMenuRequested, this,
+    connect(m_game_list, &QTableView::customContextMenuRequested, this,
             &GameListFrame::ShowContextMenu);
-    connect(m_game_list, &QTableWidget::itemDoubleClicked, this,
-            QOverload<QTableWidgetItem*>::of(&GameListFrame::DoubleClickedSlot));
-    connect(m_game_list, &QTableWidget::itemSelectionChanged, this, [this]() {
-        game_info game = nullptr;
-        if (const auto item = m_game_list->item(m_game_list->currentRow(),
-                                                static_cast<int>(GUI::GameListColumns::icon));
-            item && item->isSelected()) {
-            game = GetGameInfoByMode(item);
+    connect(m_game_list, &QTableView::doubleClicked, this, [this](const QModelIndex& index) {
+        DoubleClickedSlot(m_game_list->Game(index));
+    });
+    connect(m_game_list->selectionModel(), &QItemSelectionModel::selectionChanged, this, [this]() {
+        const game_info game = m_game_list->SelectedGame();
+        if (game) {
             PlayBackgroundMusic(game);
-            QImage bg(QString::fromUtf8(game->info.pic_path.c_str()));
-            if (!bg.isNull()) {
-                backgroundImage = bg;
-                m_game_list->update();
-            }
+            ShowBackgroundArt(game, m_game_list->NeighbourGames(background_art_neighbours));
         }
         Q_EMIT NotifyGameSelection(game);
     });
@@ -292,15 +308,26 @@ void GameListFrame::CreateConnections() {
             QOverload<const game_info&>::of(&GameListFrame::DoubleClickedSlot));
     connect(m_game_grid, &GameListGrid::ItemSelectionChanged, this, [this](game_info game) {
         PlayBackgroundMusic(game);
-        QImage bg(QString::fromUtf8(game->info.pic_path.c_str()));
-        if (!bg.isNull()) {
-            backgroundImage = bg;
-            m_game_grid->update();
-        }
+        ShowBackgroundArt(game, m_game_grid->NeighbourGames(background_art_neighbours));
         Q_EMIT NotifyGameSelection(game);
     });
 
+    connect(m_background_loader, &BackgroundArtLoader::ArtReady, this, [this](const QImage& image) {
+        // Games without art keep showing the previous one
+        if (image.isNull()) {
+            return;
+        }
+        backgroundImage = image;
+        if (m_is_list_layout) {
+            m_game_list->viewport()->update();
+        } else {
+            m_game_grid->viewport()->update();
+        }
+    });
+
     // compatibility list connections
+    connect(m_game_compat, &GameCompatibility::DatabaseLoaded, this,
+            &GameListFrame::OnCompatFinished);
     connect(m_game_compat, &GameCompatibility::DownloadStarted, this, [this]() {
         for (const auto& game : m_game_data) {
             game->compat = m_game_compat->GetStatusData("Download");
@@ -414,6 +441,28 @@ bool GameListFrame::IsEntryVisible(const game_info& game, bool search_fallback)
            SearchMatchesApp(QString::fromStdString(game->info.name), serial, search_fallback);
 }
 
+EntrySet GameListFrame::VisibleEntries() const {
+    EntrySet visible = m_game_data.Match(m_search_text);
+
+    if (!m_show_hidden && !m_hidden_list.isEmpty()) {
+        visible.ForEach([this, &visible](std::size_t index) {
+            if (m_hidden_list.contains(m_game_data.Serial(index))) {
+                visible.Reset(index);
+            }
+        });
+    }
+
+    // Fallback is not needed when at least one entry is visible
+    if (visible.None() && !m_search_text.isEmpty()) {
+        for (std::size_t i = 0; i < m_game_data.size(); ++i) {
+            if (IsEntryVisible(m_game_data[i], true)) {
+                visible.Set(i);
+            }
+        }
+    }
+    return visible;
+}
+
 void GameListFrame::SetShowHidden(bool show) {
     m_show_hidden = show;
 }
@@ -443,17 +492,9 @@ std::string GameListFrame::CurrentSelectionPath() {
     game_info game{};
 
     if (m_old_layout_is_list) {
-        if (!m_game_list->selectedItems().isEmpty()) {
-            if (QTableWidgetItem* item = m_game_list->item(m_game_list->currentRow(), 0)) {
-                if (const QVariant var = item->data(GUI::game_role); var.canConvert<game_info>()) {
-                    game = var.value<game_info>();
-                }
-            }
-        }
+        game = m_game_list->SelectedGame();
     } else if (m_game_grid) {
-        if (GameListGridItem* item = static_cast<GameListGridItem*>(m_game_grid->SelectedItem())) {
-            game = item->Game();
-        }
+        game = m_game_grid->SelectedGame();
     }
 
     if (game) {
@@ -485,7 +526,13 @@ void GameListFrame::ResizeIcons(const int& slider_pos) {
     m_icon_size_index = slider_pos;
     m_icon_size = GUISettings::GetSizeFromSlider(slider_pos);
 
-    RepaintIcons();
+    // Scaling the nearest mip level keeps dragging the slider smooth
+    if (m_is_list_layout) {
+        m_game_list->PreviewIconSize(m_icon_size, devicePixelRatioF());
+    } else {
+        m_game_grid->PreviewIconSize(m_icon_size, devicePixelRatioF());
+    }
+    m_resize_icons_timer.start();
 }
 
 void GameListFrame::ShowCustomConfigIcon(const game_info& game) {
@@ -516,7 +563,7 @@ void GameListFrame::SetShowCompatibilityInGrid(bool show) {
 }
 
 const std::vector<game_info>& GameListFrame::GetGameInfo() const {
-    return m_game_data;
+    return m_game_data.Games();
 }
 
 void GameListFrame::CheckCompatibilityAtStartup() {
@@ -542,10 +589,18 @@ void GameListFrame::SetListMode(const bool& is_list) {
 
 void GameListFrame::SetSearchText(const QString& text) {
     m_search_text = text;
+
+    if (m_is_list_layout && !m_game_data.empty()) {
+        // The list holds the whole library already, only the games it shows change
+        const EntrySet visible = VisibleEntries();
+        m_game_list->SetFilter([visible](std::size_t index) { return visible.Test(index); });
+        return;
+    }
     Refresh();
 }
 
 void GameListFrame::RepaintIcons(const bool& from_settings) {
+    m_resize_icons_timer.stop();
     GUI::Utils::StopFutureWatcher(m_parsing_watcher, false);
     GUI::Utils::StopFutureWatcher(m_refresh_watcher, false);
     WaitAndAbortRepaintThreads();
@@ -560,10 +615,12 @@ void GameListFrame::RepaintIcons(const bool& from_settings) {
     }
 
     if (m_is_list_layout) {
-        m_game_list->RepaintIcons(m_game_data, m_icon_color, m_icon_size, devicePixelRatioF());
+        m_game_list->RepaintIcons(m_game_data.Games(), m_icon_color, m_icon_size,
+                                  devicePixelRatioF());
     } else {
         m_game_grid->SetDrawCompatStatusToGrid(m_draw_compat_status_to_grid);
-        m_game_grid->RepaintIcons(m_game_data, m_icon_color, m_icon_size, devicePixelRatioF());
+        m_game_grid->RepaintIcons(m_game_data.Games(), m_icon_color, m_icon_size,
+                                  devicePixelRatioF());
     }
 }
 
@@ -578,6 +635,7 @@ void GameListFrame::PushPath(const std::string& path, std::vector<std::string>&
 }
 
 void GameListFrame::OnParsingFinished() {
+    m_refresh_timings.scan_ms = m_refresh_timer.restart();
     const Localized localized;
 
     // Remove duplicates
@@ -592,15 +650,28 @@ void GameListFrame::OnParsingFinished() {
     const std::string localized_title = fmt::format("TITLE_%02d", language_index);
     const std::string localized_icon = fmt::format("ICON0_%02d.PNG", language_index);
 
-    const auto add_game = [this, localized_title, localized_icon](const std::string& dir_or_elf) {
+    // Every custom config lookup below is answered from these instead of a stat() per game
+    EmulatorSettingsImpl::RescanGameConfigs();
+    m_custom_configs = Common::FS::DirectoryListing(
+        Common::FS::GetUserPath(Common::FS::PathType::CustomConfigs));
+    m_custom_input_configs = Common::FS::DirectoryListing(
+        Common::FS::GetUserPath(Common::FS::PathType::CustomInputConfigs));
+
+    const auto add_game = [this, localized_title, localized_icon](
+                              const std::string& dir_or_elf,
+                              const Common::FS::DirectoryListing& sce_sys) {
         GUIGameInfo game{};
         game.info.path = GUI::Utils::NormalizePath(std::filesystem::path(dir_or_elf));
 
         const Localized thread_localized;
 
         const std::string sfo_dir = dir_or_elf + "/sce_sys";
-        PSF psf;
-        psf.Open(sfo_dir + "/param.sfo");
+        // Only the handful of keys below are needed, read them straight out of the mapping
+        const Common::FS::MappedFile sfo_file(sfo_dir + "/param.sfo");
+        PSFView psf;
+        if (sfo_file.IsOpen()) {
+            psf.Open(sfo_file.Span());
+        }
         if (const auto category = psf.GetString("CATEGORY"); category.has_value()) {
             game.info.category = *category;
 #ifdef _WIN32
@@ -610,10 +681,6 @@ void GameListFrame::OnParsingFinished() {
 #endif
                 return;
         }
-        NPBindFile m_npfile;
-        if (m_npfile.Load(dir_or_elf + "/sce_sys/npbind.dat")) {
-            game.info.np_comm_ids = m_npfile.GetNpCommIds();
-        }
         std::string title_id = "";
         if (const auto titleId = psf.GetString("TITLE_ID"); titleId.has_value()) {
             title_id = *titleId;
@@ -653,8 +720,8 @@ void GameListFrame::OnParsingFinished() {
                         sdk_ver_len = pubtool_info.value().size();
                     }
                     sdk_ver_len -= sdk_ver_offset;
-                    std::string sdk_ver_string =
-                        pubtool_info.value().substr(sdk_ver_offset, sdk_ver_len).data();
+                    const std::string sdk_ver_string{
+                        pubtool_info.value().substr(sdk_ver_offset, sdk_ver_len)};
                     // Number is stored in base 16.
                     uint32_t sdk_int = std::stoi(sdk_ver_string, nullptr, 16);
                     u8 major_bcd = (sdk_int >> 24) & 0xFF;
@@ -719,66 +786,22 @@ void GameListFrame::OnParsingFinished() {
         game.info.pic_path = sfo_dir + "/PIC1.PNG";
 
         if (game.info.icon_path.empty()) {
-            if (std::string icon_path = sfo_dir + "/" + localized_icon;
-                std::filesystem::is_regular_file(icon_path)) {
-                game.info.icon_path = std::move(icon_path);
+            if (const std::string* icon_name = sce_sys.Find(localized_icon)) {
+                game.info.icon_path = sfo_dir + "/" + *icon_name;
             } else {
                 game.info.icon_path = sfo_dir + "/icon0.png";
             }
         }
 
         if (game.info.snd0_path.empty()) {
-            if (std::filesystem::is_regular_file(sfo_dir + "/snd0.at9")) {
-                game.info.snd0_path = sfo_dir + "/snd0.at9";
+            if (const std::string* snd0_name = sce_sys.Find("snd0.at9")) {
+                game.info.snd0_path = sfo_dir + "/" + *snd0_name;
             }
         }
 
-        const QString serial = QString::fromStdString(game.info.serial);
-
-        m_games_mutex.lock();
-
-        // Read persistent_settings values
-        const QString last_played =
-            m_persistent_settings->GetValue(GUI::Persistent::last_played, serial, "").toString();
-        const quint64 playtime =
-            m_persistent_settings->GetValue(GUI::Persistent::playtime, serial, 0).toULongLong();
-
-        // Set persistent_settings values if values exist
-        if (!last_played.isEmpty()) {
-            m_persistent_settings->SetLastPlayed(
-                serial, last_played,
-                false); // No need to sync here. It would slow down the refresh anyway.
-        }
-        if (playtime > 0) {
-            m_persistent_settings->SetPlaytime(
-                serial, playtime,
-                false); // No need to sync here. It would slow down the refresh anyway.
-        }
-
-        m_serials.insert(serial);
-
-        if (QString note =
-                m_persistent_settings->GetValue(GUI::Persistent::notes, serial, "").toString();
-            !note.isEmpty()) {
-            m_notes.insert_or_assign(serial, std::move(note));
-        }
-
-        if (QString title = m_persistent_settings->GetValue(GUI::Persistent::titles, serial, "")
-                                .toString()
-                                .simplified();
-            !title.isEmpty()) {
-            m_titles.insert_or_assign(serial, std::move(title));
-        }
-
-        m_games_mutex.unlock();
-
         game.compat = m_game_compat->GetCompatibility(game.info.serial);
-        game.has_custom_config = std::filesystem::is_regular_file(
-            Common::FS::GetUserPath(Common::FS::PathType::CustomConfigs) /
-            (game.info.serial + ".json"));
-        game.has_custom_pad_config = std::filesystem::is_regular_file(
-            Common::FS::GetUserPath(Common::FS::PathType::CustomInputConfigs) /
-            (game.info.serial + ".json"));
+        game.has_custom_config = m_custom_configs.Contains(game.info.serial + ".json");
+        game.has_custom_pad_config = m_custom_input_configs.Contains(game.info.serial + ".json");
 
         m_games.push(std::make_shared<GUIGameInfo>(std::move(game)));
     };
@@ -787,8 +810,11 @@ void GameListFrame::OnParsingFinished() {
         QtConcurrent::map(m_path_entries, [this, add_game](const path_entry& entry) {
             std::vector<std::string> legit_paths;
 
+            // One listing answers every sce_sys existence check for this game
+            const Common::FS::DirectoryListing sce_sys(entry.path + "/sce_sys");
+
             // if (entry.is_from_file) { //TODO
-            if (std::filesystem::is_regular_file(entry.path + "/sce_sys/param.sfo")) {
+            if (sce_sys.Contains("param.sfo")) {
                 PushPath(entry.path, legit_paths);
             } else {
                 qDebug() << "Invalid game path registered:" << QString::fromStdString(entry.path);
@@ -799,33 +825,49 @@ void GameListFrame::OnParsingFinished() {
             // }
 
             for (const std::string& path : legit_paths) {
-                add_game(path);
+                add_game(path, sce_sys);
             }
         }));
 }
 
 void GameListFrame::OnRefreshFinished() {
+    m_refresh_timings.parse_ms = m_refresh_timer.restart();
     WaitAndAbortSizeCalcThreads();
     WaitAndAbortRepaintThreads();
 
-    // Move parsed results into main game data list
+    // Move parsed results into main game data list. Persistent values come from one snapshot
+    // here instead of locked per-game lookups in the parsing workers.
+    const auto persistent = m_persistent_settings->GetSnapshot();
+    std::vector<game_info> parsed_games;
     for (auto&& g : m_games.pop_all()) {
-        m_game_data.push_back(g);
+        const QString serial = QString::fromStdString(g->info.serial);
+        m_serials.insert(serial);
+
+        if (const auto it = persistent->constFind(serial); it != persistent->cend()) {
+            if (!it->notes.isEmpty()) {
+                m_notes.insert_or_assign(serial, it->notes);
+            }
+            if (!it->title.isEmpty()) {
+                m_titles.insert_or_assign(serial, it->title);
+            }
+        }
+
+        parsed_games.push_back(g);
     }
 
     const s32 language_index = GUIApplication::getLanguageId();
     const std::string localized_icon = fmt::format("ICON0_%02d.PNG", language_index);
 
     std::vector<game_info> filtered_games;
-    filtered_games.reserve(m_game_data.size());
+    filtered_games.reserve(parsed_games.size());
 
     // Merge base and update game info (CUSAxxxxx + CUSAxxxxx-UPDATE) or -patch
-    for (const game_info& entry : m_game_data) {
+    for (const game_info& entry : parsed_games) {
         // Skip update folders (we’ll merge them into base)
         if (entry->info.path.ends_with("-UPDATE") || entry->info.path.ends_with("-patch"))
             continue;
 
-        for (const auto& other : m_game_data) {
+        for (const auto& other : parsed_games) {
             // Process only matching update or patch folders
             if (!other->info.path.ends_with("-UPDATE") && !other->info.path.ends_with("-patch"))
                 continue;
@@ -848,49 +890,35 @@ void GameListFrame::OnRefreshFinished() {
             entry->info.app_ver = other->info.app_ver;
             entry->info.fw = other->info.fw;
             entry->info.sdk_ver = other->info.sdk_ver;
-            entry->info.np_comm_ids = other->info.np_comm_ids;
 
             entry->info.update_path = other->info.path; // Store update path
 
+            // List the update's sce_sys once instead of probing every asset
+            const std::string update_sce_sys = other->info.path + "/sce_sys/";
+            const Common::FS::DirectoryListing update_listing(update_sce_sys);
+
             // --- Replace picture path if available ---
-            if (std::string pic_path = other->info.path + "/sce_sys/PIC1.PNG";
-                std::filesystem::is_regular_file(pic_path))
-                entry->info.pic_path = std::move(pic_path);
+            if (const std::string* pic_name = update_listing.Find("PIC1.PNG"))
+                entry->info.pic_path = update_sce_sys + *pic_name;
 
             // --- Replace icon path if available ---
-            if (std::string icon_path = other->info.path + "/sce_sys/" + localized_icon;
-                std::filesystem::is_regular_file(icon_path))
-                entry->info.icon_path = std::move(icon_path);
-            else if (std::string icon_path = other->info.path + "/sce_sys/ICON0.PNG";
-                     std::filesystem::is_regular_file(icon_path))
-                entry->info.icon_path = std::move(icon_path);
+            if (const std::string* icon_name = update_listing.Find(localized_icon))
+                entry->info.icon_path = update_sce_sys + *icon_name;
+            else if (const std::string* icon_name = update_listing.Find("ICON0.PNG"))
+                entry->info.icon_path = update_sce_sys + *icon_name;
 
             // --- Replace sound path if available ---
-            if (std::string snd0_path = other->info.path + "/sce_sys/snd0.at9";
-                std::filesystem::is_regular_file(snd0_path))
-                entry->info.snd0_path = std::move(snd0_path);
+            if (const std::string* snd0_name = update_listing.Find("snd0.at9"))
+                entry->info.snd0_path = update_sce_sys + *snd0_name;
         }
 
         // Keep only base games (hide -update folders)
         filtered_games.push_back(entry);
     }
 
-    // Replace with filtered list (no -update entries)
-    m_game_data.swap(filtered_games);
-
-    // Sort alphabetically by title (localized if available)
-    std::sort(m_game_data.begin(), m_game_data.end(),
-              [&](const game_info& game1, const game_info& game2) {
-                  const QString serial1 = QString::fromStdString(game1->info.serial);
-                  const QString serial2 = QString::fromStdString(game2->info.serial);
-                  const QString& title1 = m_titles.contains(serial1)
-                                              ? m_titles.at(serial1)
-                                              : QString::fromStdString(game1->info.name);
-                  const QString& title2 = m_titles.contains(serial2)
-                                              ? m_titles.at(serial2)
-                                              : QString::fromStdString(game2->info.name);
-                  return title1.toLower() < title2.toLower();
-              });
+    // Replace with filtered list (no -update entries), sorted alphabetically by title (localized
+    // if available)
+    m_game_data.Assign(std::move(filtered_games), m_titles, m_notes);
 
     // Clean up hidden games list
     m_hidden_list.intersect(m_serials);
@@ -899,8 +927,11 @@ void GameListFrame::OnRefreshFinished() {
     m_path_list.clear();
     m_path_entries.clear();
 
+    m_refresh_timings.merge_ms = m_refresh_timer.restart();
+
     // Refresh UI
     Refresh();
+    m_refresh_timings.populate_ms = m_refresh_timer.restart();
 
     // Restore layout on first refresh
     if (!std::exchange(m_initial_refresh_done, true)) {
@@ -1129,10 +1160,13 @@ void GameListFrame::Refresh(const bool from_drive,
     }
 
     if (from_drive) {
+        m_refresh_timings = {};
+        m_refresh_timer.start();
+
         m_path_entries.clear();
         m_path_list.clear();
         m_serials.clear();
-        m_game_data.clear();
+        m_game_data.Clear();
         m_notes.clear();
         m_games.pop_all();
 
@@ -1196,28 +1230,16 @@ void GameListFrame::Refresh(const bool from_drive,
         game->item = nullptr;
     }
 
-    // Get list of matching apps
-    std::vector<game_info> matching_apps;
-
-    for (const auto& app : m_game_data) {
-        if (IsEntryVisible(app)) {
-            matching_apps.push_back(app);
-        }
-    }
-
-    // Fallback is not needed when at least one entry is visible
-    if (matching_apps.empty()) {
-        for (const auto& app : m_game_data) {
-            if (IsEntryVisible(app, true)) {
-                matching_apps.push_back(app);
-            }
-        }
-    }
+    // Compatibility and custom configs may have changed since the last refresh
+    m_game_data.UpdateFacets();
+    const EntrySet visible = VisibleEntries();
 
     if (m_is_list_layout) {
         m_game_grid->ClearList();
         const int scroll_position = m_game_list->verticalScrollBar()->value();
-        m_game_list->Populate(matching_apps, m_notes, m_titles, selected_item);
+        // The list holds the whole library and hides the games that don't match
+        m_game_list->SetFilter([visible](std::size_t index) { return visible.Test(index); });
+        m_game_list->Populate(m_game_data.Games(), m_notes, m_titles, selected_item);
         m_game_list->sort(m_game_data.size(), m_sort_column, m_col_sort_order);
         RepaintIcons();
 
@@ -1227,46 +1249,18 @@ void GameListFrame::Refresh(const bool from_drive,
             m_game_list->verticalScrollBar()->setValue(scroll_position);
         }
     } else {
+        // Get list of matching apps
+        std::vector<game_info> matching_apps;
+        visible.ForEach([this, &matching_apps](std::size_t index) {
+            matching_apps.push_back(m_game_data[index]);
+        });
+
         m_game_list->ClearList();
         m_game_grid->Populate(matching_apps, m_notes, m_titles, selected_item);
         RepaintIcons();
     }
 }
 
-game_info GameListFrame::GetGameInfoByMode(const QTableWidgetItem* item) const {
-    if (!item) {
-        return nullptr;
-    }
-
-    if (m_is_list_layout) {
-        return GetGameInfoFromItem(
-            m_game_list->item(item->row(), static_cast<int>(GUI::GameListColumns::icon)));
-    }
-
-    return GetGameInfoFromItem(item);
-}
-
-game_info GameListFrame::GetGameInfoFromItem(const QTableWidgetItem* item) {
-    if (!item) {
-        return nullptr;
-    }
-
-    const QVariant var = item->data(GUI::game_role);
-    if (!var.canConvert<game_info>()) {
-        return nullptr;
-    }
-
-    return var.value<game_info>();
-}
-
-void GameListFrame::DoubleClickedSlot(QTableWidgetItem* item) {
-    if (!item) {
-        return;
-    }
-
-    DoubleClickedSlot(GetGameInfoByMode(item));
-}
-
 void GameListFrame::DoubleClickedSlot(const game_info& game) {
     if (!game) {
         return;
@@ -1283,11 +1277,8 @@ void GameListFrame::OnCompatFinished() {
 }
 
 bool GameListFrame::RemoveCustomConfiguration(const QString& serial, const game_info& game) {
-    const auto path = Common::FS::GetUserPath(Common::FS::PathType::CustomConfigs) /
-                      (serial + ".json").toStdString();
-
     std::error_code ec;
-    bool result = std::filesystem::remove(path, ec);
+    bool result = EmulatorSettingsImpl::RemoveGameConfig(serial.toStdString(), ec);
 
     if (result && game) {
         game->has_custom_config = false;
@@ -1303,14 +1294,11 @@ void GameListFrame::ShowContextMenu(const QPoint& pos) {
     game_info gameinfo;
 
     if (m_is_list_layout) {
-        QTableWidgetItem* item = m_game_list->item(m_game_list->indexAt(pos).row(),
-                                                   static_cast<int>(GUI::GameListColumns::icon));
         global_pos = m_game_list->viewport()->mapToGlobal(pos);
-        gameinfo = GetGameInfoFromItem(item);
-    } else if (GameListGridItem* item =
-                   static_cast<GameListGridItem*>(m_game_grid->SelectedItem())) {
-        gameinfo = item->Game();
-        global_pos = m_game_grid->mapToGlobal(pos);
+        gameinfo = m_game_list->Game(m_game_list->indexAt(pos));
+    } else {
+        gameinfo = m_game_grid->SelectedGame();
+        global_pos = m_game_grid->viewport()->mapToGlobal(pos);
     }
 
     if (!gameinfo) {
@@ -1623,10 +1611,7 @@ void GameListFrame::ShowContextMenu(const QPoint& pos) {
 
     QAction* trophy_viewer = menu.addAction(tr("&Trophy Viewer"));
     connect(trophy_viewer, &QAction::triggered, this, [this, current_game] {
-        const auto& user_key_vec =
-            KeyManager::GetInstance()->GetAllKeys().TrophyKeySet.ReleaseTrophyKey;
-
-        if (user_key_vec.size() != 16) {
+        if (!KeyManager::GetInstance()->GetKeyTable().ReleaseTrophyKey) {
             // turn clang format off to maintain one string line for easy translations
             // clang-format off
             QMessageBox::critical(nullptr, tr("Error"), tr("A trophy key is required to use the Trophy Viewer. This can be inputted by clicking Utilities - Crypto Key Manager"));
@@ -1844,8 +1829,7 @@ void GameListFrame::ShowContextMenu(const QPoint& pos) {
     connect(edit_notes, &QAction::triggered, this, [this, name, serial] {
         bool accepted;
         // fetch old notes from persistent storage
-        const QString old_notes =
-            m_persistent_settings->GetValue(GUI::Persistent::notes, serial, "").toString();
+        const QString old_notes = m_persistent_settings->GetNotes(serial);
 
         QInputDialog dlg(this);
         dlg.setWindowTitle(tr("Edit Tooltip Notes"));
@@ -1859,11 +1843,11 @@ void GameListFrame::ShowContextMenu(const QPoint& pos) {
 
             if (new_notes.isEmpty()) {
                 m_notes.erase(serial);
-                m_persistent_settings->RemoveValue(GUI::Persistent::notes, serial);
             } else {
                 m_notes.insert_or_assign(serial, new_notes);
-                m_persistent_settings->SetValue(GUI::Persistent::notes, serial, new_notes);
             }
+            m_persistent_settings->SetNotes(serial, new_notes);
+            m_game_data.SetNotes(serial, new_notes);
 
             Refresh();
         }
@@ -1887,6 +1871,18 @@ void GameListFrame::ShowContextMenu(const QPoint& pos) {
     menu.exec(global_pos);
 }
 
+void GameListFrame::ShowBackgroundArt(const game_info& game,
+                                      const std::vector<game_info>& neighbours) {
+    std::vector<std::string> neighbour_paths;
+    neighbour_paths.reserve(neighbours.size());
+    for (const game_info& neighbour : neighbours) {
+        if (neighbour) {
+            neighbour_paths.push_back(neighbour->info.pic_path);
+        }
+    }
+    m_background_loader->Request(game->info.pic_path, neighbour_paths);
+}
+
 void GameListFrame::PlayBackgroundMusic(game_info game) {
     if (!m_gui_settings->GetValue(GUI::game_list_play_bg).toBool() ||
         game->info.snd0_path.empty()) {
@@ -1905,14 +1901,9 @@ game_info GameListFrame::GetSelectedGameInfo() {
     game_info info;
 
     if (m_is_list_layout) {
-        if (m_game_list->selectedItems().isEmpty())
-            return nullptr;
-        info = GetGameInfoFromItem(m_game_list->selectedItems().first());
+        info = m_game_list->SelectedGame();
     } else {
-        if (!m_game_grid->SelectedItem())
-            return nullptr;
-        GameListGridItem* item = static_cast<GameListGridItem*>(m_game_grid->SelectedItem());
-        info = item->Game();
+        info = m_game_grid->SelectedGame();
     }
 
     return info;
@@ -4,16 +4,18 @@
 
 #pragma once
 
+#include "common/dir_listing.h"
 #include "common/lf_queue.h"
 #include "custom_dock_widget.h"
+#include "game_library.h"
 #include "game_list.h"
 
+#include <QElapsedTimer>
 #include <QFutureWatcher>
 #include <QMainWindow>
 #include <QSet>
 #include <QSplitter>
 #include <QStackedWidget>
-#include <QTableWidgetItem>
 #include <QTextEdit>
 #include <QTimer>
 #include <QToolBar>
@@ -23,6 +25,7 @@
 #include <optional>
 #include <set>
 
+class BackgroundArtLoader;
 class GameListTable;
 class GameListGrid;
 class GUISettings;
@@ -35,6 +38,14 @@ class GameListFrame : public CustomDockWidget {
     Q_OBJECT
 
 public:
+    /** Wall-clock duration of each phase of the last refresh from drive, in milliseconds */
+    struct RefreshTimings {
+        qint64 scan_ms = 0;     // Walking the game install directories
+        qint64 parse_ms = 0;    // Reading param.sfo and friends of every game
+        qint64 merge_ms = 0;    // Merging updates into base games and sorting
+        qint64 populate_ms = 0; // Filling the table or grid
+    };
+
     explicit GameListFrame(std::shared_ptr<GUISettings> gui_settings,
                            std::shared_ptr<EmulatorSettingsImpl> emu_settings,
                            std::shared_ptr<PersistentSettings> persistent_settings,
@@ -58,7 +69,12 @@ public:
     void ShowCustomConfigIcon(const game_info& game);
     void SetShowHidden(bool show);
     bool IsEntryVisible(const game_info& game, bool search_fallback = false) const;
+    /** Entries of the library that match the search text and are not hidden */
+    EntrySet VisibleEntries() const;
     const std::vector<game_info>& GetGameInfo() const;
+    const RefreshTimings& GetRefreshTimings() const {
+        return m_refresh_timings;
+    }
     void CheckCompatibilityAtStartup();
     void PlayBackgroundMusic(game_info game);
     bool RemoveCustomConfiguration(const QString& serial, const game_info& game);
@@ -84,7 +100,6 @@ private Q_SLOTS:
     void OnParsingFinished();
     void OnRefreshFinished();
     void ShowContextMenu(const QPoint& pos);
-    void DoubleClickedSlot(QTableWidgetItem* item);
     void DoubleClickedSlot(const game_info& game);
     void OnCompatFinished();
 Q_SIGNALS:
@@ -106,10 +121,10 @@ private:
     QStringList scanDirectories(const std::vector<std::filesystem::path>& baseDirs, int maxDepth,
                                 int currentDepth = 1);
     std::string CurrentSelectionPath();
+    /** Loads the background art of the selected game and prefetches the art of its neighbours */
+    void ShowBackgroundArt(const game_info& game, const std::vector<game_info>& neighbours);
     void WaitAndAbortRepaintThreads();
     void WaitAndAbortSizeCalcThreads();
-    game_info GetGameInfoByMode(const QTableWidgetItem* item) const;
-    static game_info GetGameInfoFromItem(const QTableWidgetItem* item);
     // Settings
     std::shared_ptr<GUISettings> m_gui_settings;
     std::shared_ptr<EmulatorSettingsImpl> m_emu_settings;
@@ -121,6 +136,7 @@ private:
     GameListGrid* m_game_grid = nullptr;  // Game Grid
     GameListTable* m_game_list = nullptr; // Game List
     GameCompatibility* m_game_compat = nullptr;
+    BackgroundArtLoader* m_background_loader = nullptr;
     ProgressDialog* m_progress_dialog = nullptr;
     // Data
     struct path_entry {
@@ -130,14 +146,17 @@ private:
     std::vector<path_entry> m_path_entries;
     QSet<QString> m_hidden_list;
     bool m_show_hidden{false};
-    std::vector<game_info> m_game_data;
+    GameLibrary m_game_data;
     QFutureWatcher<void> m_parsing_watcher;
     QFutureWatcher<void> m_refresh_watcher;
+    QElapsedTimer m_refresh_timer;
+    RefreshTimings m_refresh_timings;
     std::shared_mutex m_path_mutex;
     std::set<std::string> m_path_list;
     QSet<QString> m_serials;
-    QMutex m_games_mutex;
     lf_queue<game_info> m_games;
+    Common::FS::DirectoryListing m_custom_configs;
+    Common::FS::DirectoryListing m_custom_input_configs;
     const std::array<int, 1> m_parsing_threads{0};
     // List Mode
     bool m_is_list_layout = true;
@@ -153,6 +172,7 @@ private:
     QString m_search_text;
     // Icon Size
     int m_icon_size_index = 0;
+    QTimer m_resize_icons_timer;
     // Icons
     QColor m_icon_color;
     QSize m_icon_size;
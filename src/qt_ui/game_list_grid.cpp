@@ -2,44 +2,103 @@
 // SPDX-FileCopyrightText: Copyright 2025-2026 shadLauncher4 Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
-#include <QApplication>
-#include <QStringBuilder>
+#include <algorithm>
+#include <QPainter>
+#include <QScrollBar>
 
 #include "game_list_grid.h"
+#include "game_list_grid_delegate.h"
 #include "game_list_grid_item.h"
+#include "game_list_grid_model.h"
 #include "gui_settings.h"
 #include "stylesheets.h"
 
+namespace {
+
+bool ShowTitles(const QSize& icon_size) {
+    return icon_size.width() >
+           (GUI::game_list_icon_size_medium.width() + GUI::game_list_icon_size_small.width()) / 2;
+}
+
+} // namespace
+
 GameListGrid::GameListGrid(GameListFrame* frame, std::shared_ptr<GUISettings> gui_settings)
-    : m_game_list_frame(frame), m_gui_settings(std::move(gui_settings)), FlowWidget(nullptr),
-      GameListBase() {
+    : QAbstractItemView(nullptr), GameListBase(), m_game_list_frame(frame),
+      m_gui_settings(std::move(gui_settings)) {
     setObjectName("game_list_grid");
     setContextMenuPolicy(Qt::CustomContextMenu);
     setStyleSheet(
         GUI::Stylesheets::default_style_sheet); // todo: check why it's not applying w/o this
 
-    m_icon_ready_callback = [this](const game_info& game, const GameItemBase* item) {
-        Q_EMIT IconReady(game, item);
+    m_model = new GameListGridModel(this);
+    m_delegate = new GameListGridDelegate(this);
+    setModel(m_model);
+    setItemDelegate(m_delegate);
+
+    setSelectionMode(QAbstractItemView::SingleSelection);
+    setVerticalScrollMode(QAbstractItemView::ScrollPerPixel);
+    setHorizontalScrollBarPolicy(Qt::ScrollBarAlwaysOff);
+    setEditTriggers(QAbstractItemView::NoEditTriggers);
+    setMouseTracking(true);
+    viewport()->setAutoFillBackground(false);
+
+    m_spacing = style()->pixelMetric(QStyle::PM_LayoutHorizontalSpacing);
+    if (m_spacing < 0) {
+        m_spacing = 6;
+    }
+    m_margin = style()->pixelMetric(QStyle::PM_LayoutLeftMargin);
+    SetCellIconSize(GUI::game_list_icon_size_min);
+
+    m_model->SetItemInitializer([this](GameListGridItem& item) {
+        item.setIconLoadFunc([this, game = item.Game(), device_pixel_ratio = m_device_pixel_ratio,
+                              cancel = item.getIconLoadingAborted()](int) {
+            IconLoadFunction(game, device_pixel_ratio, cancel);
+        });
+    });
+
+    m_icon_ready_callback = [this](const game_info& game, const GameItemBase* item,
+                                   const QImage& image, const QList<QImage>& mips) {
+        Q_EMIT IconReady(game, item, image, mips);
     };
 
     connect(
         this, &GameListGrid::IconReady, this,
-        [this](const game_info& game, const GameItemBase* item) {
-            if (game && item && game->item == item)
-                item->getImageChangeCallback();
+        [this](const game_info& game, const GameItemBase* item, const QImage& image,
+               const QList<QImage>& mips) {
+            if (game && item && game->item == item) {
+                auto* grid_item = static_cast<GameListGridItem*>(game->item);
+                grid_item->SetIcon(QPixmap::fromImage(image));
+                TrackIcon(grid_item, image, mips);
+                m_model->IconChanged(grid_item->Row());
+            }
         },
         Qt::QueuedConnection); // The default 'AutoConnection' doesn't seem to work in this specific
                                // case...
 
-    connect(this, &FlowWidget::ItemSelectionChanged, this, [this](int index) {
-        if (GameListGridItem* item = static_cast<GameListGridItem*>(Items().at(index))) {
-            Q_EMIT ItemSelectionChanged(item->Game());
-        }
-    });
+    // Re-evaluated at most once per frame while scrolling
+    m_icon_priority_timer.setSingleShot(true);
+    m_icon_priority_timer.setInterval(16);
+    connect(&m_icon_priority_timer, &QTimer::timeout, this, &GameListGrid::UpdateIconPriorities);
+    connect(verticalScrollBar(), &QScrollBar::valueChanged, &m_icon_priority_timer,
+            qOverload<>(&QTimer::start));
+
+    connect(selectionModel(), &QItemSelectionModel::currentChanged, this,
+            [this](const QModelIndex& current) {
+                if (current.isValid()) {
+                    Q_EMIT ItemSelectionChanged(m_model->Game(current.row()));
+                }
+            });
+}
+
+GameListGrid::~GameListGrid() {
+    // Items wait for their icon loads, which call back into this view
+    m_model->Clear();
 }
 
 void GameListGrid::ClearList() {
-    Clear();
+    m_hover_index = {};
+    m_prefetch_rows = {};
+    m_model->Clear();
 }
 
 void GameListGrid::Populate(const std::vector<game_info>& game_data,
@@ -48,125 +107,321 @@ void GameListGrid::Populate(const std::vector<game_info>& game_data,
                             const std::string& selected_item_id) {
     ClearList();
 
-    GameListGridItem* selected_item = nullptr;
+    m_model->Reset(game_data, title_map, notes_map);
 
-    blockSignals(true);
+    for (std::size_t row = 0; row < game_data.size(); ++row) {
+        const game_info& game = game_data[row];
+        if (selected_item_id == game->info.path + game->info.icon_path) {
+            const QModelIndex selected = m_model->index(static_cast<int>(row));
+            selectionModel()->setCurrentIndex(selected, QItemSelectionModel::ClearAndSelect);
+            scrollTo(selected);
+            break;
+        }
+    }
+
+    m_icon_priority_timer.start();
+}
+
+void GameListGrid::RepaintIcons(const std::vector<game_info>& /*game_data*/,
+                                const QColor& icon_color, const QSize& icon_size,
+                                qreal device_pixel_ratio) {
+    m_icon_size = icon_size;
+    m_icon_color = icon_color;
+    m_device_pixel_ratio = device_pixel_ratio;
+
+    // Cells that were never shown get their load function once they are created. The others
+    // keep showing their current icon, scaled, until the new one is ready.
+    m_model->ForEachItem([this, device_pixel_ratio](GameListGridItem& item) {
+        item.setIconLoadFunc([this, game = item.Game(), device_pixel_ratio,
+                              cancel = item.getIconLoadingAborted()](int) {
+            IconLoadFunction(game, device_pixel_ratio, cancel);
+        });
+    });
 
-    const auto get_title = [&title_map](const QString& serial, const std::string& name) -> QString {
-        if (const auto it = title_map.find(serial); it != title_map.cend()) {
-            return it->second.simplified();
+    SetCellIconSize(icon_size);
+    m_prefetch_rows = {};
+    m_icon_priority_timer.start();
+}
+
+void GameListGrid::PreviewIconSize(const QSize& icon_size, qreal device_pixel_ratio) {
+    const int width = static_cast<int>(icon_size.width() * device_pixel_ratio);
+
+    // The delegate scales whatever a cell shows to the cell size
+    m_model->ForEachItem([width](GameListGridItem& item) {
+        if (const QPixmap* mip = NearestIconMip(&item, width)) {
+            item.SetIcon(*mip);
         }
+    });
+    SetCellIconSize(icon_size);
+}
+
+game_info GameListGrid::SelectedGame() const {
+    const QModelIndex current = currentIndex();
+    if (!current.isValid()) {
+        return nullptr;
+    }
+    return m_model->Game(current.row());
+}
 
-        return QString::fromStdString(name).simplified();
+std::vector<game_info> GameListGrid::NeighbourGames(int count) const {
+    std::vector<game_info> games;
+    const int current = currentIndex().row();
+    if (current < 0) {
+        return games;
+    }
+    const int rows = m_model->rowCount();
+    const auto add = [&](int row) {
+        if (row >= 0 && row < rows) {
+            games.push_back(m_model->Game(row));
+        }
     };
+    for (int distance = 1; distance <= count; ++distance) {
+        add(current + distance);
+        add(current - distance);
+    }
+    // Cells above and below, unless the row is short enough to be covered already
+    if (const int columns = Columns(); columns > count) {
+        add(current + columns);
+        add(current - columns);
+    }
+    return games;
+}
 
-    for (const auto& game : game_data) {
-        const QString serial = QString::fromStdString(game->info.serial);
-        const QString title = get_title(serial, game->info.name);
+void GameListGrid::SetCellIconSize(const QSize& icon_size) {
+    m_delegate->SetIconSize(icon_size);
+    m_delegate->SetShowTitle(ShowTitles(icon_size));
+    m_cell_size = m_delegate->CellSize();
 
-        GameListGridItem* item = new GameListGridItem(this, game, title);
-        item->installEventFilter(this);
-        item->setFocusPolicy(Qt::StrongFocus);
+    updateGeometries();
+    viewport()->update();
+}
 
-        game->item = item;
+int GameListGrid::Columns() const {
+    const int available = viewport()->width() - 2 * m_margin + m_spacing;
+    return std::max(1, available / (m_cell_size.width() + m_spacing));
+}
 
-        if (const auto it = notes_map.find(serial);
-            it != notes_map.cend() && !it->second.isEmpty()) {
-            item->setToolTip(QString("%0 [%1]\n\n%2\n%3")
-                                 .arg(title)
-                                 .arg(serial)
-                                 .arg(tr("Notes:"))
-                                 .arg(it->second));
-        } else {
-            item->setToolTip(QString("%0 [%1]").arg(title).arg(serial));
-        }
+QRect GameListGrid::CellRect(int row) const {
+    const int columns = Columns();
+    return QRect(m_margin + (row % columns) * (m_cell_size.width() + m_spacing),
+                 m_margin + (row / columns) * (m_cell_size.height() + m_spacing),
+                 m_cell_size.width(), m_cell_size.height());
+}
 
-        item->setImageChangeCallback([this, item, game]() {
-            if (!item || !game) {
-                return;
-            }
-            std::lock_guard lock(item->pixmap_mutex);
+std::pair<int, int> GameListGrid::RowsIn(const QRect& content_rect) const {
+    const int count = m_model->rowCount();
+    const int columns = Columns();
+    const int line_height = m_cell_size.height() + m_spacing;
+    const int first_line = std::max(0, (content_rect.top() - m_margin) / line_height);
+    const int last_line = std::max(0, (content_rect.bottom() - m_margin) / line_height);
+    return {std::min(count, first_line * columns), std::min(count, (last_line + 1) * columns)};
+}
 
-            if (!game->pxmap.isNull()) {
-                item->SetIcon(game->pxmap);
-                game->pxmap = {};
-            }
-        });
+QRect GameListGrid::visualRect(const QModelIndex& index) const {
+    if (!index.isValid()) {
+        return {};
+    }
+    return CellRect(index.row()).translated(-horizontalOffset(), -verticalOffset());
+}
 
-        if (selected_item_id == game->info.path + game->info.icon_path) {
-            selected_item = item;
+void GameListGrid::scrollTo(const QModelIndex& index, ScrollHint hint) {
+    if (!index.isValid()) {
+        return;
+    }
+
+    const QRect rect = CellRect(index.row());
+    const int page = viewport()->height();
+    int value = verticalScrollBar()->value();
+
+    switch (hint) {
+    case PositionAtTop:
+        value = rect.top() - m_margin;
+        break;
+    case PositionAtBottom:
+        value = rect.bottom() + m_margin - page;
+        break;
+    case PositionAtCenter:
+        value = rect.center().y() - page / 2;
+        break;
+    case EnsureVisible:
+        if (rect.top() - m_margin < value) {
+            value = rect.top() - m_margin;
+        } else if (rect.bottom() + m_margin > value + page) {
+            value = rect.bottom() + m_margin - page;
         }
+        break;
+    }
+    verticalScrollBar()->setValue(value);
+}
 
-        AddWidget(item);
+QModelIndex GameListGrid::indexAt(const QPoint& point) const {
+    const QPoint content = point + QPoint(horizontalOffset(), verticalOffset());
+    if (content.x() < m_margin || content.y() < m_margin) {
+        return {};
     }
 
-    blockSignals(false);
+    const int columns = Columns();
+    const int column = (content.x() - m_margin) / (m_cell_size.width() + m_spacing);
+    const int line = (content.y() - m_margin) / (m_cell_size.height() + m_spacing);
+    const int row = line * columns + column;
+    if (column >= columns || row >= m_model->rowCount() || !CellRect(row).contains(content)) {
+        // Outside of the grid or in the spacing between cells
+        return {};
+    }
+    return m_model->index(row);
+}
 
-    // Update layout before setting focus on the selected item
-    show();
+QModelIndex GameListGrid::moveCursor(CursorAction cursor_action,
+                                     Qt::KeyboardModifiers /*modifiers*/) {
+    const int count = m_model->rowCount();
+    if (count == 0) {
+        return {};
+    }
 
-    QApplication::processEvents();
+    const QModelIndex current = currentIndex();
+    if (!current.isValid()) {
+        return m_model->index(0);
+    }
 
-    SelectItem(selected_item);
+    // Same moves the former widget based grid made. The last line might have fewer columns.
+    const int columns = Columns();
+    const int row = current.row();
+    const int line = row / columns;
+    const int column = row % columns;
+    int target = row;
+
+    switch (cursor_action) {
+    case MoveUp:
+        if (line > 0) {
+            target = row - columns;
+        }
+        break;
+    case MoveDown:
+        if (row + columns < count) {
+            target = row + columns;
+        }
+        break;
+    case MoveLeft:
+    case MovePrevious:
+        if (column > 0) {
+            target = row - 1;
+        }
+        break;
+    case MoveRight:
+    case MoveNext:
+        if (column + 1 < columns && row + 1 < count) {
+            target = row + 1;
+        }
+        break;
+    case MoveHome:
+        target = line * columns;
+        break;
+    case MoveEnd:
+        target = std::min(line * columns + columns - 1, count - 1);
+        break;
+    case MovePageUp:
+        target = column;
+        break;
+    case MovePageDown:
+        target = column + (count - 1 - column) / columns * columns;
+        break;
+    }
+    return m_model->index(target);
 }
 
-void GameListGrid::RepaintIcons(std::vector<game_info>& game_data, const QColor& icon_color,
-                                const QSize& icon_size, qreal device_pixel_ratio) {
-    m_icon_size = icon_size;
-    m_icon_color = icon_color;
+int GameListGrid::horizontalOffset() const {
+    return 0;
+}
 
-    QPixmap placeholder(icon_size * device_pixel_ratio);
-    placeholder.setDevicePixelRatio(device_pixel_ratio);
-    placeholder.fill(Qt::transparent);
-
-    const bool show_title =
-        m_icon_size.width() >
-        (GUI::game_list_icon_size_medium.width() + GUI::game_list_icon_size_small.width()) / 2;
-
-    for (game_info& game : game_data) {
-        if (GameListGridItem* item = static_cast<GameListGridItem*>(game->item)) {
-            if (item->getIconLoading()) {
-                // We already have an icon. Simply set the icon size to let the label scale itself
-                // in a quick and dirty fashion.
-                item->SetIconSize(m_icon_size);
-            } else {
-                // We don't have an icon. Set a placeholder to initialize the layout.
-                game->pxmap = placeholder;
-                item->getImageChangeCallback();
-            }
+int GameListGrid::verticalOffset() const {
+    return verticalScrollBar()->value();
+}
 
-            item->setIconLoadFunc(
-                [this, game, device_pixel_ratio, cancel = item->getIconLoadingAborted()](int) {
-                    IconLoadFunction(game, device_pixel_ratio, cancel);
-                });
+bool GameListGrid::isIndexHidden(const QModelIndex& /*index*/) const {
+    return false;
+}
 
-            item->AdjustSize();
-            item->ShowTitle(show_title);
-            item->got_visible = false;
+void GameListGrid::setSelection(const QRect& rect, QItemSelectionModel::SelectionFlags command) {
+    const QRect content = rect.normalized().translated(horizontalOffset(), verticalOffset());
+    QItemSelection selection;
+    const auto [first, last] = RowsIn(content);
+    for (int row = first; row < last; ++row) {
+        if (CellRect(row).intersects(content)) {
+            const QModelIndex index = m_model->index(row);
+            selection.select(index, index);
         }
     }
+    selectionModel()->select(selection, command);
 }
 
-void GameListGrid::FocusAndSelectFirstEntryIfNoneIs() {
-    if (!Items().empty()) {
-        Items().front()->setFocus();
+QRegion GameListGrid::visualRegionForSelection(const QItemSelection& selection) const {
+    QRegion region;
+    for (const QItemSelectionRange& range : selection) {
+        for (int row = range.top(); row <= range.bottom(); ++row) {
+            region += visualRect(m_model->index(row));
+        }
     }
+    return region;
 }
 
-bool GameListGrid::eventFilter(QObject* watched, QEvent* event) {
-    if (!event) {
-        return false;
+void GameListGrid::updateGeometries() {
+    const int columns = Columns();
+    const int lines = (m_model->rowCount() + columns - 1) / columns;
+    const int line_height = m_cell_size.height() + m_spacing;
+    const int content_height = lines > 0 ? 2 * m_margin + lines * line_height - m_spacing : 0;
+
+    verticalScrollBar()->setSingleStep(std::max(1, line_height / 4));
+    verticalScrollBar()->setPageStep(viewport()->height());
+    verticalScrollBar()->setRange(0, std::max(0, content_height - viewport()->height()));
+
+    QAbstractItemView::updateGeometries();
+    m_icon_priority_timer.start();
+}
+
+void GameListGrid::UpdateIconPriorities() {
+    const int count = m_model->rowCount();
+    const int page = viewport()->height();
+    const QRect visible(0, verticalOffset(), viewport()->width(), page);
+
+    // Everything within a page of the viewport is prefetched. Queued loads of the cells that
+    // left that range are dropped, so they are requested again once painted.
+    const std::pair<int, int> rows = RowsIn(visible.adjusted(0, -page, 0, page));
+    const auto [old_first, old_last] = m_prefetch_rows;
+    for (int row = old_first; row < std::min(old_last, count); ++row) {
+        if (row >= rows.first && row < rows.second) {
+            continue;
+        }
+        if (GameListGridItem* item = m_model->ExistingItem(row)) {
+            item->cancelPendingIconLoad();
+        }
     }
 
-    if (event->type() == QEvent::MouseButtonDblClick &&
-        static_cast<QMouseEvent*>(event)->button() == Qt::LeftButton) {
-        if (GameListGridItem* item = static_cast<GameListGridItem*>(watched)) {
-            Q_EMIT ItemDoubleClicked(item->Game());
-            return true;
+    for (int row = rows.first; row < rows.second; ++row) {
+        const QRect rect = CellRect(row);
+        int distance = 0;
+        if (rect.bottom() < visible.top()) {
+            distance = visible.top() - rect.bottom();
+        } else if (rect.top() > visible.bottom()) {
+            distance = rect.top() - visible.bottom();
         }
+        UpdateIconPrefetch(m_model->Item(row), row, distance, page);
     }
+    m_prefetch_rows = rows;
+}
 
-    return false;
+void GameListGrid::ReleaseIcon(GameItemBase* item) {
+    auto* grid_item = static_cast<GameListGridItem*>(item);
+    grid_item->SetIcon({});
+    // The cell requests its icon again once it is painted
+    grid_item->releaseIcon();
+    m_model->IconChanged(grid_item->Row());
+}
+
+void GameListGrid::FocusAndSelectFirstEntryIfNoneIs() {
+    if (!currentIndex().isValid() && m_model->rowCount() > 0) {
+        setCurrentIndex(m_model->index(0));
+    }
+    setFocus();
 }
 
 void GameListGrid::keyPressEvent(QKeyEvent* event) {
@@ -181,25 +436,93 @@ void GameListGrid::keyPressEvent(QKeyEvent* event) {
         return;
     }
 
-    FlowWidget::keyPressEvent(event);
+    QAbstractItemView::keyPressEvent(event);
+}
+
+void GameListGrid::mouseMoveEvent(QMouseEvent* event) {
+    const QModelIndex hovered = indexAt(event->position().toPoint());
+    if (hovered != m_hover_index) {
+        viewport()->update(visualRect(m_hover_index));
+        viewport()->update(visualRect(hovered));
+        m_hover_index = hovered;
+    }
+
+    QAbstractItemView::mouseMoveEvent(event);
+}
+
+void GameListGrid::mouseDoubleClickEvent(QMouseEvent* event) {
+    if (!event) {
+        return;
+    }
+
+    // Qt's doubleClicked signal doesn't distinguish between mouse buttons and there is no
+    // simple way to get the pressed button. So we have to ignore this event when another button is
+    // pressed.
+    if (event->button() != Qt::LeftButton) {
+        event->ignore();
+        return;
+    }
+
+    if (const QModelIndex index = indexAt(event->position().toPoint()); index.isValid()) {
+        Q_EMIT ItemDoubleClicked(m_model->Game(index.row()));
+        return;
+    }
+
+    QAbstractItemView::mouseDoubleClickEvent(event);
+}
+
+bool GameListGrid::viewportEvent(QEvent* event) {
+    if (event->type() == QEvent::Leave && m_hover_index.isValid()) {
+        viewport()->update(visualRect(m_hover_index));
+        m_hover_index = {};
+    }
+    return QAbstractItemView::viewportEvent(event);
 }
 
 void GameListGrid::paintEvent(QPaintEvent* event) {
-    QPainter painter(this);
+    QPainter painter(viewport());
     float opacity = static_cast<float>(
         m_gui_settings->GetValue(GUI::game_list_backgroundImageOpacity).toInt() / 100.f);
     painter.setOpacity(opacity);
 
     // Draw background first
+    const QRect area = viewport()->rect();
     if (!m_game_list_frame->backgroundImage.isNull() &&
         m_gui_settings->GetValue(GUI::game_list_showBackgroundImage).toBool()) {
-        QPixmap scaledPixmap =
-            QPixmap::fromImage(m_game_list_frame->backgroundImage)
-                .scaled(rect().size(), Qt::KeepAspectRatioByExpanding, Qt::SmoothTransformation);
-        int x = (rect().width() - scaledPixmap.width()) / 2;
-        int y = (rect().height() - scaledPixmap.height()) / 2;
-        painter.drawPixmap(x, y, scaledPixmap);
+        DrawBackground(painter, m_game_list_frame->backgroundImage, area);
     }
+    painter.setOpacity(1.0);
+
+    // Only the cells in the damaged part of the viewport are painted
+    const QRect content = event->rect().translated(horizontalOffset(), verticalOffset());
+    const auto [first, last] = RowsIn(content);
+    const QModelIndex current = currentIndex();
+
+    QStyleOptionViewItem option;
+    initViewItemOption(&option);
+    const QStyle::State base_state = option.state & ~(QStyle::State_Selected |
+                                                      QStyle::State_HasFocus |
+                                                      QStyle::State_MouseOver);
+    for (int row = first; row < last; ++row) {
+        const QModelIndex index = m_model->index(row);
+        option.rect = visualRect(index);
+        if (!option.rect.intersects(event->rect())) {
+            continue;
+        }
+
+        option.state = base_state;
+        if (selectionModel()->isSelected(index)) {
+            option.state |= QStyle::State_Selected;
+        }
+        if (hasFocus() && index == current) {
+            option.state |= QStyle::State_HasFocus;
+        }
+        if (index == m_hover_index) {
+            option.state |= QStyle::State_MouseOver;
+        }
 
-    QWidget::paintEvent(event);
+        // Also moves a prefetched load up once the cell becomes visible
+        m_model->Item(row)->getIconLoadFunc(row);
+        m_delegate->paint(&painter, option, index);
+    }
 }
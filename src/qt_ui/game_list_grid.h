@@ -4,17 +4,26 @@
 
 #pragma once
 
-#include "flow_widget.h"
 #include "game_list_base.h"
 #include "game_list_frame.h"
 
+#include <QAbstractItemView>
 #include <QKeyEvent>
+#include <QTimer>
 
-class GameListGrid : public FlowWidget, public GameListBase {
+class GameListGridDelegate;
+class GameListGridModel;
+
+/**
+ * Grid of game icons. Cells all have the same size, so their layout follows from the number of
+ * games and the viewport width, and only the cells inside the viewport are ever painted.
+ */
+class GameListGrid : public QAbstractItemView, public GameListBase {
     Q_OBJECT
 
 public:
     explicit GameListGrid(GameListFrame* frame, std::shared_ptr<GUISettings> gui_settings);
+    ~GameListGrid() override;
 
     void ClearList() override;
 
@@ -23,11 +32,18 @@ public:
                   const std::map<QString, QString>& title_map,
                   const std::string& selected_item_id) override;
 
-    void RepaintIcons(std::vector<game_info>& game_data, const QColor& icon_color,
+    void RepaintIcons(const std::vector<game_info>& game_data, const QColor& icon_color,
                       const QSize& icon_size, qreal device_pixel_ratio) override;
+    void PreviewIconSize(const QSize& icon_size, qreal device_pixel_ratio) override;
 
-    bool eventFilter(QObject* watched, QEvent* event) override;
-    void keyPressEvent(QKeyEvent* event) override;
+    /** Returns the game of the current cell, if any */
+    game_info SelectedGame() const;
+    /** Games in the cells the arrow keys move to from the current one, nearest first */
+    std::vector<game_info> NeighbourGames(int count) const;
+
+    QRect visualRect(const QModelIndex& index) const override;
+    void scrollTo(const QModelIndex& index, ScrollHint hint = EnsureVisible) override;
+    QModelIndex indexAt(const QPoint& point) const override;
 
 public Q_SLOTS:
     void FocusAndSelectFirstEntryIfNoneIs();
@@ -36,12 +52,47 @@ Q_SIGNALS:
     void FocusToSearchBar();
     void ItemDoubleClicked(const game_info& game);
     void ItemSelectionChanged(const game_info& game);
-    void IconReady(const game_info& game, const GameItemBase* item);
+    void IconReady(const game_info& game, const GameItemBase* item, const QImage& image,
+                   const QList<QImage>& mips);
+
+protected:
+    QModelIndex moveCursor(CursorAction cursor_action, Qt::KeyboardModifiers modifiers) override;
+    int horizontalOffset() const override;
+    int verticalOffset() const override;
+    bool isIndexHidden(const QModelIndex& index) const override;
+    void setSelection(const QRect& rect, QItemSelectionModel::SelectionFlags command) override;
+    QRegion visualRegionForSelection(const QItemSelection& selection) const override;
+    void updateGeometries() override;
+
+    void paintEvent(QPaintEvent* event) override;
+    void keyPressEvent(QKeyEvent* event) override;
+    void mouseMoveEvent(QMouseEvent* event) override;
+    void mouseDoubleClickEvent(QMouseEvent* event) override;
+    bool viewportEvent(QEvent* event) override;
 
 private:
+    /** Relayouts the cells for another icon size */
+    void SetCellIconSize(const QSize& icon_size);
+    /** Columns that fit into the viewport */
+    int Columns() const;
+    /** Cell rectangle in content coordinates, before scrolling */
+    QRect CellRect(int row) const;
+    /** Rows of the model inside the content rectangle, as [first, last) */
+    std::pair<int, int> RowsIn(const QRect& content_rect) const;
+
+    void UpdateIconPriorities();
+    void ReleaseIcon(GameItemBase* item) override;
+
     GameListFrame* m_game_list_frame{};
     std::shared_ptr<GUISettings> m_gui_settings;
-
-protected:
-    void paintEvent(QPaintEvent* event) override;
+    GameListGridModel* m_model{};
+    GameListGridDelegate* m_delegate{};
+    QTimer m_icon_priority_timer;
+    QSize m_cell_size{};
+    int m_spacing{};
+    int m_margin{};
+    qreal m_device_pixel_ratio = 1.0;
+    QPersistentModelIndex m_hover_index;
+    // Rows whose icons were last prefetched, as [first, last)
+    std::pair<int, int> m_prefetch_rows{};
 };
@@ -0,0 +1,85 @@
+// SPDX-FileCopyrightText: Copyright 2025-2026 shadLauncher4 Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <QFontMetrics>
+#include <QPainter>
+
+#include "game_list_grid_delegate.h"
+
+namespace {
+
+constexpr int cell_padding = 9;
+constexpr int title_spacing = 6;
+constexpr int title_lines = 2;
+constexpr int focus_border = 2;
+
+} // namespace
+
+GameListGridDelegate::GameListGridDelegate(QObject* parent) : QStyledItemDelegate(parent) {
+    m_title_font.setFamily("Lucida Grande");
+    m_title_font.setPointSize(8);
+    m_title_font.setWeight(QFont::DemiBold);
+}
+
+void GameListGridDelegate::SetIconSize(const QSize& icon_size) {
+    m_icon_size = icon_size;
+}
+
+void GameListGridDelegate::SetShowTitle(bool show_title) {
+    m_show_title = show_title;
+}
+
+QSize GameListGridDelegate::CellSize() const {
+    QSize size = m_icon_size + QSize(2 * cell_padding, 2 * cell_padding);
+    if (m_show_title) {
+        size.rheight() += title_spacing + QFontMetrics(m_title_font).height() * title_lines;
+    }
+    return size;
+}
+
+QSize GameListGridDelegate::sizeHint(const QStyleOptionViewItem& /*option*/,
+                                     const QModelIndex& /*index*/) const {
+    return CellSize();
+}
+
+void GameListGridDelegate::paint(QPainter* painter, const QStyleOptionViewItem& option,
+                                 const QModelIndex& index) const {
+    const bool selected = option.state & QStyle::State_Selected;
+    const bool focused = option.state & QStyle::State_HasFocus;
+    const bool hovered = option.state & QStyle::State_MouseOver;
+
+    painter->save();
+
+    // Same look the grid item widgets used to get from the stylesheet
+    if (hovered) {
+        painter->fillRect(option.rect, focused ? QColor(0, 127, 255) : QColor(148, 201, 255));
+    } else if (selected || focused) {
+        painter->fillRect(option.rect, QColor(173, 216, 230));
+    }
+    if (focused) {
+        painter->setPen(QPen(Qt::blue, focus_border));
+        painter->drawRect(option.rect.adjusted(focus_border / 2, focus_border / 2,
+                                               -focus_border / 2, -focus_border / 2));
+    }
+
+    const QRect icon_rect(option.rect.left() + (option.rect.width() - m_icon_size.width()) / 2,
+                          option.rect.top() + cell_padding, m_icon_size.width(),
+                          m_icon_size.height());
+    if (const QPixmap icon = index.data(Qt::DecorationRole).value<QPixmap>(); !icon.isNull()) {
+        // Only scales while the zoom slider previews another size
+        painter->setRenderHint(QPainter::SmoothPixmapTransform);
+        painter->drawPixmap(icon_rect, icon);
+    }
+
+    if (m_show_title) {
+        const QRect title_rect(icon_rect.left(), icon_rect.bottom() + 1 + title_spacing,
+                               icon_rect.width(),
+                               QFontMetrics(m_title_font).height() * title_lines);
+        painter->setFont(m_title_font);
+        painter->setPen(selected || focused || hovered ? QColor(Qt::white) : QColor(51, 51, 51));
+        painter->drawText(title_rect, Qt::AlignHCenter | Qt::AlignVCenter | Qt::TextWordWrap,
+                          index.data(Qt::DisplayRole).toString());
+    }
+
+    painter->restore();
+}
@@ -0,0 +1,27 @@
+// SPDX-FileCopyrightText: Copyright 2025-2026 shadLauncher4 Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <QStyledItemDelegate>
+
+/** Paints one game of the grid: its composed icon and, for larger icons, the title below it */
+class GameListGridDelegate : public QStyledItemDelegate {
+public:
+    explicit GameListGridDelegate(QObject* parent = nullptr);
+
+    void SetIconSize(const QSize& icon_size);
+    void SetShowTitle(bool show_title);
+
+    /** Size of every cell, the grid lays them out from this alone */
+    QSize CellSize() const;
+
+    void paint(QPainter* painter, const QStyleOptionViewItem& option,
+               const QModelIndex& index) const override;
+    QSize sizeHint(const QStyleOptionViewItem& option, const QModelIndex& index) const override;
+
+private:
+    QSize m_icon_size{};
+    bool m_show_title{};
+    QFont m_title_font;
+};
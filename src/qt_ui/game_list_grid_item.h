@@ -4,35 +4,33 @@
 
 #pragma once
 
-#include "flow_widget_item.h"
 #include "game_item_base.h"
-#include "game_list_base.h"
+#include "gui_game_info.h"
 
-#include <QLabel>
-
-class GameListGridItem : public FlowWidgetItem, public GameItemBase {
-    Q_OBJECT
+#include <QPixmap>
 
+/** Icon state of one grid cell. It is not a widget, the grid paints it through its delegate and
+ * only creates it once the cell is about to be shown. */
+class GameListGridItem : public GameItemBase {
 public:
-    GameListGridItem(QWidget* parent, game_info game, const QString& title);
-
-    void SetIconSize(const QSize& size);
-    void SetIcon(const QPixmap& pixmap);
-    void AdjustSize();
+    GameListGridItem(game_info game, int row);
 
     const game_info& Game() const {
         return m_game;
     }
 
-    void ShowTitle(bool visible);
+    int Row() const {
+        return m_row;
+    }
 
-    void PolishStyle() override;
+    const QPixmap& Icon() const {
+        return m_icon;
+    }
 
-    bool event(QEvent* event) override;
+    void SetIcon(const QPixmap& pixmap);
 
 private:
-    QSize m_icon_size{};
-    QLabel* m_icon_label{};
-    QLabel* m_title_label{};
     game_info m_game{};
+    int m_row{};
+    QPixmap m_icon{};
 };
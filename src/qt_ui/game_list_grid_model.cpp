@@ -0,0 +1,104 @@
+// SPDX-FileCopyrightText: Copyright 2025-2026 shadLauncher4 Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "game_list_grid_model.h"
+#include "gui_settings.h"
+
+GameListGridModel::GameListGridModel(QObject* parent) : QAbstractListModel(parent) {}
+
+GameListGridModel::~GameListGridModel() = default;
+
+void GameListGridModel::Reset(std::vector<game_info> games, std::map<QString, QString> titles,
+                              std::map<QString, QString> notes) {
+    beginResetModel();
+    ForEachItem([](GameListGridItem& item) {
+        if (item.Game()->item == &item) {
+            item.Game()->item = nullptr;
+        }
+    });
+    m_items.clear();
+    m_items.resize(games.size());
+    m_games = std::move(games);
+    m_titles = std::move(titles);
+    m_notes = std::move(notes);
+    endResetModel();
+}
+
+void GameListGridModel::Clear() {
+    Reset({}, {}, {});
+}
+
+int GameListGridModel::rowCount(const QModelIndex& parent) const {
+    return parent.isValid() ? 0 : static_cast<int>(m_games.size());
+}
+
+QVariant GameListGridModel::data(const QModelIndex& index, int role) const {
+    if (!index.isValid() || index.row() >= rowCount()) {
+        return {};
+    }
+
+    const int row = index.row();
+    switch (role) {
+    case Qt::DisplayRole:
+        return Title(row);
+    case Qt::DecorationRole:
+        if (const GameListGridItem* item = ExistingItem(row)) {
+            return item->Icon();
+        }
+        return {};
+    case Qt::ToolTipRole: {
+        const game_info& game = m_games[row];
+        const QString serial = QString::fromStdString(game->info.serial);
+        if (const auto it = m_notes.find(serial); it != m_notes.cend() && !it->second.isEmpty()) {
+            return QString("%0 [%1]\n\n%2\n%3")
+                .arg(Title(row))
+                .arg(serial)
+                .arg(tr("Notes:"))
+                .arg(it->second);
+        }
+        return QString("%0 [%1]").arg(Title(row)).arg(serial);
+    }
+    case GUI::game_role:
+        return QVariant::fromValue(m_games[row]);
+    default:
+        return {};
+    }
+}
+
+GameListGridItem* GameListGridModel::Item(int row) {
+    std::unique_ptr<GameListGridItem>& item = m_items[row];
+    if (!item) {
+        item = std::make_unique<GameListGridItem>(m_games[row], row);
+        m_games[row]->item = item.get();
+        if (m_item_initializer) {
+            m_item_initializer(*item);
+        }
+    }
+    return item.get();
+}
+
+GameListGridItem* GameListGridModel::ExistingItem(int row) const {
+    return m_items[row].get();
+}
+
+void GameListGridModel::ForEachItem(const std::function<void(GameListGridItem&)>& func) const {
+    for (const auto& item : m_items) {
+        if (item) {
+            func(*item);
+        }
+    }
+}
+
+void GameListGridModel::IconChanged(int row) {
+    const QModelIndex changed = index(row);
+    Q_EMIT dataChanged(changed, changed, {Qt::DecorationRole});
+}
+
+QString GameListGridModel::Title(int row) const {
+    const game_info& game = m_games[row];
+    if (const auto it = m_titles.find(QString::fromStdString(game->info.serial));
+        it != m_titles.cend()) {
+        return it->second.simplified();
+    }
+    return QString::fromStdString(game->info.name).simplified();
+}
@@ -0,0 +1,63 @@
+// SPDX-FileCopyrightText: Copyright 2025-2026 shadLauncher4 Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <vector>
+#include <QAbstractListModel>
+
+#include "game_list_grid_item.h"
+
+/**
+ * Games shown by the grid, one row per game.
+ *
+ * Titles, tool tips and icons are produced when a cell asks for them. The per game icon state is
+ * created on first use, so populating the grid does not depend on how many games are hidden
+ * below the fold.
+ */
+class GameListGridModel : public QAbstractListModel {
+    Q_OBJECT
+
+public:
+    explicit GameListGridModel(QObject* parent = nullptr);
+    ~GameListGridModel() override;
+
+    void Reset(std::vector<game_info> games, std::map<QString, QString> titles,
+               std::map<QString, QString> notes);
+    void Clear();
+
+    int rowCount(const QModelIndex& parent = QModelIndex()) const override;
+    QVariant data(const QModelIndex& index, int role) const override;
+
+    const game_info& Game(int row) const {
+        return m_games[row];
+    }
+
+    /** Returns the icon state of a row, creating it on first use */
+    GameListGridItem* Item(int row);
+    /** Returns the icon state of a row if it was created already */
+    GameListGridItem* ExistingItem(int row) const;
+
+    /** Calls func for every icon state created so far */
+    void ForEachItem(const std::function<void(GameListGridItem&)>& func) const;
+
+    /** Called for every new icon state, before it is handed out */
+    void SetItemInitializer(std::function<void(GameListGridItem&)> func) {
+        m_item_initializer = std::move(func);
+    }
+
+    /** Tells the views that the icon of a row changed */
+    void IconChanged(int row);
+
+private:
+    QString Title(int row) const;
+
+    std::vector<game_info> m_games;
+    std::vector<std::unique_ptr<GameListGridItem>> m_items;
+    std::map<QString, QString> m_titles;
+    std::map<QString, QString> m_notes;
+    std::function<void(GameListGridItem&)> m_item_initializer;
+};
@@ -2,18 +2,18 @@
 // SPDX-FileCopyrightText: Copyright 2025-2026 shadLauncher4 Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
 #include <QHeaderView>
 #include <QScrollBar>
 #include <QStringBuilder>
 #include "common/fs_util.h"
-#include "custom_table_widget_item.h"
+#include "game_item.h"
 #include "game_list_delegate.h"
 #include "game_list_frame.h"
 #include "game_list_table.h"
+#include "game_list_table_model.h"
 #include "gui_settings.h"
-#include "localized.h"
 #include "persistent_settings.h"
-#include "qt_utils.h"
 
 GameListTable::GameListTable(GameListFrame* frame, std::shared_ptr<GUISettings> gui_settings,
                              std::shared_ptr<PersistentSettings> persistent_settings)
@@ -38,28 +38,64 @@ GameListTable::GameListTable(GameListFrame* frame, std::shared_ptr<GUISettings>
     horizontalHeader()->setDefaultSectionSize(150);
     horizontalHeader()->setDefaultAlignment(Qt::AlignLeft);
     setContextMenuPolicy(Qt::CustomContextMenu);
-    setColumnCount(static_cast<int>(GUI::GameListColumns::count));
+
+    m_model->SetItemInitializer([this](GameItem& item) {
+        item.setIconLoadFunc([this, game = item.Game(), device_pixel_ratio = m_device_pixel_ratio,
+                              cancel = item.getIconLoadingAborted()](int) {
+            IconLoadFunction(game, device_pixel_ratio, cancel);
+        });
+
+        item.setSizeCalcFunc([this, game = item.Game(),
+                              cancel = item.getSizeOnDiskLoadingAborted()]() {
+            if (!game || game->info.size_on_disk != UINT64_MAX || (cancel && cancel->load()))
+                return;
+
+            // Calculate main game folder size
+            uint64_t total_size = FS::Utils::GetDirSize(game->info.path, 1, cancel.get());
+
+            // Check for "-UPDATE" and "-PATCH" folders
+            for (const auto& suffix : {"-UPDATE", "-patch"}) {
+                std::filesystem::path extra_path = game->info.path;
+                extra_path += suffix;
+
+                if (std::filesystem::exists(extra_path) && (!cancel || !cancel->load())) {
+                    total_size += FS::Utils::GetDirSize(extra_path.string(), 1, cancel.get());
+                    break; // if update founds don't search for -patch
+                }
+            }
+
+            game->info.size_on_disk = total_size;
+
+            if (!cancel || !cancel->load()) {
+                Q_EMIT sizeOnDiskReady(game, game->item);
+            }
+        });
+    });
+
+    // Re-evaluated at most once per frame while scrolling
+    m_icon_priority_timer.setSingleShot(true);
+    m_icon_priority_timer.setInterval(16);
+    connect(&m_icon_priority_timer, &QTimer::timeout, this, &GameListTable::UpdateIconPriorities);
+    connect(verticalScrollBar(), &QScrollBar::valueChanged, &m_icon_priority_timer,
+            qOverload<>(&QTimer::start));
     setMouseTracking(true);
 
     connect(this, &GameListTable::sizeOnDiskReady, this,
             [this](const game_info& game, GameItemBase* item) {
                 if (!game || !game->item || game->item != item)
                     return;
-                if (QTableWidgetItem* size_item =
-                        this->item(static_cast<GameItem*>(game->item)->row(),
-                                   static_cast<int>(GUI::GameListColumns::dir_size))) {
-                    const u64& game_size = game->info.size_on_disk;
-                    size_item->setText(game_size != UINT64_MAX
-                                           ? GUI::Utils::FormatByteSize(game_size)
-                                           : tr("Unknown"));
-                    size_item->setData(Qt::UserRole, QVariant::fromValue<qulonglong>(game_size));
-                }
+                m_model->SizeOnDiskChanged(*static_cast<GameItem*>(game->item));
             });
 
     connect(this, &GameList::IconReady, this,
-            [this](const game_info& game, const GameItemBase* item) {
-                if (game && item && game->item == item)
-                    item->getImageChangeCallback();
+            [this](const game_info& game, const GameItemBase* item, const QImage& image,
+                   const QList<QImage>& mips) {
+                if (game && item && game->item == item) {
+                    auto* game_item = static_cast<GameItem*>(game->item);
+                    game_item->SetIcon(QPixmap::fromImage(image));
+                    TrackIcon(game_item, image, mips);
+                    m_model->IconChanged(*game_item);
+                }
             });
 }
 
@@ -99,11 +135,11 @@ void GameListTable::resizeColumnsToContents(int spacing) {
     }
 }
 
-void GameListTable::adjustIconColumn() {
+void GameListTable::adjustIconColumn(const QSize& icon_size) {
     // Fixate vertical header and row height
-    verticalHeader()->setDefaultSectionSize(m_icon_size.height());
-    verticalHeader()->setMinimumSectionSize(m_icon_size.height());
-    verticalHeader()->setMaximumSectionSize(m_icon_size.height());
+    verticalHeader()->setDefaultSectionSize(icon_size.height());
+    verticalHeader()->setMinimumSectionSize(icon_size.height());
+    verticalHeader()->setMaximumSectionSize(icon_size.height());
 
     // Resize the icon column
     resizeColumnToContents(static_cast<int>(GUI::GameListColumns::icon));
@@ -134,6 +170,8 @@ void GameListTable::sort(u64 game_count, int sort_column, Qt::SortOrder col_sort
 
     // Sort the list by column and sort order
     sortByColumn(sort_column, col_sort_order);
+    m_prefetch_rows = {};
+    m_icon_priority_timer.start();
 
     // Hide columns again
     for (int col : columns_to_hide) {
@@ -176,231 +214,121 @@ void GameListTable::SetCustomConfigIcon(const game_info& game) {
         return;
     }
 
-    const QString serial = QString::fromStdString(game->info.serial);
-
-    for (int row = 0; row < rowCount(); ++row) {
-        if (QTableWidgetItem* title_item =
-                item(row, static_cast<int>(GUI::GameListColumns::name))) {
-            if (const QTableWidgetItem* serial_item =
-                    item(row, static_cast<int>(GUI::GameListColumns::serial));
-                serial_item && serial_item->text() == serial) {
-                title_item->setIcon(GameListBase::GetCustomConfigIcon(game));
-            }
-        }
-    }
+    m_model->CustomConfigChanged(QString::fromStdString(game->info.serial));
 }
 
 void GameListTable::Populate(const std::vector<game_info>& game_data,
                              const std::map<QString, QString>& notes_map,
                              const std::map<QString, QString>& title_map,
                              const std::string& selected_item_id) {
-    ClearList();
-
-    setRowCount(static_cast<int>(game_data.size()));
+    clearSelection();
+    m_prefetch_rows = {};
 
-    // Default locale. Uses current Qt application language.
-    const QLocale locale{};
-    const Localized localized;
+    m_model->SetDevicePixelRatio(devicePixelRatioF());
+    m_model->Reset(game_data, title_map, notes_map, *m_persistent_settings);
 
-    int row = 0;
-    int index = -1;
-    int selected_row = -1;
-
-    const auto get_title = [&title_map](const QString& serial, const std::string& name) -> QString {
-        if (const auto it = title_map.find(serial); it != title_map.cend()) {
-            return it->second;
+    for (int row = 0; row < rowCount(); ++row) {
+        const game_info game = Game(model()->index(row, 0));
+        if (selected_item_id == game->info.path + game->info.icon_path) {
+            selectRow(row);
+            break;
         }
+    }
 
-        return QString::fromStdString(name);
-    };
-
-    for (const auto& game : game_data) {
-        index++;
-
-        const QString serial = QString::fromStdString(game->info.serial);
-        const QString title = get_title(serial, game->info.name);
-
-        // Icon
-        CustomTableWidgetItem* icon_item = new CustomTableWidgetItem;
-        game->item = icon_item;
-
-        icon_item->setImageChangeCallback([this, icon_item, game]() {
-            if (!icon_item || !game) {
-                return;
-            }
-
-            std::lock_guard lock(icon_item->pixmap_mutex);
-
-            if (!game->pxmap.isNull()) {
-                icon_item->setData(Qt::DecorationRole, game->pxmap);
-                game->pxmap = {};
-            }
-        });
-
-        icon_item->setSizeCalcFunc(
-            [this, game, cancel = icon_item->getSizeOnDiskLoadingAborted()]() {
-                if (!game || game->info.size_on_disk != UINT64_MAX || (cancel && cancel->load()))
-                    return;
-
-                // Calculate main game folder size
-                uint64_t total_size = FS::Utils::GetDirSize(game->info.path, 1, cancel.get());
-
-                // Check for "-UPDATE" and "-PATCH" folders
-                for (const auto& suffix : {"-UPDATE", "-patch"}) {
-                    std::filesystem::path extra_path = game->info.path;
-                    extra_path += suffix;
+    m_icon_priority_timer.start();
+}
 
-                    if (std::filesystem::exists(extra_path) && (!cancel || !cancel->load())) {
-                        total_size += FS::Utils::GetDirSize(extra_path.string(), 1, cancel.get());
-                        break; // if update founds don't search for -patch
-                    }
-                }
+void GameListTable::RepaintIcons(const std::vector<game_info>& game_data,
+                                 const QColor& icon_color, const QSize& icon_size,
+                                 qreal device_pixel_ratio) {
+    GameListBase::RepaintIcons(game_data, icon_color, icon_size, device_pixel_ratio);
+    m_device_pixel_ratio = device_pixel_ratio;
+
+    // Rows show the placeholder until their icon of the new size is ready
+    m_model->SetIconPlaceholder(m_icon_placeholder);
+    m_model->ForEachItem([this](GameItem& item) {
+        item.SetIcon({});
+        m_model->IconChanged(item);
+    });
+
+    adjustIconColumn(m_icon_size);
+    m_prefetch_rows = {};
+    m_icon_priority_timer.start();
+}
 
-                game->info.size_on_disk = total_size;
+void GameListTable::PreviewIconSize(const QSize& icon_size, qreal device_pixel_ratio) {
+    adjustIconColumn(icon_size);
 
-                if (!cancel || !cancel->load()) {
-                    Q_EMIT sizeOnDiskReady(game, game->item);
-                }
-            });
-
-        icon_item->setData(Qt::UserRole, index, true);
-        icon_item->setData(GUI::CustomRoles::game_role, QVariant::fromValue(game));
-
-        // Title
-        CustomTableWidgetItem* title_item = new CustomTableWidgetItem(title);
-        title_item->setIcon(GameListBase::GetCustomConfigIcon(game));
-
-        // Serial
-        CustomTableWidgetItem* serial_item = new CustomTableWidgetItem(game->info.serial);
-
-        if (const auto it = notes_map.find(serial);
-            it != notes_map.cend() && !it->second.isEmpty()) {
-            const QString tool_tip = QString("%0 [%1]\n\n%2\n%3")
-                                         .arg(title)
-                                         .arg(serial)
-                                         .arg(tr("Notes:"))
-                                         .arg(it->second);
-            title_item->setToolTip(tool_tip);
-            serial_item->setToolTip(tool_tip);
-        }
+    // Rows only paint their decoration at its own size, so scale the visible ones
+    const int icon_column = static_cast<int>(GUI::GameListColumns::icon);
+    const QSize pixel_size = icon_size * device_pixel_ratio;
+    const int first_row = std::max(rowAt(0), 0);
+    int last_row = rowAt(viewport()->height() - 1);
+    if (last_row < 0) {
+        last_row = rowCount() - 1;
+    }
 
-        // Compatibility
-        CustomTableWidgetItem* compat_item = new CustomTableWidgetItem;
-        compat_item->setText(game->compat.text);
-
-        compat_item->setData(Qt::UserRole, game->compat.index, true);
-        if (game->compat.index <= 4) {
-            QString tooltip_string =
-                "<p>" + tr("Last updated") +
-                QString(": %1 (%2)")
-                    .arg(game->compat.last_tested_date, game->compat.latest_version) +
-                "<br>" + game->compat.tooltip + "</p>";
-            compat_item->setToolTip(tooltip_string);
-        } else {
-            compat_item->setToolTip(game->compat.tooltip);
-        }
-        if (!game->compat.color.isEmpty()) {
-            compat_item->setData(
-                Qt::DecorationRole,
-                GUI::Utils::CirclePixmap(game->compat.color, devicePixelRatioF() * 2));
+    for (int row = first_row; row <= last_row; ++row) {
+        GameItem* item = ExistingItem(row);
+        if (!item) {
+            continue;
         }
-
-        CustomTableWidgetItem* region_item = new CustomTableWidgetItem;
-        QImage scaledPixmap;
-        if (game->info.region == "Japan") {
-            scaledPixmap = QImage(":images/flag_jp.png");
-            region_item->setToolTip(tr("Japan"));
-        } else if (game->info.region == "Europe") {
-            scaledPixmap = QImage(":images/flag_eu.png");
-            region_item->setToolTip(tr("Europe"));
-        } else if (game->info.region == "USA") {
-            scaledPixmap = QImage(":images/flag_us.png");
-            region_item->setToolTip(tr("USA"));
-        } else if (game->info.region == "Asia") {
-            scaledPixmap = QImage(":images/flag_china.png");
-            region_item->setToolTip(tr("Asia"));
-        } else if (game->info.region == "World") {
-            scaledPixmap = QImage(":images/flag_world.png");
-            region_item->setToolTip(tr("World"));
-        } else {
-            scaledPixmap = QImage(":images/flag_unk.png");
-            region_item->setToolTip(tr("Unknown"));
+        if (const QPixmap* mip = NearestIconMip(item, pixel_size.width())) {
+            QPixmap preview = mip->scaled(pixel_size, Qt::KeepAspectRatio, Qt::FastTransformation);
+            preview.setDevicePixelRatio(device_pixel_ratio);
+            item->SetIcon(preview);
+            m_model->IconChanged(*item);
         }
-        QPixmap pixmap = QPixmap::fromImage(
-            scaledPixmap.scaled(64 * devicePixelRatioF(), 44 * devicePixelRatioF(),
-                                Qt::KeepAspectRatio, Qt::SmoothTransformation));
-
-        pixmap.setDevicePixelRatio(devicePixelRatioF());
-        region_item->setData(Qt::DecorationRole, pixmap);
-        region_item->setData(Qt::UserRole, region_item->toolTip(),
-                             true); // make it sortable by region name
-
-        // Playtimes
-        const quint64 elapsed_ms = m_persistent_settings->GetPlaytime(serial);
+    }
+    resizeColumnToContents(icon_column);
+}
 
-        // Last played (support outdated values)
-        QDateTime last_played;
-        const QString last_played_str = m_persistent_settings->GetLastPlayed(serial);
+void GameListTable::ReleaseIcon(GameItemBase* item) {
+    auto* game_item = static_cast<GameItem*>(item);
+    game_item->SetIcon({});
+    // The delegate requests the icon again once the row is painted
+    game_item->releaseIcon();
+    m_model->IconChanged(*game_item);
+}
 
-        if (!last_played_str.isEmpty()) {
-            last_played =
-                QDateTime::fromString(last_played_str, GUI::Persistent::last_played_date_format);
+void GameListTable::UpdateIconPriorities() {
+    const int icon_column = static_cast<int>(GUI::GameListColumns::icon);
+    const int first_visible = rowAt(0);
+    if (isColumnHidden(icon_column) || first_visible < 0) {
+        return;
+    }
 
-            if (!last_played.isValid()) {
-                last_played = QDateTime::fromString(last_played_str,
-                                                    GUI::Persistent::last_played_date_format_old);
-            }
+    int last_visible = rowAt(viewport()->height() - 1);
+    if (last_visible < 0) {
+        last_visible = rowCount() - 1;
+    }
+    const int page = last_visible - first_visible + 1;
+
+    // Rows within a page of the viewport are prefetched. Queued loads of the rows that left that
+    // range are dropped, so they are requested again once painted.
+    const int count = rowCount();
+    const int first = std::max(0, first_visible - page);
+    const int last = std::min(count, last_visible + page + 1);
+    const auto [old_first, old_last] = m_prefetch_rows;
+    for (int row = old_first; row < std::min(old_last, count); ++row) {
+        if (row >= first && row < last) {
+            continue;
         }
-
-        const u64 game_size = game->info.size_on_disk;
-
-        setItem(row, static_cast<int>(GUI::GameListColumns::icon), icon_item);
-        setItem(row, static_cast<int>(GUI::GameListColumns::name), title_item);
-        setItem(row, static_cast<int>(GUI::GameListColumns::compat), compat_item);
-        setItem(row, static_cast<int>(GUI::GameListColumns::serial), serial_item);
-        setItem(row, static_cast<int>(GUI::GameListColumns::region), region_item);
-        double fw_value = std::stod(game->info.fw);
-        auto* fw_item = new CustomTableWidgetItem(QString::fromStdString(game->info.fw),
-                                                  Qt::UserRole, QVariant(fw_value));
-        setItem(row, static_cast<int>(GUI::GameListColumns::firmware), fw_item);
-
-        double app_value = std::stod(game->info.app_ver);
-        auto* app_item = new CustomTableWidgetItem(QString::fromStdString(game->info.app_ver),
-                                                   Qt::UserRole, QVariant(app_value));
-        setItem(row, static_cast<int>(GUI::GameListColumns::version), app_item);
-
-        setItem(row, static_cast<int>(GUI::GameListColumns::last_play),
-                new CustomTableWidgetItem(
-                    locale.toString(last_played,
-                                    last_played >= QDateTime::currentDateTime().addDays(-7)
-                                        ? GUI::Persistent::last_played_date_with_time_of_day_format
-                                        : GUI::Persistent::last_played_date_format_new),
-                    Qt::UserRole, last_played));
-        setItem(row, static_cast<int>(GUI::GameListColumns::play_time),
-                new CustomTableWidgetItem(
-                    elapsed_ms == 0 ? tr("Never played") : localized.getVerboseTimeByMs(elapsed_ms),
-                    Qt::UserRole, elapsed_ms));
-        setItem(row, static_cast<int>(GUI::GameListColumns::dir_size),
-                new CustomTableWidgetItem(
-                    game_size != UINT64_MAX ? GUI::Utils::FormatByteSize(game_size) : tr("Unknown"),
-                    Qt::UserRole, QVariant::fromValue<qulonglong>(game_size)));
-        setItem(row, static_cast<int>(GUI::GameListColumns::path),
-                new CustomTableWidgetItem(game->info.path));
-
-        if (selected_item_id == game->info.path + game->info.icon_path) {
-            selected_row = row;
+        if (GameItem* item = ExistingItem(row)) {
+            item->cancelPendingIconLoad();
         }
-
-        row++;
     }
 
-    selectRow(selected_row);
-}
-
-void GameListTable::RepaintIcons(std::vector<game_info>& game_data, const QColor& icon_color,
-                                 const QSize& icon_size, qreal device_pixel_ratio) {
-    GameListBase::RepaintIcons(game_data, icon_color, icon_size, device_pixel_ratio);
-    adjustIconColumn();
+    for (int row = first; row < last; ++row) {
+        int distance = 0;
+        if (row < first_visible) {
+            distance = first_visible - row;
+        } else if (row > last_visible) {
+            distance = row - last_visible;
+        }
+        UpdateIconPrefetch(Item(row), row, distance, page);
+    }
+    m_prefetch_rows = {first, last};
 }
 
 void GameListTable::paintEvent(QPaintEvent* event) {
@@ -412,15 +340,9 @@ void GameListTable::paintEvent(QPaintEvent* event) {
     // Draw background first
     if (!m_game_list_frame->backgroundImage.isNull() &&
         m_gui_settings->GetValue(GUI::game_list_showBackgroundImage).toBool()) {
-        QPixmap scaledPixmap = QPixmap::fromImage(m_game_list_frame->backgroundImage)
-                                   .scaled(viewport()->size(), Qt::KeepAspectRatioByExpanding,
-                                           Qt::SmoothTransformation);
-
-        int x = (viewport()->width() - scaledPixmap.width()) / 2;
-        int y = (viewport()->height() - scaledPixmap.height()) / 2;
-        painter.drawPixmap(x, y, scaledPixmap);
+        DrawBackground(painter, m_game_list_frame->backgroundImage, viewport()->rect());
     }
 
     // Now draw the table contents on top
-    QTableWidget::paintEvent(event);
+    QTableView::paintEvent(event);
 }
@@ -4,6 +4,8 @@
 
 #pragma once
 
+#include <QTimer>
+
 #include "game_list.h"
 
 class PersistentSettings;
@@ -22,7 +24,7 @@ public:
     /** Resizes the columns to their contents and adds a small spacing */
     void resizeColumnsToContents(int spacing = 20);
 
-    void adjustIconColumn();
+    void adjustIconColumn(const QSize& icon_size);
 
     void sort(u64 game_count, int sort_column, Qt::SortOrder col_sort_order);
 
@@ -33,16 +35,24 @@ public:
                   const std::map<QString, QString>& title_map,
                   const std::string& selected_item_id) override;
 
-    void RepaintIcons(std::vector<game_info>& game_data, const QColor& icon_color,
+    void RepaintIcons(const std::vector<game_info>& game_data, const QColor& icon_color,
                       const QSize& icon_size, qreal device_pixel_ratio) override;
+    void PreviewIconSize(const QSize& icon_size, qreal device_pixel_ratio) override;
 
 Q_SIGNALS:
     void sizeOnDiskReady(const game_info& game, GameItemBase* item);
 
 private:
+    void UpdateIconPriorities();
+    void ReleaseIcon(GameItemBase* item) override;
+
     GameListFrame* m_game_list_frame{};
     std::shared_ptr<PersistentSettings> m_persistent_settings;
     std::shared_ptr<GUISettings> m_gui_settings;
+    QTimer m_icon_priority_timer;
+    qreal m_device_pixel_ratio = 1.0;
+    // Rows whose icons were last prefetched, as [first, last)
+    std::pair<int, int> m_prefetch_rows{};
 
 protected:
     void paintEvent(QPaintEvent* event) override;
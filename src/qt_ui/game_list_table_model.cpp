@@ -0,0 +1,434 @@
+// SPDX-FileCopyrightText: Copyright 2025-2026 shadLauncher4 Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <array>
+#include <QCollator>
+#include <QCoreApplication>
+#include <QLocale>
+
+#include "game_list_base.h"
+#include "game_list_table_model.h"
+#include "gui_settings.h"
+#include "persistent_settings.h"
+#include "qt_utils.h"
+
+namespace {
+
+// Texts keep the translation context of the table widget that used to show them
+
+struct Region {
+    const char* name;
+    const char* flag_image;
+};
+
+constexpr std::array<Region, 5> regions = {{
+    {QT_TRANSLATE_NOOP("GameListTable", "Japan"), ":images/flag_jp.png"},
+    {QT_TRANSLATE_NOOP("GameListTable", "Europe"), ":images/flag_eu.png"},
+    {QT_TRANSLATE_NOOP("GameListTable", "USA"), ":images/flag_us.png"},
+    {QT_TRANSLATE_NOOP("GameListTable", "Asia"), ":images/flag_china.png"},
+    {QT_TRANSLATE_NOOP("GameListTable", "World"), ":images/flag_world.png"},
+}};
+
+const Region* FindRegion(const std::string& name) {
+    const auto it = std::find_if(regions.begin(), regions.end(),
+                                 [&name](const Region& region) { return name == region.name; });
+    return it != regions.end() ? &*it : nullptr;
+}
+
+QString RegionName(const std::string& name) {
+    const Region* region = FindRegion(name);
+    return QCoreApplication::translate(
+        "GameListTable", region ? region->name : QT_TRANSLATE_NOOP("GameListTable", "Unknown"));
+}
+
+QDateTime ParseLastPlayed(const QString& last_played_str) {
+    if (last_played_str.isEmpty()) {
+        return {};
+    }
+
+    // Support outdated values
+    QDateTime last_played =
+        QDateTime::fromString(last_played_str, GUI::Persistent::last_played_date_format);
+    if (!last_played.isValid()) {
+        last_played =
+            QDateTime::fromString(last_played_str, GUI::Persistent::last_played_date_format_old);
+    }
+    return last_played;
+}
+
+} // namespace
+
+GameListTableModel::GameListTableModel(QObject* parent) : QAbstractTableModel(parent) {
+    m_headers.resize(static_cast<int>(GUI::GameListColumns::count));
+}
+
+GameListTableModel::~GameListTableModel() = default;
+
+void GameListTableModel::Reset(std::vector<game_info> games,
+                               const std::map<QString, QString>& titles,
+                               const std::map<QString, QString>& notes,
+                               PersistentSettings& persistent_settings) {
+    beginResetModel();
+    ForEachItem([](GameItem& item) {
+        if (item.Game()->item == &item) {
+            item.Game()->item = nullptr;
+        }
+    });
+    m_entries.clear();
+    m_entries.resize(games.size());
+    m_order.resize(games.size());
+    m_rows.resize(games.size());
+    m_title_keys.clear();
+    m_title_keys.reserve(games.size());
+
+    QCollator collator;
+    collator.setCaseSensitivity(Qt::CaseInsensitive);
+    collator.setNumericMode(true);
+
+    for (std::size_t i = 0; i < games.size(); ++i) {
+        Entry& entry = m_entries[i];
+        entry.game = std::move(games[i]);
+        const GameInfo& info = entry.game->info;
+
+        entry.serial = QString::fromStdString(info.serial).simplified();
+        if (const auto it = titles.find(entry.serial); it != titles.cend()) {
+            entry.title = it->second.simplified();
+        } else {
+            entry.title = QString::fromStdString(info.name).simplified();
+        }
+        m_title_keys.push_back(collator.sortKey(entry.title));
+
+        if (const auto it = notes.find(entry.serial);
+            it != notes.cend() && !it->second.isEmpty()) {
+            entry.notes_tool_tip = QString("%0 [%1]\n\n%2\n%3")
+                                       .arg(entry.title)
+                                       .arg(entry.serial)
+                                       .arg(QCoreApplication::translate("GameListTable", "Notes:"))
+                                       .arg(it->second);
+        }
+
+        entry.region = RegionName(info.region);
+        entry.firmware = std::stod(info.fw);
+        entry.version = std::stod(info.app_ver);
+        entry.last_played = ParseLastPlayed(persistent_settings.GetLastPlayed(entry.serial));
+        entry.play_time = persistent_settings.GetPlaytime(entry.serial);
+
+        m_order[i] = i;
+        m_rows[i] = static_cast<int>(i);
+    }
+    endResetModel();
+}
+
+void GameListTableModel::Clear() {
+    beginResetModel();
+    ForEachItem([](GameItem& item) {
+        if (item.Game()->item == &item) {
+            item.Game()->item = nullptr;
+        }
+    });
+    m_entries.clear();
+    m_order.clear();
+    m_rows.clear();
+    m_title_keys.clear();
+    endResetModel();
+}
+
+int GameListTableModel::rowCount(const QModelIndex& parent) const {
+    return parent.isValid() ? 0 : static_cast<int>(m_entries.size());
+}
+
+int GameListTableModel::columnCount(const QModelIndex& parent) const {
+    return parent.isValid() ? 0 : static_cast<int>(GUI::GameListColumns::count);
+}
+
+QVariant GameListTableModel::data(const QModelIndex& index, int role) const {
+    if (!index.isValid() || index.row() >= rowCount()) {
+        return {};
+    }
+
+    const Entry& entry = m_entries[m_order[index.row()]];
+    switch (role) {
+    case Qt::DisplayRole:
+        return DisplayData(entry, index.column());
+    case Qt::DecorationRole:
+        return DecorationData(entry, index.column());
+    case Qt::ToolTipRole:
+        return ToolTipData(entry, index.column());
+    case GUI::game_role:
+        return QVariant::fromValue(entry.game);
+    default:
+        return {};
+    }
+}
+
+QVariant GameListTableModel::DisplayData(const Entry& entry, int column) const {
+    const GameInfo& info = entry.game->info;
+
+    switch (static_cast<GUI::GameListColumns>(column)) {
+    case GUI::GameListColumns::name:
+        return entry.title;
+    case GUI::GameListColumns::compat:
+        return entry.game->compat.text;
+    case GUI::GameListColumns::serial:
+        return entry.serial;
+    case GUI::GameListColumns::firmware:
+        return QString::fromStdString(info.fw);
+    case GUI::GameListColumns::version:
+        return QString::fromStdString(info.app_ver);
+    case GUI::GameListColumns::last_play: {
+        // Default locale. Uses current Qt application language.
+        const QLocale locale{};
+        return locale.toString(entry.last_played,
+                               entry.last_played >= QDateTime::currentDateTime().addDays(-7)
+                                   ? GUI::Persistent::last_played_date_with_time_of_day_format
+                                   : GUI::Persistent::last_played_date_format_new);
+    }
+    case GUI::GameListColumns::play_time:
+        if (entry.play_time == 0) {
+            return QCoreApplication::translate("GameListTable", "Never played");
+        }
+        return m_localized.getVerboseTimeByMs(entry.play_time);
+    case GUI::GameListColumns::dir_size:
+        if (info.size_on_disk == UINT64_MAX) {
+            return QCoreApplication::translate("GameListTable", "Unknown");
+        }
+        return GUI::Utils::FormatByteSize(info.size_on_disk);
+    case GUI::GameListColumns::path:
+        return QString::fromStdString(info.path).simplified();
+    default:
+        return {};
+    }
+}
+
+QVariant GameListTableModel::DecorationData(const Entry& entry, int column) const {
+    switch (static_cast<GUI::GameListColumns>(column)) {
+    case GUI::GameListColumns::icon:
+        if (entry.item && !entry.item->Icon().isNull()) {
+            return entry.item->Icon();
+        }
+        return m_icon_placeholder;
+    case GUI::GameListColumns::name:
+        return GameListBase::GetCustomConfigIcon(entry.game);
+    case GUI::GameListColumns::compat: {
+        const QString& color = entry.game->compat.color;
+        if (color.isEmpty()) {
+            return {};
+        }
+        auto it = m_compat_circles.find(color);
+        if (it == m_compat_circles.end()) {
+            it = m_compat_circles.insert(
+                color, GUI::Utils::CirclePixmap(color, m_device_pixel_ratio * 2));
+        }
+        return *it;
+    }
+    case GUI::GameListColumns::region:
+        return RegionFlag(entry.game->info.region);
+    default:
+        return {};
+    }
+}
+
+QVariant GameListTableModel::ToolTipData(const Entry& entry, int column) const {
+    const Compat::Status& compat = entry.game->compat;
+
+    switch (static_cast<GUI::GameListColumns>(column)) {
+    case GUI::GameListColumns::name:
+    case GUI::GameListColumns::serial:
+        if (!entry.notes_tool_tip.isEmpty()) {
+            return entry.notes_tool_tip;
+        }
+        return {};
+    case GUI::GameListColumns::compat:
+        if (compat.index <= 4) {
+            return "<p>" + QCoreApplication::translate("GameListTable", "Last updated") +
+                   QString(": %1 (%2)").arg(compat.last_tested_date, compat.latest_version) +
+                   "<br>" + compat.tooltip + "</p>";
+        }
+        return compat.tooltip;
+    case GUI::GameListColumns::region:
+        return entry.region;
+    default:
+        return {};
+    }
+}
+
+const QPixmap& GameListTableModel::RegionFlag(const std::string& region) const {
+    auto [it, inserted] = m_region_flags.try_emplace(region);
+    if (inserted) {
+        const Region* found = FindRegion(region);
+        const QImage image(found ? found->flag_image : ":images/flag_unk.png");
+        it->second = QPixmap::fromImage(
+            image.scaled(64 * m_device_pixel_ratio, 44 * m_device_pixel_ratio,
+                         Qt::KeepAspectRatio, Qt::SmoothTransformation));
+        it->second.setDevicePixelRatio(m_device_pixel_ratio);
+    }
+    return it->second;
+}
+
+QVariant GameListTableModel::headerData(int section, Qt::Orientation orientation,
+                                        int role) const {
+    if (orientation != Qt::Horizontal || role != Qt::DisplayRole || section < 0 ||
+        section >= m_headers.size()) {
+        return QAbstractTableModel::headerData(section, orientation, role);
+    }
+    return m_headers[section];
+}
+
+bool GameListTableModel::setHeaderData(int section, Qt::Orientation orientation,
+                                       const QVariant& value, int role) {
+    if (orientation != Qt::Horizontal || (role != Qt::DisplayRole && role != Qt::EditRole) ||
+        section < 0 || section >= m_headers.size()) {
+        return false;
+    }
+    m_headers[section] = value.toString();
+    Q_EMIT headerDataChanged(orientation, section, section);
+    return true;
+}
+
+Qt::ItemFlags GameListTableModel::flags(const QModelIndex& index) const {
+    if (!index.isValid()) {
+        return Qt::NoItemFlags;
+    }
+    return Qt::ItemIsEnabled | Qt::ItemIsSelectable;
+}
+
+void GameListTableModel::sort(int column, Qt::SortOrder order) {
+    const auto less = [this, column](std::size_t left, std::size_t right) {
+        const Entry& l = m_entries[left];
+        const Entry& r = m_entries[right];
+
+        switch (static_cast<GUI::GameListColumns>(column)) {
+        case GUI::GameListColumns::icon:
+            return left < right;
+        case GUI::GameListColumns::name:
+            return m_title_keys[left].compare(m_title_keys[right]) < 0;
+        case GUI::GameListColumns::compat:
+            return l.game->compat.index < r.game->compat.index;
+        case GUI::GameListColumns::serial:
+            return l.serial < r.serial;
+        case GUI::GameListColumns::region:
+            return l.region < r.region;
+        case GUI::GameListColumns::firmware:
+            return l.firmware < r.firmware;
+        case GUI::GameListColumns::version:
+            return l.version < r.version;
+        case GUI::GameListColumns::last_play:
+            return l.last_played < r.last_played;
+        case GUI::GameListColumns::play_time:
+            return l.play_time < r.play_time;
+        case GUI::GameListColumns::dir_size:
+            return l.game->info.size_on_disk < r.game->info.size_on_disk;
+        case GUI::GameListColumns::path:
+            return l.game->info.path < r.game->info.path;
+        default:
+            return false;
+        }
+    };
+
+    Q_EMIT layoutAboutToBeChanged({}, QAbstractItemModel::VerticalSortHint);
+
+    const std::vector<std::size_t> old_order = m_order;
+    if (order == Qt::AscendingOrder) {
+        std::stable_sort(m_order.begin(), m_order.end(), less);
+    } else {
+        std::stable_sort(m_order.begin(), m_order.end(),
+                         [&less](std::size_t left, std::size_t right) {
+                             return less(right, left);
+                         });
+    }
+    for (std::size_t row = 0; row < m_order.size(); ++row) {
+        m_rows[m_order[row]] = static_cast<int>(row);
+    }
+
+    const QModelIndexList old_indexes = persistentIndexList();
+    QModelIndexList new_indexes;
+    new_indexes.reserve(old_indexes.size());
+    for (const QModelIndex& old_index : old_indexes) {
+        new_indexes.append(index(m_rows[old_order[old_index.row()]], old_index.column()));
+    }
+    changePersistentIndexList(old_indexes, new_indexes);
+
+    Q_EMIT layoutChanged({}, QAbstractItemModel::VerticalSortHint);
+}
+
+GameItem* GameListTableModel::Item(int row) {
+    const std::size_t index = m_order[row];
+    Entry& entry = m_entries[index];
+    if (!entry.item) {
+        entry.item = std::make_unique<GameItem>(entry.game, index);
+        entry.game->item = entry.item.get();
+        if (m_item_initializer) {
+            m_item_initializer(*entry.item);
+        }
+    }
+    return entry.item.get();
+}
+
+GameItem* GameListTableModel::ExistingItem(int row) const {
+    return m_entries[m_order[row]].item.get();
+}
+
+void GameListTableModel::ForEachItem(const std::function<void(GameItem&)>& func) const {
+    for (const Entry& entry : m_entries) {
+        if (entry.item) {
+            func(*entry.item);
+        }
+    }
+}
+
+void GameListTableModel::SetIconPlaceholder(const QPixmap& placeholder) {
+    m_icon_placeholder = placeholder;
+}
+
+void GameListTableModel::SetDevicePixelRatio(qreal device_pixel_ratio) {
+    if (device_pixel_ratio != m_device_pixel_ratio) {
+        m_device_pixel_ratio = device_pixel_ratio;
+        m_compat_circles.clear();
+        m_region_flags.clear();
+    }
+}
+
+void GameListTableModel::IconChanged(const GameItem& item) {
+    const QModelIndex changed = index(Row(item), static_cast<int>(GUI::GameListColumns::icon));
+    Q_EMIT dataChanged(changed, changed, {Qt::DecorationRole});
+}
+
+void GameListTableModel::SizeOnDiskChanged(const GameItem& item) {
+    const QModelIndex changed =
+        index(Row(item), static_cast<int>(GUI::GameListColumns::dir_size));
+    Q_EMIT dataChanged(changed, changed, {Qt::DisplayRole});
+}
+
+void GameListTableModel::CustomConfigChanged(const QString& serial) {
+    for (std::size_t i = 0; i < m_entries.size(); ++i) {
+        if (m_entries[i].serial == serial) {
+            const QModelIndex changed =
+                index(m_rows[i], static_cast<int>(GUI::GameListColumns::name));
+            Q_EMIT dataChanged(changed, changed, {Qt::DecorationRole});
+        }
+    }
+}
+
+GameListFilterModel::GameListFilterModel(QObject* parent) : QSortFilterProxyModel(parent) {}
+
+void GameListFilterModel::SetFilter(Filter filter) {
+    m_filter = std::move(filter);
+    invalidateFilter();
+}
+
+void GameListFilterModel::sort(int column, Qt::SortOrder order) {
+    // The proxy itself stays unsorted and follows the order of the source rows
+    if (QAbstractItemModel* source = sourceModel()) {
+        source->sort(column, order);
+    }
+}
+
+bool GameListFilterModel::filterAcceptsRow(int source_row,
+                                           const QModelIndex& /*source_parent*/) const {
+    if (!m_filter) {
+        return true;
+    }
+    const auto* source = static_cast<const GameListTableModel*>(sourceModel());
+    return m_filter(source->GameIndex(source_row));
+}
@@ -0,0 +1,141 @@
+// SPDX-FileCopyrightText: Copyright 2025-2026 shadLauncher4 Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <vector>
+#include <QAbstractTableModel>
+#include <QCollatorSortKey>
+#include <QDateTime>
+#include <QHash>
+#include <QSortFilterProxyModel>
+#include <QStringList>
+
+#include "game_item.h"
+#include "localized.h"
+
+class PersistentSettings;
+
+/**
+ * Games shown by the list view, one row per game and one column per GUI::GameListColumns.
+ *
+ * Cell texts, tool tips and decorations are produced when a cell asks for them. Only the values
+ * that sorting compares are computed up front, once per game and populate. The per game icon
+ * and size on disk state is created on first use, like in the grid.
+ */
+class GameListTableModel : public QAbstractTableModel {
+    Q_OBJECT
+
+public:
+    explicit GameListTableModel(QObject* parent = nullptr);
+    ~GameListTableModel() override;
+
+    void Reset(std::vector<game_info> games, const std::map<QString, QString>& titles,
+               const std::map<QString, QString>& notes, PersistentSettings& persistent_settings);
+    void Clear();
+
+    int rowCount(const QModelIndex& parent = QModelIndex()) const override;
+    int columnCount(const QModelIndex& parent = QModelIndex()) const override;
+    QVariant data(const QModelIndex& index, int role) const override;
+    QVariant headerData(int section, Qt::Orientation orientation,
+                        int role = Qt::DisplayRole) const override;
+    bool setHeaderData(int section, Qt::Orientation orientation, const QVariant& value,
+                       int role = Qt::EditRole) override;
+    Qt::ItemFlags flags(const QModelIndex& index) const override;
+    void sort(int column, Qt::SortOrder order = Qt::AscendingOrder) override;
+
+    /** Index of the game shown in a row, as passed to Reset */
+    std::size_t GameIndex(int row) const {
+        return m_order[row];
+    }
+
+    /** Returns the icon state of a row, creating it on first use */
+    GameItem* Item(int row);
+    /** Returns the icon state of a row if it was created already */
+    GameItem* ExistingItem(int row) const;
+
+    /** Calls func for every icon state created so far */
+    void ForEachItem(const std::function<void(GameItem&)>& func) const;
+
+    /** Called for every new icon state, before it is handed out */
+    void SetItemInitializer(std::function<void(GameItem&)> func) {
+        m_item_initializer = std::move(func);
+    }
+
+    /** Shown by rows whose icon is not loaded */
+    void SetIconPlaceholder(const QPixmap& placeholder);
+    void SetDevicePixelRatio(qreal device_pixel_ratio);
+
+    /** Tells the views that the icon of an item changed */
+    void IconChanged(const GameItem& item);
+    /** Tells the views that the size on disk of an item changed */
+    void SizeOnDiskChanged(const GameItem& item);
+    /** Tells the views that the custom configs of every game with this serial changed */
+    void CustomConfigChanged(const QString& serial);
+
+private:
+    // Values compared by sort(), so sorting does not build a QVariant per comparison. Titles are
+    // compared by their collation keys in m_title_keys.
+    struct Entry {
+        game_info game;
+        QString title;
+        QString serial;
+        QString notes_tool_tip;
+        QString region;
+        double firmware{};
+        double version{};
+        QDateTime last_played;
+        quint64 play_time{};
+        std::unique_ptr<GameItem> item;
+    };
+
+    int Row(const GameItem& item) const {
+        return m_rows[item.Index()];
+    }
+
+    QVariant DisplayData(const Entry& entry, int column) const;
+    QVariant DecorationData(const Entry& entry, int column) const;
+    QVariant ToolTipData(const Entry& entry, int column) const;
+    const QPixmap& RegionFlag(const std::string& region) const;
+
+    std::vector<Entry> m_entries;
+    std::vector<std::size_t> m_order; // Entry shown in each row
+    std::vector<int> m_rows;          // Row of each entry
+    std::vector<QCollatorSortKey> m_title_keys;
+    QStringList m_headers;
+    QPixmap m_icon_placeholder;
+    qreal m_device_pixel_ratio = 1.0;
+    std::function<void(GameItem&)> m_item_initializer;
+    Localized m_localized;
+
+    // Decorations shared by many rows
+    mutable QHash<QString, QPixmap> m_compat_circles;
+    mutable std::map<std::string, QPixmap> m_region_flags;
+};
+
+/**
+ * Hides the games that the game list filters out, without touching the rows of the table model.
+ * Sorting is forwarded to the table model, so rows keep the order it has.
+ */
+class GameListFilterModel : public QSortFilterProxyModel {
+    Q_OBJECT
+
+public:
+    /** Takes the index of a game as passed to GameListTableModel::Reset */
+    using Filter = std::function<bool(std::size_t index)>;
+
+    explicit GameListFilterModel(QObject* parent = nullptr);
+
+    void SetFilter(Filter filter);
+
+    void sort(int column, Qt::SortOrder order = Qt::AscendingOrder) override;
+
+protected:
+    bool filterAcceptsRow(int source_row, const QModelIndex& source_parent) const override;
+
+private:
+    Filter m_filter;
+};
@@ -10,8 +10,7 @@
 struct GUIGameInfo {
     GameInfo info{};
     Compat::Status compat;
-    QPixmap icon;
-    QPixmap pxmap;
+    QPixmap pxmap; // Composed icon, only touched on the GUI thread
     bool has_custom_config = false;
     bool has_custom_pad_config = false;
     GameItemBase* item = nullptr;
@@ -115,6 +115,7 @@ const GUISave game_list_play_bg = GUISave(game_list, "play_bg", true);
 const GUISave game_list_bg_volume = GUISave(game_list, "bg_volume", 100);
 const GUISave game_list_showBackgroundImage = GUISave(game_list, "showBackgroundImage", true);
 const GUISave game_list_backgroundImageOpacity = GUISave(game_list, "backgroundImageOpacity", 50);
+const GUISave game_list_iconMemoryBudget = GUISave(game_list, "iconMemoryBudgetMB", 256);
 
 // meta settings
 const GUISave meta_enableUIColors = GUISave(meta, "enableUIColors", false);
@@ -0,0 +1,252 @@
+// SPDX-FileCopyrightText: Copyright 2025-2026 shadLauncher4 Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <span>
+#include <system_error>
+#include <vector>
+#include <fmt/core.h>
+#include <libdeflate.h>
+
+#include "common/io_file.h"
+#include "common/mapped_file.h"
+#include "common/path_util.h"
+#include "icon_cache.h"
+
+namespace fs = std::filesystem;
+
+namespace {
+
+constexpr u32 cache_magic = 0x49434C53; // "SLCI"
+constexpr u32 cache_version = 2;
+// Loading an entry refreshes its time at most this often, it only has to order entries for Trim
+constexpr std::chrono::hours touch_interval{24};
+
+struct EntryHeader {
+    u32 magic;
+    u32 version;
+    s32 width;
+    s32 height;
+    s64 bytes_per_line;
+    double device_pixel_ratio;
+    u32 key_size;
+    u32 compressed_size; // Of the deflated rows after the key
+};
+static_assert(sizeof(EntryHeader) == 40);
+
+// Everything but the icon time, which only decides whether an entry is still valid
+std::string SerializeKey(const IconCache::Key& key) {
+    return fmt::format("{}|{}x{}|{}|{}{}|{:08x}|{:08x}", key.icon_path, key.size.width(),
+                       key.size.height(), key.device_pixel_ratio, key.config_overlay ? 1 : 0,
+                       key.pad_config_overlay ? 1 : 0,
+                       key.compat_color.isValid() ? key.compat_color.rgba() : 0u,
+                       key.background_color.rgba());
+}
+
+std::string SerializeFullKey(const IconCache::Key& key) {
+    return fmt::format("{}|{}", SerializeKey(key), key.icon_mtime);
+}
+
+// FNV-1a, the file name has to stay the same across runs and builds
+u64 HashKey(std::string_view key) {
+    u64 hash = 0xcbf29ce484222325ull;
+    for (const char c : key) {
+        hash ^= static_cast<u8>(c);
+        hash *= 0x100000001b3ull;
+    }
+    return hash;
+}
+
+// Icons are flat artwork with large single colored areas and deflate to a fraction of their size.
+// Inflating them is still far cheaper than decoding ICON0.PNG and scaling it again.
+std::vector<u8> CompressPixels(const u8* pixels, size_t size) {
+    thread_local libdeflate_compressor* c = libdeflate_alloc_compressor(6);
+
+    std::vector<u8> compressed(libdeflate_deflate_compress_bound(c, size));
+    const size_t actual =
+        libdeflate_deflate_compress(c, pixels, size, compressed.data(), compressed.size());
+    compressed.resize(actual);
+    return compressed;
+}
+
+bool DecompressPixels(std::span<const u8> compressed, u8* pixels, size_t size) {
+    thread_local libdeflate_decompressor* d = libdeflate_alloc_decompressor();
+
+    size_t actual = 0;
+    const libdeflate_result res = libdeflate_deflate_decompress(
+        d, compressed.data(), compressed.size(), pixels, size, &actual);
+    return res == LIBDEFLATE_SUCCESS && actual == size;
+}
+
+void MarkUsed(const fs::path& path) {
+    std::error_code ec;
+    const auto now = fs::file_time_type::clock::now();
+    const auto time = fs::last_write_time(path, ec);
+    if (!ec && now - time > touch_interval) {
+        fs::last_write_time(path, now, ec);
+    }
+}
+
+} // namespace
+
+bool IconCache::Key::ReadIconTime() {
+    const fs::path path = Common::FS::PathFromQString(QString::fromStdString(icon_path));
+    std::error_code ec;
+    const auto time = fs::last_write_time(path, ec);
+    if (ec) {
+        return false;
+    }
+    icon_mtime = static_cast<s64>(time.time_since_epoch().count());
+    return true;
+}
+
+IconCache& IconCache::Instance() {
+    static IconCache cache(Common::FS::GetUserPath(Common::FS::PathType::IconCacheDir));
+    return cache;
+}
+
+IconCache::IconCache(fs::path dir) : m_dir(std::move(dir)) {}
+
+fs::path IconCache::EntryPath(const Key& key) const {
+    return m_dir / fmt::format("{:016x}.bin", HashKey(SerializeKey(key)));
+}
+
+std::optional<QImage> IconCache::Load(const Key& key) const {
+    const fs::path path = EntryPath(key);
+    Common::FS::MappedFile file;
+    if (!file.Open(path) || file.Size() < sizeof(EntryHeader)) {
+        return std::nullopt;
+    }
+
+    EntryHeader header;
+    std::memcpy(&header, file.Data(), sizeof(header));
+    if (header.magic != cache_magic || header.version != cache_version || header.width <= 0 ||
+        header.height <= 0 || header.bytes_per_line < s64{header.width} * 4) {
+        return std::nullopt;
+    }
+
+    const u64 pixel_offset = sizeof(header) + header.key_size;
+    if (file.Size() < pixel_offset + header.compressed_size) {
+        return std::nullopt;
+    }
+
+    // A different icon time means the icon was replaced, the next store overwrites the entry
+    const std::string full_key = SerializeFullKey(key);
+    const std::string_view stored_key(reinterpret_cast<const char*>(file.Data()) + sizeof(header),
+                                      header.key_size);
+    if (stored_key != full_key) {
+        return std::nullopt;
+    }
+
+    QImage image(header.width, header.height, QImage::Format_ARGB32_Premultiplied);
+    if (image.isNull()) {
+        return std::nullopt;
+    }
+    std::vector<u8> rows(static_cast<size_t>(header.bytes_per_line) * header.height);
+    if (!DecompressPixels({file.Data() + pixel_offset, header.compressed_size}, rows.data(),
+                          rows.size())) {
+        return std::nullopt;
+    }
+    const size_t row_size = static_cast<size_t>(header.width) * 4;
+    for (int y = 0; y < header.height; ++y) {
+        std::memcpy(image.scanLine(y), rows.data() + y * header.bytes_per_line, row_size);
+    }
+    image.setDevicePixelRatio(header.device_pixel_ratio);
+
+    file.Close();
+    MarkUsed(path);
+    return image;
+}
+
+void IconCache::Store(const Key& key, const QImage& image) const {
+    if (image.isNull()) {
+        return;
+    }
+    const QImage pixels = image.format() == QImage::Format_ARGB32_Premultiplied
+                              ? image
+                              : image.convertToFormat(QImage::Format_ARGB32_Premultiplied);
+
+    const std::vector<u8> compressed =
+        CompressPixels(pixels.constBits(), static_cast<size_t>(pixels.sizeInBytes()));
+    if (compressed.empty()) {
+        return;
+    }
+
+    const std::string full_key = SerializeFullKey(key);
+    const EntryHeader header{
+        .magic = cache_magic,
+        .version = cache_version,
+        .width = pixels.width(),
+        .height = pixels.height(),
+        .bytes_per_line = pixels.bytesPerLine(),
+        .device_pixel_ratio = pixels.devicePixelRatio(),
+        .key_size = static_cast<u32>(full_key.size()),
+        .compressed_size = static_cast<u32>(compressed.size()),
+    };
+
+    const fs::path path = EntryPath(key);
+    std::error_code ec;
+    const u64 replaced_size = fs::file_size(path, ec);
+    const u64 old_size = ec ? 0 : replaced_size;
+
+    const bool written = Common::FS::WriteFileAtomically(path, [&](Common::FS::IOFile& file) {
+        return file.WriteObject(header) &&
+               file.WriteRaw<u8>(full_key.data(), full_key.size()) == full_key.size() &&
+               file.WriteRaw<u8>(compressed.data(), compressed.size()) == compressed.size();
+    });
+    if (!written) {
+        return;
+    }
+
+    std::scoped_lock lock{m_mutex};
+    if (m_used) {
+        *m_used = *m_used - std::min(*m_used, old_size) + sizeof(header) + full_key.size() +
+                  compressed.size();
+    }
+    if (!m_used || *m_used > budget) {
+        Trim();
+    }
+}
+
+void IconCache::Trim() const {
+    struct Entry {
+        fs::path path;
+        fs::file_time_type time;
+        u64 size;
+    };
+    std::vector<Entry> entries;
+    u64 used = 0;
+
+    std::error_code ec;
+    for (const auto& entry : fs::directory_iterator(m_dir, ec)) {
+        if (entry.path().extension() != ".bin") {
+            continue;
+        }
+        std::error_code size_ec;
+        std::error_code time_ec;
+        const u64 size = entry.file_size(size_ec);
+        const auto time = entry.last_write_time(time_ec);
+        if (size_ec || time_ec) {
+            continue;
+        }
+        entries.push_back(Entry{entry.path(), time, size});
+        used += size;
+    }
+
+    // Trimmed below the budget, so the next stores do not have to list the directory again
+    if (used > budget) {
+        std::ranges::sort(entries, {}, &Entry::time);
+        const u64 target = budget / 4 * 3;
+        for (const Entry& entry : entries) {
+            if (used <= target) {
+                break;
+            }
+            if (fs::remove(entry.path, ec)) {
+                used -= entry.size;
+            }
+        }
+    }
+    m_used = used;
+}
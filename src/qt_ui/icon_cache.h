@@ -0,0 +1,60 @@
+// SPDX-FileCopyrightText: Copyright 2025-2026 shadLauncher4 Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <filesystem>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <QColor>
+#include <QImage>
+#include <QSize>
+
+#include "common/types.h"
+
+/**
+ * On-disk cache of composed game list icons.
+ *
+ * Entries hold the final image as deflated premultiplied ARGB rows, so a warm start maps the file
+ * and inflates it into a QImage without decoding ICON0.PNG, painting overlays or smooth scaling.
+ * Once the entries outgrow the budget, those used longest ago are removed, so icons of games that
+ * left the library or of old icon sizes do not pile up. All methods are thread-safe.
+ */
+class IconCache {
+public:
+    /** Everything the composed image depends on */
+    struct Key {
+        std::string icon_path;
+        s64 icon_mtime = 0;
+        QSize size;
+        qreal device_pixel_ratio = 1.0;
+        bool config_overlay = false;
+        bool pad_config_overlay = false;
+        QColor compat_color;
+        QColor background_color;
+
+        /// Fills icon_mtime from the icon file. Returns false if the icon does not exist.
+        bool ReadIconTime();
+    };
+
+    static IconCache& Instance();
+
+    explicit IconCache(std::filesystem::path dir);
+
+    std::optional<QImage> Load(const Key& key) const;
+    void Store(const Key& key, const QImage& image) const;
+
+private:
+    // Bytes the entries may take on disk, several thousand icons at large sizes once deflated
+    static constexpr u64 budget = 512_MB;
+
+    std::filesystem::path EntryPath(const Key& key) const;
+    /// Removes the entries used longest ago until a quarter of the budget is free again.
+    /// Requires m_mutex.
+    void Trim() const;
+
+    std::filesystem::path m_dir;
+    mutable std::mutex m_mutex;
+    mutable std::optional<u64> m_used; // Bytes of all entries, counted on the first store
+};
@@ -0,0 +1,125 @@
+// SPDX-FileCopyrightText: Copyright 2025-2026 shadLauncher4 Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+
+#include "icon_decode_pool.h"
+
+IconDecodePool& IconDecodePool::Instance() {
+    static IconDecodePool pool;
+    return pool;
+}
+
+IconDecodePool::IconDecodePool() {
+    // Icon loading is mostly bound by the disk, a few workers keep it busy without thrashing it
+    const unsigned count = std::clamp(std::thread::hardware_concurrency() / 2, 2u, 4u);
+    m_workers.reserve(count);
+    for (unsigned i = 0; i < count; ++i) {
+        m_workers.emplace_back([this] { WorkerLoop(); });
+    }
+}
+
+IconDecodePool::~IconDecodePool() {
+    {
+        std::lock_guard lock(m_mutex);
+        m_stop = true;
+        // Nothing runs the remaining tasks anymore, release anyone waiting for them
+        for (auto& queue : m_queues) {
+            for (const auto& task : queue) {
+                if (task->state == Task::State::Queued) {
+                    task->state = Task::State::Done;
+                }
+            }
+            queue.clear();
+        }
+    }
+    m_work_cv.notify_all();
+    m_done_cv.notify_all();
+    for (std::thread& worker : m_workers) {
+        worker.join();
+    }
+}
+
+std::shared_ptr<IconDecodePool::Task> IconDecodePool::Submit(
+    Priority priority, std::function<void()> work, std::shared_ptr<std::atomic<bool>> cancel) {
+    auto task = std::make_shared<Task>();
+    task->work = std::move(work);
+    task->cancel = std::move(cancel);
+    task->priority = priority;
+
+    {
+        std::lock_guard lock(m_mutex);
+        m_queues[static_cast<size_t>(priority)].push_back(task);
+    }
+    m_work_cv.notify_one();
+    return task;
+}
+
+void IconDecodePool::Promote(const std::shared_ptr<Task>& task, Priority priority) {
+    std::lock_guard lock(m_mutex);
+    if (task->state != Task::State::Queued || task->priority <= priority) {
+        return;
+    }
+    task->priority = priority;
+    m_queues[static_cast<size_t>(priority)].push_back(task);
+}
+
+bool IconDecodePool::Cancel(const std::shared_ptr<Task>& task) {
+    {
+        std::lock_guard lock(m_mutex);
+        if (task->state != Task::State::Queued) {
+            return false;
+        }
+        task->state = Task::State::Done;
+    }
+    m_done_cv.notify_all();
+    return true;
+}
+
+void IconDecodePool::Wait(const std::shared_ptr<Task>& task) {
+    std::unique_lock lock(m_mutex);
+    m_done_cv.wait(lock, [&task] { return task->state == Task::State::Done; });
+}
+
+void IconDecodePool::WorkerLoop() {
+    std::unique_lock lock(m_mutex);
+    while (true) {
+        std::shared_ptr<Task> task;
+        m_work_cv.wait(lock, [this, &task] {
+            if (m_stop) {
+                return true;
+            }
+            for (size_t level = 0; level < m_queues.size(); ++level) {
+                auto& queue = m_queues[level];
+                while (!queue.empty()) {
+                    std::shared_ptr<Task> candidate = std::move(queue.front());
+                    queue.pop_front();
+                    // Skip entries of dropped tasks and the old entry of promoted ones
+                    if (candidate->state == Task::State::Queued &&
+                        static_cast<size_t>(candidate->priority) == level) {
+                        task = std::move(candidate);
+                        return true;
+                    }
+                }
+            }
+            return false;
+        });
+        if (m_stop) {
+            return;
+        }
+
+        if (task->cancel && task->cancel->load()) {
+            task->state = Task::State::Done;
+            m_done_cv.notify_all();
+            continue;
+        }
+
+        task->state = Task::State::Running;
+        lock.unlock();
+        task->work();
+        task->work = nullptr;
+        lock.lock();
+        task->state = Task::State::Done;
+        m_done_cv.notify_all();
+    }
+}
@@ -0,0 +1,74 @@
+// SPDX-FileCopyrightText: Copyright 2025-2026 shadLauncher4 Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * Shared scheduler for game icon loading.
+ *
+ * A fixed number of workers serve every game list item, so scrolling a large grid or repainting
+ * all icons queues work instead of starting a thread per item. Requests are served in priority
+ * order, can move up when their item scrolls into view and can be dropped before they start.
+ */
+class IconDecodePool {
+public:
+    enum class Priority {
+        Visible,      // On screen right now
+        NearViewport, // Within about a screen of the viewport
+        Background,   // Everything else
+        Count,
+    };
+
+    class Task {
+        friend class IconDecodePool;
+
+        enum class State { Queued, Running, Done };
+
+        std::function<void()> work;
+        std::shared_ptr<std::atomic<bool>> cancel;
+        Priority priority{};
+        State state = State::Queued;
+    };
+
+    static IconDecodePool& Instance();
+
+    IconDecodePool();
+    ~IconDecodePool();
+
+    IconDecodePool(const IconDecodePool&) = delete;
+    IconDecodePool& operator=(const IconDecodePool&) = delete;
+
+    /// Queues work. It is skipped if cancel is set by the time a worker picks it up.
+    std::shared_ptr<Task> Submit(Priority priority, std::function<void()> work,
+                                 std::shared_ptr<std::atomic<bool>> cancel = nullptr);
+
+    /// Moves a queued task up to the given priority. Does nothing if it is already more urgent.
+    void Promote(const std::shared_ptr<Task>& task, Priority priority);
+
+    /// Drops a task that has not started yet. Returns false if it is running or done.
+    bool Cancel(const std::shared_ptr<Task>& task);
+
+    /// Blocks until the task has run or was dropped.
+    void Wait(const std::shared_ptr<Task>& task);
+
+private:
+    void WorkerLoop();
+
+    std::mutex m_mutex;
+    std::condition_variable m_work_cv;
+    std::condition_variable m_done_cv;
+    // A promoted task is queued again at its new level, stale entries are skipped when popped
+    std::array<std::deque<std::shared_ptr<Task>>, static_cast<size_t>(Priority::Count)> m_queues;
+    std::vector<std::thread> m_workers;
+    bool m_stop = false;
+};
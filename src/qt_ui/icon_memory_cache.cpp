@@ -0,0 +1,116 @@
+// SPDX-FileCopyrightText: Copyright 2025-2026 shadLauncher4 Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "icon_memory_cache.h"
+
+IconMemoryCache& IconMemoryCache::Instance() {
+    static IconMemoryCache cache;
+    return cache;
+}
+
+void IconMemoryCache::SetBudget(u64 bytes) {
+    std::vector<std::function<void()>> callbacks;
+    {
+        std::lock_guard lock(m_mutex);
+        m_budget = bytes;
+        callbacks = Trim(true);
+    }
+    RunCallbacks(callbacks);
+}
+
+QImage IconMemoryCache::Source(const std::string& path) {
+    std::lock_guard lock(m_mutex);
+    const auto it = m_sources.find(path);
+    if (it == m_sources.end()) {
+        return {};
+    }
+    m_lru.splice(m_lru.begin(), m_lru, it->second);
+    return it->second->image;
+}
+
+void IconMemoryCache::StoreSource(const std::string& path, const QImage& image) {
+    if (path.empty() || image.isNull()) {
+        return;
+    }
+
+    std::lock_guard lock(m_mutex);
+    if (const auto it = m_sources.find(path); it != m_sources.end()) {
+        Erase(it->second);
+    }
+    const u64 bytes = static_cast<u64>(image.sizeInBytes());
+    m_lru.push_front(Entry{.path = path, .image = image, .bytes = bytes});
+    m_sources.emplace(path, m_lru.begin());
+    m_used += bytes;
+
+    // Not on the GUI thread, so only decoded icons can make room
+    Trim(false);
+}
+
+void IconMemoryCache::TrackIcon(const GameItemBase* item, u64 bytes,
+                                std::function<void()> on_evict) {
+    std::vector<std::function<void()>> callbacks;
+    {
+        std::lock_guard lock(m_mutex);
+        if (const auto it = m_icons.find(item); it != m_icons.end()) {
+            Erase(it->second);
+        }
+        m_lru.push_front(Entry{.item = item, .on_evict = std::move(on_evict), .bytes = bytes});
+        m_icons.emplace(item, m_lru.begin());
+        m_used += bytes;
+        callbacks = Trim(true);
+    }
+    RunCallbacks(callbacks);
+}
+
+void IconMemoryCache::Touch(const GameItemBase* item) {
+    std::lock_guard lock(m_mutex);
+    if (const auto it = m_icons.find(item); it != m_icons.end()) {
+        m_lru.splice(m_lru.begin(), m_lru, it->second);
+    }
+}
+
+void IconMemoryCache::Remove(const GameItemBase* item) {
+    std::lock_guard lock(m_mutex);
+    if (const auto it = m_icons.find(item); it != m_icons.end()) {
+        Erase(it->second);
+    }
+}
+
+void IconMemoryCache::Erase(EntryList::iterator it) {
+    if (it->path.empty()) {
+        m_icons.erase(it->item);
+    } else {
+        m_sources.erase(it->path);
+    }
+    m_used -= it->bytes;
+    m_lru.erase(it);
+}
+
+std::vector<std::function<void()>> IconMemoryCache::Trim(bool evict_icons) {
+    std::vector<std::function<void()>> callbacks;
+    if (m_lru.empty()) {
+        return callbacks;
+    }
+
+    // The most recent entry always stays, it is what the caller is about to use
+    auto it = std::prev(m_lru.end());
+    while (m_used > m_budget && it != m_lru.begin()) {
+        const auto current = it--;
+        if (current->path.empty()) {
+            if (!evict_icons) {
+                continue;
+            }
+            callbacks.push_back(std::move(current->on_evict));
+        }
+        Erase(current);
+    }
+    return callbacks;
+}
+
+void IconMemoryCache::RunCallbacks(const std::vector<std::function<void()>>& callbacks) {
+    for (const auto& callback : callbacks) {
+        if (callback) {
+            callback();
+        }
+    }
+}
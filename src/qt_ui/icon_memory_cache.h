@@ -0,0 +1,72 @@
+// SPDX-FileCopyrightText: Copyright 2025-2026 shadLauncher4 Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <functional>
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <QImage>
+
+#include "common/types.h"
+
+class GameItemBase;
+
+/**
+ * Keeps the memory used by game list icons within a byte budget, however large the library is.
+ *
+ * Two kinds of entries share the budget and one least recently used order:
+ * - Decoded ICON0.PNG images, owned by the cache and keyed by icon path. They are only needed to
+ *   compose an icon again, so evicting one simply drops it.
+ * - Composed icons shown by a game list item. The item owns the pixmap, the cache only accounts
+ *   for it. Evicting one calls back into the view, which swaps in the placeholder and lets the
+ *   item request its icon again (from the thumbnail cache) once it is visible.
+ *
+ * Decoded images may be looked up and stored from any thread. Composed icons are only tracked,
+ * touched and evicted on the GUI thread.
+ */
+class IconMemoryCache {
+public:
+    static constexpr u64 default_budget = 256_MB;
+
+    static IconMemoryCache& Instance();
+
+    void SetBudget(u64 bytes);
+
+    /// Returns the decoded icon at path, or a null image if it is not cached
+    QImage Source(const std::string& path);
+    void StoreSource(const std::string& path, const QImage& image);
+
+    /// Accounts for the icon shown by item, replacing its previous one. GUI thread only.
+    void TrackIcon(const GameItemBase* item, u64 bytes, std::function<void()> on_evict);
+    /// Marks the icon of item as recently used. GUI thread only.
+    void Touch(const GameItemBase* item);
+    /// Forgets the icon of item without calling its eviction callback. GUI thread only.
+    void Remove(const GameItemBase* item);
+
+private:
+    struct Entry {
+        std::string path;                 // Decoded icon if not empty
+        const GameItemBase* item{};       // Composed icon otherwise
+        QImage image;                     // Only set for decoded icons
+        std::function<void()> on_evict{}; // Only set for composed icons
+        u64 bytes{};
+    };
+    using EntryList = std::list<Entry>;
+
+    void Erase(EntryList::iterator it);
+    /// Evicts the oldest entries until the budget is met. Composed icons are only evicted on the
+    /// GUI thread, their callbacks are returned to run after the lock is released.
+    std::vector<std::function<void()>> Trim(bool evict_icons);
+    static void RunCallbacks(const std::vector<std::function<void()>>& callbacks);
+
+    std::mutex m_mutex;
+    EntryList m_lru; // Most recently used first
+    std::unordered_map<std::string, EntryList::iterator> m_sources;
+    std::unordered_map<const GameItemBase*, EntryList::iterator> m_icons;
+    u64 m_budget = default_budget;
+    u64 m_used = 0;
+};
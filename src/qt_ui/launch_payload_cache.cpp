@@ -0,0 +1,103 @@
+// SPDX-FileCopyrightText: Copyright 2025-2026 shadLauncher4 Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <system_error>
+#include <utility>
+#include <QtConcurrent>
+
+#include "launch_payload_cache.h"
+
+LaunchPayloadCache::LaunchPayloadCache(QObject* parent) : QObject(parent) {
+    m_prepare_timer.setSingleShot(true);
+    m_prepare_timer.setInterval(150);
+    connect(&m_prepare_timer, &QTimer::timeout, this, &LaunchPayloadCache::StartNext);
+}
+
+LaunchPayloadCache::~LaunchPayloadCache() {
+    m_pending.waitForFinished();
+}
+
+void LaunchPayloadCache::Prepare(const game_info& game) {
+    if (!game) {
+        return;
+    }
+
+    // Resolved again even if a payload exists, selecting a game is the cheapest moment to notice
+    // patches that changed on disk
+    m_next = game;
+    m_prepare_timer.start();
+}
+
+void LaunchPayloadCache::StartNext() {
+    if (!m_next) {
+        return;
+    }
+    // A resolve still running, or one that would only queue behind the index compile, is waited
+    // out. Later selections replace m_next meanwhile, so only the last one is resolved.
+    if ((m_pending.isValid() && !m_pending.isFinished()) || MemoryPatcher::PatchIndexCompiling()) {
+        m_prepare_timer.start();
+        return;
+    }
+
+    const game_info game = std::exchange(m_next, nullptr);
+    m_pending_path = game->info.path;
+    m_pending = QtConcurrent::run(&LaunchPayloadCache::Resolve, game->info.path,
+                                  game->info.serial, game->info.app_ver.str());
+}
+
+std::shared_ptr<const LaunchPayload> LaunchPayloadCache::Get(const game_info& game) {
+    if (m_next && m_next->info.path == game->info.path) {
+        // Play was faster than the selection settled, resolved below right away
+        m_next.reset();
+        m_prepare_timer.stop();
+    }
+
+    if (m_pending.isValid() && m_pending_path == game->info.path) {
+        // Usually finished long ago, the user had to press Play after selecting the game
+        m_payload = m_pending.result();
+        m_pending = {};
+        m_pending_path.clear();
+    }
+
+    if (!m_payload || !Matches(*m_payload, game) || !Current(*m_payload)) {
+        m_payload = Resolve(game->info.path, game->info.serial, game->info.app_ver.str());
+    }
+    return m_payload;
+}
+
+void LaunchPayloadCache::Invalidate() {
+    m_prepare_timer.stop();
+    m_next.reset();
+    m_payload.reset();
+    m_pending = {};
+    m_pending_path.clear();
+}
+
+std::shared_ptr<const LaunchPayload> LaunchPayloadCache::Resolve(std::string game_path,
+                                                                 std::string serial,
+                                                                 std::string app_version) {
+    auto payload = std::make_shared<LaunchPayload>();
+    payload->eboot_path = std::filesystem::path(game_path) / "eboot.bin";
+    std::error_code ec;
+    payload->eboot_exists = std::filesystem::exists(payload->eboot_path, ec);
+    payload->patches =
+        MemoryPatcher::readPatches(serial, app_version, &payload->patch_generation);
+
+    payload->game_path = std::move(game_path);
+    payload->serial = std::move(serial);
+    payload->app_version = std::move(app_version);
+    return payload;
+}
+
+bool LaunchPayloadCache::Matches(const LaunchPayload& payload, const game_info& game) {
+    return payload.game_path == game->info.path && payload.serial == game->info.serial &&
+           payload.app_version == game->info.app_ver.str();
+}
+
+bool LaunchPayloadCache::Current(const LaunchPayload& payload) {
+    // Both only stat a few files, far cheaper than resolving the payload again
+    std::error_code ec;
+    return std::filesystem::exists(payload.eboot_path, ec) == payload.eboot_exists &&
+           MemoryPatcher::PatchesCurrent(payload.serial, payload.app_version,
+                                         payload.patch_generation);
+}
@@ -0,0 +1,68 @@
+// SPDX-FileCopyrightText: Copyright 2025-2026 shadLauncher4 Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <vector>
+#include <QFuture>
+#include <QObject>
+#include <QTimer>
+
+#include "common/memory_patcher.h"
+#include "common/types.h"
+#include "gui_game_info.h"
+
+/** Everything the launcher resolves before it can boot a game */
+struct LaunchPayload {
+    std::string game_path;
+    std::string serial;
+    std::string app_version;
+    std::filesystem::path eboot_path;
+    bool eboot_exists = false;
+    std::vector<MemoryPatcher::PendingPatch> patches;
+    u64 patch_generation = 0; // MemoryPatcher::PatchIndexGeneration() the patches belong to
+};
+
+/**
+ * Resolves the launch payload of the selected game in the background, so starting it only has to
+ * spawn the emulator and send what was prepared. Selections are resolved once they settle, one at
+ * a time and never while the patch index compiles, so scrolling through the list only resolves the
+ * game it stops at.
+ *
+ * A payload is checked against the disk before it is handed out: if the eboot appeared or
+ * vanished, the patch index was compiled again or a patch file of the game changed, it is
+ * resolved again. Asking for a game that was not prepared resolves its payload on the spot.
+ */
+class LaunchPayloadCache : public QObject {
+    Q_OBJECT
+
+public:
+    explicit LaunchPayloadCache(QObject* parent = nullptr);
+    ~LaunchPayloadCache() override;
+
+    /** Resolves the payload of game soon, replacing the one prepared before */
+    void Prepare(const game_info& game);
+
+    /** The payload of game, waits for a pending Prepare of the same game */
+    std::shared_ptr<const LaunchPayload> Get(const game_info& game);
+
+    void Invalidate();
+
+private:
+    /** Starts resolving the selected game, or waits a little longer if that has to queue */
+    void StartNext();
+    static std::shared_ptr<const LaunchPayload> Resolve(std::string game_path, std::string serial,
+                                                        std::string app_version);
+    static bool Matches(const LaunchPayload& payload, const game_info& game);
+    /** Whether the eboot and the patches of payload are still what is on disk */
+    static bool Current(const LaunchPayload& payload);
+
+    std::shared_ptr<const LaunchPayload> m_payload;
+    QTimer m_prepare_timer;
+    game_info m_next; // Selected, but not being resolved yet
+    QFuture<std::shared_ptr<const LaunchPayload>> m_pending;
+    std::string m_pending_path;
+};
@@ -0,0 +1,238 @@
+// SPDX-FileCopyrightText: Copyright 2025-2026 shadLauncher4 Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <iostream>
+#include <QBuffer>
+#include <QElapsedTimer>
+#include <QEventLoop>
+#include <QFile>
+#include <QImage>
+#include <QPainter>
+#include <QTemporaryDir>
+#include <fmt/core.h>
+
+#include "common/endian.h"
+#include "common/path_util.h"
+#include "core/emulator_settings.h"
+#include "core/file_format/npbind.h"
+#include "core/file_format/psf.h"
+#include "game_list_frame.h"
+#include "gui_settings.h"
+#include "library_benchmark.h"
+#include "persistent_settings.h"
+
+namespace LibraryBenchmark {
+
+namespace fs = std::filesystem;
+
+namespace {
+
+constexpr int icon_variants = 8;
+constexpr int update_every = 4;
+
+// Small deterministic generator, so that the same library is produced on every run
+struct Lcg {
+    u32 state;
+    u32 Next() {
+        state = state * 1664525u + 1013904223u;
+        return state >> 8;
+    }
+};
+
+std::string MakeTitle(int index) {
+    static constexpr std::array<std::string_view, 16> words = {
+        "Shadow", "Legend", "Racing", "Knight", "Galaxy",   "Tactics", "Dragon", "Storm",
+        "Zero",   "Rising", "Quest",  "Arena",  "Chrono", "Frontier", "Echo",    "Wild"};
+    Lcg rng{static_cast<u32>(index) * 2654435761u};
+    std::string title;
+    const u32 word_count = 2 + rng.Next() % 3;
+    for (u32 i = 0; i < word_count; ++i) {
+        if (i != 0) {
+            title += ' ';
+        }
+        title += words[rng.Next() % words.size()];
+    }
+    return fmt::format("{} {}", title, index);
+}
+
+QByteArray MakeIcon(int variant) {
+    // Retail icons are 512x512, draw something that does not compress down to nothing
+    QImage image(512, 512, QImage::Format_RGB32);
+    QPainter painter(&image);
+    QLinearGradient gradient(0, 0, 512, 512);
+    gradient.setColorAt(0, QColor::fromHsv((variant * 45) % 360, 200, 220));
+    gradient.setColorAt(1, QColor::fromHsv((variant * 45 + 120) % 360, 180, 90));
+    painter.fillRect(image.rect(), gradient);
+
+    Lcg rng{static_cast<u32>(variant) + 1};
+    for (int i = 0; i < 400; ++i) {
+        painter.fillRect(rng.Next() % 512, rng.Next() % 512, 4 + rng.Next() % 24,
+                         4 + rng.Next() % 24, QColor::fromRgb(rng.Next() & 0xFFFFFF));
+    }
+    painter.end();
+
+    QByteArray bytes;
+    QBuffer buffer(&bytes);
+    buffer.open(QIODevice::WriteOnly);
+    image.save(&buffer, "PNG");
+    return bytes;
+}
+
+std::vector<u8> MakeNpBind(const std::string& np_comm_id) {
+    const auto put_u16 = [](std::vector<u8>& out, u16 value) {
+        const u16_be be = value;
+        const auto* bytes = reinterpret_cast<const u8*>(&be);
+        out.insert(out.end(), bytes, bytes + sizeof(be));
+    };
+    const auto put_entry = [&](std::vector<u8>& out, u16 type, std::string_view data,
+                               size_t size) {
+        put_u16(out, type);
+        put_u16(out, static_cast<u16>(size));
+        const size_t offset = out.size();
+        out.resize(offset + size);
+        std::memcpy(out.data() + offset, data.data(), std::min(data.size(), size));
+    };
+
+    std::vector<u8> body;
+    put_entry(body, 0x0010, np_comm_id, 12);
+    put_entry(body, 0x0011, "", 12);
+    put_entry(body, 0x0012, "", 176);
+    put_entry(body, 0x0013, "", 16);
+    body.resize(body.size() + 0x98);
+
+    NpBindHeader header{};
+    header.magic = NPBIND_MAGIC;
+    header.version = 1;
+    header.entry_size = body.size();
+    header.num_entries = 1;
+    header.file_size = sizeof(header) + body.size() + 20;
+
+    std::vector<u8> out(sizeof(header));
+    std::memcpy(out.data(), &header, sizeof(header));
+    out.insert(out.end(), body.begin(), body.end());
+    out.resize(header.file_size);
+    return out;
+}
+
+bool WriteFile(const fs::path& path, const char* data, qsizetype size) {
+    QFile file(Common::FS::QStringFromPath(path));
+    return file.open(QIODevice::WriteOnly) && file.write(data, size) == size;
+}
+
+bool WriteGame(const fs::path& game_dir, int index, bool is_update, const QByteArray& icon) {
+    const std::string serial = fmt::format("CUSA{:05}", index);
+    static constexpr std::array<char, 5> regions = {'U', 'E', 'J', 'H', 'I'};
+
+    std::error_code ec;
+    fs::create_directories(game_dir / "sce_sys", ec);
+    if (ec) {
+        return false;
+    }
+
+    PSF psf;
+    psf.AddString("TITLE", MakeTitle(index));
+    psf.AddString("TITLE_ID", serial);
+    psf.AddString("CONTENT_ID",
+                  fmt::format("{}P0000-{}_00-SYNTHETIC0000000", regions[index % 5], serial));
+    psf.AddString("CATEGORY", is_update ? "gp" : "gd");
+    psf.AddString("APP_VER", is_update ? "01.05" : "01.00");
+    psf.AddString("PUBTOOLINFO",
+                  fmt::format("c_date=20200101,sdk_ver=0{}508001,st_type=digital50",
+                              4 + index % 6));
+    psf.AddInteger("SYSTEM_VER", static_cast<s32>((0x04u + index % 6) << 24 | 0x50u << 16));
+    psf.AddString("INSTALL_DIR_SAVEDATA", serial);
+    if (!psf.Encode(game_dir / "sce_sys" / "param.sfo")) {
+        return false;
+    }
+
+    const std::vector<u8> npbind = MakeNpBind(fmt::format("NPWR{:05}_00", index));
+    return WriteFile(game_dir / "sce_sys" / "npbind.dat",
+                     reinterpret_cast<const char*>(npbind.data()),
+                     static_cast<qsizetype>(npbind.size())) &&
+           WriteFile(game_dir / "sce_sys" / "icon0.png", icon.constData(), icon.size());
+}
+
+} // namespace
+
+bool GenerateLibrary(const fs::path& dir, int count) {
+    std::array<QByteArray, icon_variants> icons;
+    for (int i = 0; i < icon_variants; ++i) {
+        icons[i] = MakeIcon(i);
+    }
+
+    for (int i = 0; i < count; ++i) {
+        const fs::path game_dir = dir / fmt::format("CUSA{:05}", i);
+        if (fs::exists(game_dir / "sce_sys" / "param.sfo")) {
+            continue;
+        }
+        if (!WriteGame(game_dir, i, false, icons[i % icon_variants])) {
+            std::cerr << "Failed to write " << game_dir.string() << "\n";
+            return false;
+        }
+        if (i % update_every == 0 &&
+            !WriteGame(dir / fmt::format("CUSA{:05}-UPDATE", i), i, true,
+                       icons[(i + 1) % icon_variants])) {
+            std::cerr << "Failed to write update of " << game_dir.string() << "\n";
+            return false;
+        }
+    }
+    return true;
+}
+
+int Run(const fs::path& dir, const std::vector<int>& sizes) {
+    // The game list writes settings and composed icons, keep them away from the user's own. A
+    // crash leaves the temporary directory behind at worst.
+    const QTemporaryDir user_dir;
+    if (!user_dir.isValid()) {
+        std::cerr << "Failed to create a temporary user directory\n";
+        return 1;
+    }
+    Common::FS::SetUserDir(Common::FS::PathFromQString(user_dir.path()));
+
+    auto gui_settings = std::make_shared<GUISettings>();
+    auto persistent_settings = std::make_shared<PersistentSettings>();
+
+    std::cout << fmt::format("{:>8} {:>8} {:>8} {:>8} {:>8} {:>8}  (ms)\n", "games", "scan",
+                             "parse", "merge", "table", "grid");
+
+    for (const int size : sizes) {
+        const fs::path library_dir = dir / std::to_string(size);
+
+        QElapsedTimer timer;
+        timer.start();
+        if (!GenerateLibrary(library_dir, size)) {
+            return 1;
+        }
+        if (const qint64 elapsed = timer.elapsed(); elapsed > 1000) {
+            std::cout << fmt::format("generated {} games in {} ms\n", size, elapsed);
+        }
+
+        // In-memory settings only, the benchmark must not change the user's game directories
+        auto emu_settings = std::make_shared<EmulatorSettingsImpl>();
+        emu_settings->SetGameInstallDirs({library_dir});
+        EmulatorSettingsImpl::SetInstance(emu_settings);
+
+        GameListFrame frame(gui_settings, emu_settings, persistent_settings, nullptr);
+        frame.SetListMode(true);
+
+        QEventLoop loop;
+        QObject::connect(&frame, &GameListFrame::Refreshed, &loop, &QEventLoop::quit);
+        frame.Refresh(true);
+        loop.exec();
+
+        const GameListFrame::RefreshTimings timings = frame.GetRefreshTimings();
+        timer.restart();
+        frame.SetListMode(false);
+        const qint64 grid_ms = timer.elapsed();
+
+        std::cout << fmt::format("{:>8} {:>8} {:>8} {:>8} {:>8} {:>8}\n",
+                                 frame.GetGameInfo().size(), timings.scan_ms, timings.parse_ms,
+                                 timings.merge_ms, timings.populate_ms, grid_ms);
+    }
+    return 0;
+}
+
+} // namespace LibraryBenchmark
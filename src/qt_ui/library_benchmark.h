@@ -0,0 +1,38 @@
+// SPDX-FileCopyrightText: Copyright 2025-2026 shadLauncher4 Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <filesystem>
+#include <vector>
+
+/**
+ * Developer tooling to measure how the game list scales with the size of the library, without
+ * owning thousands of real game dumps.
+ */
+namespace LibraryBenchmark {
+
+/// Library sizes used when none are given on the command line
+inline const std::vector<int> default_sizes = {1000, 10000, 50000};
+/// Largest library size, games are numbered by the five digits of their CUSA serial
+constexpr int max_size = 99999;
+
+/**
+ * Writes count fake game directories into dir: sce_sys/param.sfo, npbind.dat and a 512x512
+ * icon0.png each. Every fourth game also gets a -UPDATE twin with a newer param.sfo.
+ * Existing games are left untouched, so a library can be grown in place.
+ */
+bool GenerateLibrary(const std::filesystem::path& dir, int count);
+
+/**
+ * Generates a library of each size below dir if needed, refreshes a headless game list from it
+ * and prints scan, parse, merge and table/grid populate timings to stdout.
+ *
+ * Runs against a temporary user directory, so the settings and the icon cache of the user are
+ * left alone.
+ *
+ * @returns process exit code
+ */
+int Run(const std::filesystem::path& dir, const std::vector<int>& sizes);
+
+} // namespace LibraryBenchmark
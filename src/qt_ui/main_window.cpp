@@ -21,6 +21,7 @@
 #include "gui_settings.h"
 #include "hotkeys.h"
 #include "kbm_gui.h"
+#include "launch_payload_cache.h"
 #include "main_window.h"
 #include "pkg_install_dir_select_dialog.h"
 #include "pkg_install_model.h"
@@ -47,6 +48,8 @@ MainWindow::MainWindow(std::shared_ptr<GUISettings> gui_settings,
 
     setAttribute(Qt::WA_DeleteOnClose);
 
+    m_launch_payloads = new LaunchPayloadCache(this);
+
     m_ipc_client->gameClosedFunc = [this]() { onGameClosed(); };
     m_ipc_client->restartEmulatorFunc = [this]() { RestartEmulator(); };
     m_ipc_client->startGameFunc = [this]() { RunGame(); };
@@ -330,6 +333,12 @@ void MainWindow::createConnects() {
     connect(m_game_list_frame, &GameListFrame::RequestBoot, this,
             [this](game_info game, QStringList args) { StartGameWithArgs(game, args); });
 
+    // Resolve the launch of the selected game ahead of time, Play then only spawns the emulator
+    connect(m_game_list_frame, &GameListFrame::NotifyGameSelection, m_launch_payloads,
+            &LaunchPayloadCache::Prepare);
+    connect(m_game_list_frame, &GameListFrame::Refreshed, m_launch_payloads,
+            &LaunchPayloadCache::Invalidate);
+
     connect(m_ipc_client.get(), &IpcClient::LogEntrySent, m_game_list_frame,
             &GameListFrame::PrintLog);
 
@@ -1050,17 +1059,16 @@ void MainWindow::StartGameWithArgs(const game_info& game, QStringList args) {
         selected_game_info = game;
     }
 
-    std::filesystem::path basePath = selected_game_info->info.path;
-    std::filesystem::path ebootPath = basePath / "eboot.bin";
-    Common::FS::PathToQString(gamePath, ebootPath);
+    const auto payload = m_launch_payloads->Get(selected_game_info);
+    Common::FS::PathToQString(gamePath, payload->eboot_path);
 
     if (gamePath != "") {
         // AddRecentFiles(gamePath);
-        if (!std::filesystem::exists(ebootPath)) {
+        if (!payload->eboot_exists) {
             QMessageBox::critical(nullptr, tr("Run Game"), QString(tr("Eboot.bin file not found")));
             return;
         }
-        StartEmulator(ebootPath, args);
+        StartEmulator(payload->eboot_path, args);
         last_game_info = selected_game_info;
 
         // UpdateToolbarButtons();
@@ -1104,11 +1112,9 @@ void MainWindow::StartEmulator(std::filesystem::path path, QStringList args) {
 }
 
 void MainWindow::RunGame() {
-    auto info = last_game_info;
-    auto appVersion = info->info.app_ver;
-    auto gameSerial = info->info.serial;
-    auto patches = MemoryPatcher::readPatches(gameSerial, appVersion);
-    for (auto patch : patches) {
+    // Prepared when the game was selected, unless the patches changed since
+    const auto payload = m_launch_payloads->Get(last_game_info);
+    for (const auto& patch : payload->patches) {
         m_ipc_client->sendMemoryPatches(patch.modName, patch.address, patch.value, patch.target,
                                         patch.size, patch.maskOffset, patch.littleEndian,
                                         patch.mask, patch.maskOffset);
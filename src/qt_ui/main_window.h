@@ -19,6 +19,7 @@ class GUISettings;
 class PersistentSettings;
 class GameListFrame;
 class IpcClient;
+class LaunchPayloadCache;
 
 namespace Ui {
 class MainWindow;
@@ -94,5 +95,6 @@ private:
 
     // IPC things
     game_info last_game_info;
+    LaunchPayloadCache* m_launch_payloads = nullptr;
     bool is_paused;
 };
@@ -0,0 +1,215 @@
+// SPDX-FileCopyrightText: Copyright 2025-2026 shadLauncher4 Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <optional>
+#include <QCoreApplication>
+#include <QCryptographicHash>
+#include <QDateTime>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QHash>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QSaveFile>
+#include <QXmlStreamReader>
+#include <QtConcurrent>
+
+#include "patch_repository_index.h"
+
+namespace {
+
+constexpr int cache_version = 1;
+
+struct CachedFile {
+    qint64 size = -1;
+    qint64 mtime = 0;
+    QByteArray sha;
+    QStringList title_ids;
+    QStringList app_versions;
+};
+
+struct Work {
+    QString path;
+    qint64 size = 0;
+    qint64 mtime = 0;
+    std::optional<CachedFile> cached;
+    CachedFile result;
+    QString error;
+};
+
+QString Translate(const char* text) {
+    return QCoreApplication::translate("CheatsPatches", text);
+}
+
+// Sibling of the repository directory, so a repository sync does not throw it away
+QString CachePath(const QString& repository_dir) {
+    const QFileInfo info(repository_dir);
+    return info.dir().filePath(info.fileName() + ".index.json");
+}
+
+QHash<QString, CachedFile> LoadCache(const QString& path) {
+    QHash<QString, CachedFile> cache;
+    QFile file(path);
+    if (!file.open(QIODevice::ReadOnly)) {
+        return cache;
+    }
+    const QJsonObject root = QJsonDocument::fromJson(file.readAll()).object();
+    if (root["version"].toInt() != cache_version) {
+        return cache;
+    }
+    const QJsonObject files = root["files"].toObject();
+    for (auto it = files.constBegin(); it != files.constEnd(); ++it) {
+        const QJsonObject entry = it.value().toObject();
+        cache.insert(it.key(), CachedFile{
+                                   .size = entry["size"].toInteger(-1),
+                                   .mtime = entry["mtime"].toInteger(),
+                                   .sha = entry["sha"].toString().toLatin1(),
+                                   .title_ids = entry["ids"].toVariant().toStringList(),
+                                   .app_versions = entry["versions"].toVariant().toStringList(),
+                               });
+    }
+    return cache;
+}
+
+void StoreCache(const QString& path, const std::vector<Work>& works,
+                const std::vector<PatchRepositoryIndex::File>& files) {
+    QJsonObject entries;
+    for (std::size_t i = 0; i < works.size(); ++i) {
+        const Work& work = works[i];
+        entries[files[i].name] = QJsonObject{
+            {"size", work.size},
+            {"mtime", work.mtime},
+            {"sha", QString::fromLatin1(work.result.sha)},
+            {"ids", QJsonArray::fromStringList(work.result.title_ids)},
+            {"versions", QJsonArray::fromStringList(work.result.app_versions)},
+        };
+    }
+    QSaveFile file(path);
+    if (file.open(QIODevice::WriteOnly)) {
+        file.write(QJsonDocument(QJsonObject{{"version", cache_version}, {"files", entries}})
+                       .toJson(QJsonDocument::Compact));
+        file.commit();
+    }
+}
+
+// Runs on a pool thread, only touches work
+void ParseFile(Work& work) {
+    QFile file(work.path);
+    if (!file.open(QIODevice::ReadOnly | QIODevice::Text)) {
+        work.error = QString(Translate("Failed to open file:") + "\n%1")
+                         .arg(QFileInfo(work.path).fileName());
+        work.size = -1; // Never matches, so the file is tried again next time
+        return;
+    }
+    const QByteArray data = file.readAll();
+    work.result.sha = QCryptographicHash::hash(data, QCryptographicHash::Sha1).toHex();
+
+    // Copied files get a new time but keep their contents
+    if (work.cached && work.cached->sha == work.result.sha) {
+        work.result.title_ids = work.cached->title_ids;
+        work.result.app_versions = work.cached->app_versions;
+        return;
+    }
+
+    QXmlStreamReader xmlReader(data);
+    while (!xmlReader.atEnd() && !xmlReader.hasError()) {
+        if (xmlReader.readNext() != QXmlStreamReader::StartElement) {
+            continue;
+        }
+        if (xmlReader.name() == QStringLiteral("ID")) {
+            work.result.title_ids.append(xmlReader.readElementText());
+        } else if (xmlReader.name() == QStringLiteral("Metadata")) {
+            const QString appVer = xmlReader.attributes().value("AppVer").toString();
+            if (!appVer.isEmpty() && !work.result.app_versions.contains(appVer)) {
+                work.result.app_versions.append(appVer);
+            }
+        }
+    }
+    if (xmlReader.hasError()) {
+        work.error = QString(Translate("XML ERROR:") + "\n%1").arg(xmlReader.errorString());
+    }
+}
+
+bool WriteFilesJson(const QString& path, const std::vector<PatchRepositoryIndex::File>& files) {
+    QJsonObject filesObject;
+    for (const auto& file : files) {
+        filesObject[file.name] = QJsonArray::fromStringList(file.title_ids);
+    }
+    QSaveFile jsonFile(path);
+    if (!jsonFile.open(QIODevice::WriteOnly)) {
+        return false;
+    }
+    jsonFile.write(QJsonDocument(filesObject).toJson());
+    return jsonFile.commit();
+}
+
+} // namespace
+
+PatchRepositoryIndex::Result PatchRepositoryIndex::Update(const QString& repository_dir) {
+    Result result;
+    QDir dir(repository_dir);
+    if (!dir.exists()) {
+        dir.mkpath(".");
+    }
+
+    const QString cache_path = CachePath(repository_dir);
+    QHash<QString, CachedFile> cache = LoadCache(cache_path);
+
+    // Files whose size and time did not change are taken as they are
+    const QFileInfoList infos = dir.entryInfoList({"*.xml"}, QDir::Files, QDir::Name);
+    std::vector<Work> works(infos.size());
+    std::vector<Work*> stale;
+    qsizetype cached_count = 0;
+    for (qsizetype i = 0; i < infos.size(); ++i) {
+        const QFileInfo& info = infos[i];
+        Work& work = works[i];
+        work.path = info.filePath();
+        work.size = info.size();
+        work.mtime = info.lastModified().toMSecsSinceEpoch();
+
+        const auto it = cache.find(info.fileName());
+        if (it != cache.end()) {
+            ++cached_count;
+        }
+        if (it != cache.end() && it->size == work.size && it->mtime == work.mtime) {
+            work.result = *it;
+        } else {
+            if (it != cache.end()) {
+                work.cached = *it;
+            }
+            stale.push_back(&work);
+        }
+    }
+    QtConcurrent::blockingMap(stale, [](Work* work) { ParseFile(*work); });
+
+    // Files that were only touched or copied keep what files.json and the patch index were built
+    // from, they only need their new size and time in the cache
+    const bool added_or_removed = cached_count != infos.size() || cache.size() != cached_count;
+    const auto read_changed = [](const Work* work) {
+        return !work->cached || work->cached->title_ids != work->result.title_ids ||
+               work->cached->app_versions != work->result.app_versions;
+    };
+    result.changed = added_or_removed || std::ranges::any_of(stale, read_changed);
+    result.files.reserve(works.size());
+    for (qsizetype i = 0; i < infos.size(); ++i) {
+        Work& work = works[i];
+        if (!work.error.isEmpty()) {
+            result.errors.append(work.error);
+        }
+        result.files.push_back(
+            File{infos[i].fileName(), work.result.title_ids, work.result.app_versions});
+    }
+
+    const QString files_json = dir.filePath("files.json");
+    if (result.changed || !stale.empty()) {
+        StoreCache(cache_path, works, result.files);
+    }
+    if ((result.changed || !QFile::exists(files_json)) &&
+        !WriteFilesJson(files_json, result.files)) {
+        result.errors.append(Translate("Failed to open files.json for writing"));
+    }
+    return result;
+}
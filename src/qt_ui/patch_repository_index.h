@@ -0,0 +1,35 @@
+// SPDX-FileCopyrightText: Copyright 2025-2026 shadLauncher4 Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <vector>
+#include <QString>
+#include <QStringList>
+
+/**
+ * Title IDs and app versions of every patch file in a patch repository.
+ *
+ * What was read from each file is kept next to the repository together with the file's size,
+ * time and hash. Updating only parses the files that changed, several at a time, and writes
+ * files.json again only if a file was added or removed or the title IDs or app versions of one
+ * changed. The file list, the version notices and files.json of the cheats and patches dialog are
+ * all served from it.
+ */
+class PatchRepositoryIndex {
+public:
+    struct File {
+        QString name;
+        QStringList title_ids;
+        QStringList app_versions; // AppVer of every patch in the file
+    };
+
+    struct Result {
+        std::vector<File> files; // Sorted by name
+        QStringList errors;      // Files that could not be read, already formatted for display
+        bool changed = false;    // Files were added or removed, or what was read from one changed
+    };
+
+    /** Brings the index of the repository in repository_dir up to date */
+    static Result Update(const QString& repository_dir);
+};
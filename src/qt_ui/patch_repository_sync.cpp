@@ -0,0 +1,243 @@
+// SPDX-FileCopyrightText: Copyright 2025-2026 shadLauncher4 Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <utility>
+#include <QCoreApplication>
+#include <QCryptographicHash>
+#include <QDebug>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QJsonObject>
+#include <QNetworkAccessManager>
+#include <QNetworkReply>
+#include <QNetworkRequest>
+#include <QPointer>
+#include <QSet>
+#include <QtConcurrent>
+
+#include "patch_repository_sync.h"
+
+namespace {
+
+// Hash git gives a file, which is what the contents API reports as sha
+QByteArray BlobSha(const QByteArray& data) {
+    QCryptographicHash hash(QCryptographicHash::Sha1);
+    hash.addData("blob " + QByteArray::number(data.size()));
+    hash.addData(QByteArrayView("\0", 1));
+    hash.addData(data);
+    return hash.result().toHex();
+}
+
+QByteArray FileBlobSha(const QString& path) {
+    QFile file(path);
+    if (!file.open(QIODevice::ReadOnly)) {
+        return {};
+    }
+    return BlobSha(file.readAll());
+}
+
+// Siblings of the repository directory, hidden from the patch list as they have no files.json
+QString SiblingDir(const QString& dir, const char* suffix) {
+    const QFileInfo info(dir);
+    return info.dir().filePath("." + info.fileName() + suffix);
+}
+
+} // namespace
+
+PatchRepositorySync::PatchRepositorySync(QString repository_dir, QObject* parent)
+    : QObject(parent), m_dir(std::move(repository_dir)),
+      m_staging_dir(SiblingDir(m_dir, ".sync")), m_manager(new QNetworkAccessManager(this)) {}
+
+PatchRepositorySync::~PatchRepositorySync() {
+    AbortAll();
+}
+
+void PatchRepositorySync::Start(const QJsonArray& listing) {
+    AbortAll();
+    m_queue.clear();
+    m_next = 0;
+    m_done = 0;
+    m_running = true;
+
+    std::vector<RemoteFile> files;
+    for (const auto& value : listing) {
+        const QJsonObject object = value.toObject();
+        const QString name = object["name"].toString();
+        // Names end up in paths, anything that could leave the directory is skipped
+        if (!name.endsWith(".xml") || name.contains('/') || name.contains('\\') ||
+            name.startsWith('.')) {
+            continue;
+        }
+        files.push_back(RemoteFile{name, QUrl(object["download_url"].toString()),
+                                   object["sha"].toString().toLatin1().toLower()});
+    }
+
+    // An error reply of the API lists nothing, which must not empty the repository
+    if (files.empty()) {
+        Fail(tr("The repository listing is empty."));
+        return;
+    }
+
+    // Hashing and copying the local files is disk work, keep it off the GUI thread
+    (void)QtConcurrent::run([dir = m_dir, staging_dir = m_staging_dir, files = std::move(files),
+                             receiver = QPointer<PatchRepositorySync>(this)] {
+        Plan plan = Prepare(dir, staging_dir, files);
+        QMetaObject::invokeMethod(
+            QCoreApplication::instance(),
+            [receiver, plan = std::move(plan)]() mutable {
+                if (receiver) {
+                    receiver->OnPrepared(std::move(plan));
+                }
+            },
+            Qt::QueuedConnection);
+    });
+}
+
+PatchRepositorySync::Plan PatchRepositorySync::Prepare(const QString& repository_dir,
+                                                       const QString& staging_dir,
+                                                       const std::vector<RemoteFile>& files) {
+    Plan plan;
+    QDir(staging_dir).removeRecursively();
+
+    const QDir dir(repository_dir);
+    QSet<QString> remote_names;
+    std::vector<const RemoteFile*> unchanged;
+    for (const RemoteFile& file : files) {
+        remote_names.insert(file.name);
+        if (file.sha.isEmpty() || FileBlobSha(dir.filePath(file.name)) != file.sha) {
+            plan.fetch.push_back(file);
+        } else {
+            unchanged.push_back(&file);
+        }
+    }
+
+    const QStringList local_files = dir.entryList({"*.xml"}, QDir::Files);
+    plan.changed = !plan.fetch.empty() ||
+                   std::ranges::any_of(local_files, [&](const QString& name) {
+                       return !remote_names.contains(name);
+                   });
+    if (!plan.changed) {
+        return plan;
+    }
+
+    // The staging directory becomes the repository, so it needs the unchanged files as well
+    const QDir staging(staging_dir);
+    if (!QDir().mkpath(staging_dir)) {
+        plan.error = tr("Failed to create directory:") + "\n" + staging_dir;
+        return plan;
+    }
+    for (const RemoteFile* file : unchanged) {
+        if (!QFile::copy(dir.filePath(file->name), staging.filePath(file->name))) {
+            plan.error = tr("Failed to open file:") + "\n" + file->name;
+            return plan;
+        }
+    }
+    return plan;
+}
+
+void PatchRepositorySync::OnPrepared(Plan plan) {
+    if (!m_running) {
+        return;
+    }
+    if (!plan.error.isEmpty()) {
+        Fail(plan.error);
+        return;
+    }
+    if (!plan.changed) {
+        m_running = false;
+        Q_EMIT Finished(false, 0);
+        return;
+    }
+
+    m_queue = std::move(plan.fetch);
+    if (m_queue.empty()) {
+        Finish();
+        return;
+    }
+    FetchNext();
+}
+
+void PatchRepositorySync::FetchNext() {
+    while (m_in_flight.size() < std::size_t{max_in_flight} && m_next < m_queue.size()) {
+        const RemoteFile& file = m_queue[m_next++];
+        QNetworkRequest request(file.url);
+        request.setAttribute(QNetworkRequest::RedirectPolicyAttribute,
+                             QNetworkRequest::NoLessSafeRedirectPolicy);
+        QNetworkReply* reply = m_manager->get(request);
+        m_in_flight.push_back(reply);
+        connect(reply, &QNetworkReply::finished, this,
+                [this, reply, file] { OnFetched(reply, file); });
+    }
+}
+
+void PatchRepositorySync::OnFetched(QNetworkReply* reply, const RemoteFile& file) {
+    std::erase(m_in_flight, reply);
+    reply->deleteLater();
+    if (!m_running) {
+        return;
+    }
+    if (reply->error() != QNetworkReply::NoError) {
+        Fail(file.name + ":\n" + reply->errorString());
+        return;
+    }
+
+    const QByteArray data = reply->readAll();
+    if (!file.sha.isEmpty() && BlobSha(data) != file.sha) {
+        Fail(tr("%1 does not match the repository listing.").arg(file.name));
+        return;
+    }
+    QFile out(QDir(m_staging_dir).filePath(file.name));
+    if (!out.open(QIODevice::WriteOnly) || out.write(data) != data.size()) {
+        Fail(tr("Failed to open file:") + "\n" + file.name);
+        return;
+    }
+    out.close();
+
+    if (++m_done == m_queue.size()) {
+        Finish();
+    } else {
+        FetchNext();
+    }
+}
+
+void PatchRepositorySync::Finish() {
+    m_running = false;
+
+    // Swap the directories, the old copy is only dropped once the new one is in place
+    const QString old_dir = SiblingDir(m_dir, ".old");
+    QDir(old_dir).removeRecursively();
+    const bool had_dir = QDir(m_dir).exists();
+    if (had_dir && !QDir().rename(m_dir, old_dir)) {
+        Fail(tr("Failed to replace directory:") + "\n" + m_dir);
+        return;
+    }
+    if (!QDir().rename(m_staging_dir, m_dir)) {
+        if (had_dir) {
+            QDir().rename(old_dir, m_dir);
+        }
+        Fail(tr("Failed to replace directory:") + "\n" + m_dir);
+        return;
+    }
+    QDir(old_dir).removeRecursively();
+
+    qDebug() << "Patch repository synced:" << m_dir << "fetched" << m_queue.size() << "files";
+    Q_EMIT Finished(true, static_cast<int>(m_queue.size()));
+}
+
+void PatchRepositorySync::Fail(const QString& error) {
+    AbortAll();
+    m_running = false;
+    QDir(m_staging_dir).removeRecursively();
+    Q_EMIT Failed(error);
+}
+
+void PatchRepositorySync::AbortAll() {
+    // Disconnect first, aborting emits finished right away
+    for (QNetworkReply* reply : std::exchange(m_in_flight, {})) {
+        reply->disconnect(this);
+        reply->abort();
+        reply->deleteLater();
+    }
+}
@@ -0,0 +1,70 @@
+// SPDX-FileCopyrightText: Copyright 2025-2026 shadLauncher4 Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <vector>
+#include <QByteArray>
+#include <QJsonArray>
+#include <QObject>
+#include <QString>
+#include <QUrl>
+
+class QNetworkAccessManager;
+class QNetworkReply;
+
+/**
+ * Brings the local copy of a patch repository in line with its GitHub contents listing.
+ *
+ * The listing carries the git blob hash of every file, which is compared with the hash of the
+ * local file, so only new and changed files are fetched, a few at a time. The new copy is put
+ * together in a staging directory and swapped in for the old one once every file arrived, so a
+ * failed sync leaves the repository as it was. Files that are gone from the listing are dropped.
+ */
+class PatchRepositorySync : public QObject {
+    Q_OBJECT
+
+public:
+    static constexpr int max_in_flight = 6;
+
+    PatchRepositorySync(QString repository_dir, QObject* parent = nullptr);
+    ~PatchRepositorySync() override;
+
+    /** listing is the JSON array returned by the contents API, only XML files are synced */
+    void Start(const QJsonArray& listing);
+
+Q_SIGNALS:
+    /** changed is false if the local copy was up to date already */
+    void Finished(bool changed, int downloaded);
+    void Failed(const QString& error);
+
+private:
+    struct RemoteFile {
+        QString name;
+        QUrl url;
+        QByteArray sha; // Hex git blob hash
+    };
+    struct Plan {
+        std::vector<RemoteFile> fetch;
+        bool changed = false;
+        QString error;
+    };
+
+    static Plan Prepare(const QString& repository_dir, const QString& staging_dir,
+                        const std::vector<RemoteFile>& files);
+    void OnPrepared(Plan plan);
+    void FetchNext();
+    void OnFetched(QNetworkReply* reply, const RemoteFile& file);
+    void Finish();
+    void Fail(const QString& error);
+    void AbortAll();
+
+    QString m_dir;
+    QString m_staging_dir;
+    QNetworkAccessManager* m_manager = nullptr;
+    std::vector<RemoteFile> m_queue;
+    std::vector<QNetworkReply*> m_in_flight;
+    std::size_t m_next = 0;
+    std::size_t m_done = 0;
+    bool m_running = false;
+};
@@ -2,35 +2,211 @@
 // SPDX-FileCopyrightText: Copyright 2025-2026 shadLauncher4 Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <optional>
+#include <QDebug>
+#include <QJsonDocument>
+#include <QJsonObject>
+
 #include "persistent_settings.h"
 
+namespace {
+
+// Applies a journal record to entry. Returns the value in the type Flush() writes, an invalid
+// QVariant for a removal, or nothing for a record this build does not know.
+std::optional<QVariant> ApplyRecord(GUI::Persistent::Entry& entry, const QString& key,
+                                    const QJsonValue& value) {
+    if (key == GUI::Persistent::playtime) {
+        entry.playtime = static_cast<quint64>(value.toInteger());
+        return QVariant(entry.playtime);
+    }
+    if (key == GUI::Persistent::last_played) {
+        entry.last_played = value.toString();
+        return QVariant(entry.last_played);
+    }
+    if (key == GUI::Persistent::notes) {
+        entry.notes = value.toString();
+        return entry.notes.isEmpty() ? QVariant() : QVariant(entry.notes);
+    }
+    return std::nullopt;
+}
+
+} // Anonymous namespace
+
 PersistentSettings::PersistentSettings(QObject* parent) : Settings(parent) {
     // Don't use the .ini file ending for now, as it will be confused for a regular gui_settings
     // file.
     m_settings = std::make_unique<QSettings>(ComputeSettingsDir() +
                                                  GUI::Persistent::persistent_file_name + ".dat",
                                              QSettings::Format::IniFormat, parent);
+
+    // Load everything once, lookups are answered from memory from now on
+    auto table = std::make_shared<GUI::Persistent::Table>();
+    const auto load_group = [&](const QString& key, auto&& assign) {
+        m_settings->beginGroup(key);
+        for (const QString& serial : m_settings->childKeys()) {
+            assign((*table)[serial], m_settings->value(serial));
+        }
+        m_settings->endGroup();
+    };
+    load_group(GUI::Persistent::playtime,
+               [](auto& entry, const QVariant& value) { entry.playtime = value.toULongLong(); });
+    load_group(GUI::Persistent::last_played,
+               [](auto& entry, const QVariant& value) { entry.last_played = value.toString(); });
+    load_group(GUI::Persistent::notes,
+               [](auto& entry, const QVariant& value) { entry.notes = value.toString(); });
+    load_group(GUI::Persistent::titles, [](auto& entry, const QVariant& value) {
+        entry.title = value.toString().simplified();
+    });
+
+    m_journal_file.setFileName(ComputeSettingsDir() + GUI::Persistent::persistent_file_name +
+                               ".journal");
+    ReplayJournal(*table);
+    m_table = std::move(table);
+
+    if (!m_journal_file.open(QIODevice::WriteOnly | QIODevice::Append)) {
+        qWarning() << "Could not open" << m_journal_file.fileName() << ":"
+                   << m_journal_file.errorString();
+    }
+
+    m_flush_timer.setSingleShot(true);
+    m_flush_timer.setInterval(GUI::Persistent::journal_compact_delay_ms);
+    connect(&m_flush_timer, &QTimer::timeout, this, &PersistentSettings::Flush);
+
+    // Fold in whatever a previous session left in the journal before it could compact it
+    Flush();
+}
+
+PersistentSettings::~PersistentSettings() {
+    Flush();
+}
+
+std::shared_ptr<const GUI::Persistent::Table> PersistentSettings::GetSnapshot() const {
+    return m_table;
+}
+
+template <typename Func>
+void PersistentSettings::Update(const QString& serial, Func&& func) {
+    // Copy-on-write: readers holding the previous snapshot are unaffected. Snapshots are only
+    // handed out on this thread, so with no other owner the table can be changed in place.
+    if (m_table.use_count() != 1) {
+        m_table = std::make_shared<GUI::Persistent::Table>(*m_table);
+    }
+    func((*m_table)[serial]);
+}
+
+void PersistentSettings::ReplayJournal(GUI::Persistent::Table& table) {
+    QFile file(m_journal_file.fileName());
+    if (!file.open(QIODevice::ReadOnly)) {
+        return;
+    }
+
+    while (!file.atEnd()) {
+        // A record cut short by a power loss fails to parse and is dropped
+        const QJsonObject record = QJsonDocument::fromJson(file.readLine()).object();
+        const QString key = record.value("k").toString();
+        const QString serial = record.value("s").toString();
+        if (key.isEmpty() || serial.isEmpty()) {
+            continue;
+        }
+        if (auto value = ApplyRecord(table[serial], key, record.value("v"))) {
+            m_journal.insert_or_assign(std::make_pair(key, serial), std::move(*value));
+        }
+    }
+}
+
+bool PersistentSettings::AppendRecord(const QString& key, const QString& serial,
+                                      const QVariant& value) {
+    if (!m_journal_file.isOpen()) {
+        return false;
+    }
+
+    QJsonObject record{{"k", key}, {"s", serial}};
+    if (value.isValid()) {
+        record.insert("v", QJsonValue::fromVariant(value));
+    }
+    QByteArray line = QJsonDocument(record).toJson(QJsonDocument::Compact);
+    line += '\n';
+
+    // Handing the record to the OS is enough to survive a crash of the launcher itself
+    return m_journal_file.write(line) == line.size() && m_journal_file.flush();
+}
+
+void PersistentSettings::Journal(const QString& key, const QString& serial, const QVariant& value,
+                                 bool sync) {
+    m_journal.insert_or_assign(std::make_pair(key, serial), value);
+
+    // Without a journal the change only lives in memory, so compact right away
+    if (!AppendRecord(key, serial, value)) {
+        sync = true;
+    }
+
+    if (sync) {
+        Flush();
+    } else if (!m_flush_timer.isActive()) {
+        m_flush_timer.start();
+    }
+}
+
+void PersistentSettings::Flush() {
+    m_flush_timer.stop();
+
+    if (m_journal.empty() || !m_settings) {
+        return;
+    }
+
+    for (const auto& [entry, value] : m_journal) {
+        const auto& [key, serial] = entry;
+        if (value.isValid()) {
+            SetValue(key, serial, value, false);
+        } else {
+            RemoveValue(key, serial, false);
+        }
+    }
+    m_journal.clear();
+
+    Sync();
+
+    // The journal may only go once its records are safely in the .dat file
+    if (m_settings->status() == QSettings::NoError && m_journal_file.isOpen()) {
+        m_journal_file.resize(0);
+    }
 }
 
 void PersistentSettings::SetPlaytime(const QString& serial, quint64 playtime, bool sync) {
-    m_playtime[serial] = playtime;
-    SetValue(GUI::Persistent::playtime, serial, playtime, sync);
+    Update(serial, [&](GUI::Persistent::Entry& entry) { entry.playtime = playtime; });
+    Journal(GUI::Persistent::playtime, serial, playtime, sync);
 }
 
 void PersistentSettings::AddPlaytime(const QString& serial, quint64 elapsed, bool sync) {
-    const quint64 playtime = GetValue(GUI::Persistent::playtime, serial, 0).toULongLong();
-    SetPlaytime(serial, playtime + elapsed, sync);
+    SetPlaytime(serial, GetPlaytime(serial) + elapsed, sync);
 }
 
 quint64 PersistentSettings::GetPlaytime(const QString& serial) {
-    return m_playtime[serial];
+    const auto it = m_table->constFind(serial);
+    return it != m_table->cend() ? it->playtime : 0;
 }
 
 void PersistentSettings::SetLastPlayed(const QString& serial, const QString& date, bool sync) {
-    m_last_played[serial] = date;
-    SetValue(GUI::Persistent::last_played, serial, date, sync);
+    Update(serial, [&](GUI::Persistent::Entry& entry) { entry.last_played = date; });
+    Journal(GUI::Persistent::last_played, serial, date, sync);
 }
 
 QString PersistentSettings::GetLastPlayed(const QString& serial) {
-    return m_last_played[serial];
+    const auto it = m_table->constFind(serial);
+    return it != m_table->cend() ? it->last_played : QString();
+}
+
+void PersistentSettings::SetNotes(const QString& serial, const QString& notes, bool sync) {
+    Update(serial, [&](GUI::Persistent::Entry& entry) { entry.notes = notes; });
+    Journal(GUI::Persistent::notes, serial, notes.isEmpty() ? QVariant() : QVariant(notes), sync);
+}
+
+QString PersistentSettings::GetNotes(const QString& serial) const {
+    const auto it = m_table->constFind(serial);
+    return it != m_table->cend() ? it->notes : QString();
+}
+
+QString PersistentSettings::GetTitle(const QString& serial) const {
+    const auto it = m_table->constFind(serial);
+    return it != m_table->cend() ? it->title : QString();
 }
@@ -4,6 +4,13 @@
 
 #pragma once
 
+#include <map>
+#include <memory>
+#include <utility>
+#include <QFile>
+#include <QHash>
+#include <QTimer>
+
 #include "settings.h"
 
 namespace GUI {
@@ -23,13 +30,42 @@ const QString last_played_date_format_new = "MMMM d, yyyy";
 const QString last_played_date_with_time_of_day_format = "MMMM d, yyyy HH:mm";
 const Qt::DateFormat last_played_date_format = Qt::DateFormat::ISODate;
 
+// Delay before journaled writes are compacted into the .dat file in one batch. Every write is
+// appended to the journal file right away, so this only bounds how long the journal grows.
+constexpr int journal_compact_delay_ms = 30000;
+
+/** Everything stored for a single serial */
+struct Entry {
+    quint64 playtime = 0;
+    QString last_played;
+    QString notes;
+    QString title;
+};
+
+/** Immutable serial-keyed table, safe to read from any thread without locking */
+using Table = QHash<QString, Entry>;
+
 } // namespace Persistent
 } // namespace GUI
+
+/**
+ * Playtime, last played dates, notes and titles of all games.
+ *
+ * The in-memory table is authoritative. A write only appends a one-line record to the journal
+ * file next to the .dat file, and the journal is compacted into the .dat file after a delay, on
+ * request or on exit. QSettings replaces the .dat file atomically, so a crash at any point leaves
+ * either the old or the new file plus a journal that is replayed on the next start.
+ */
 class PersistentSettings : public Settings {
     Q_OBJECT
 
 public:
     explicit PersistentSettings(QObject* parent = nullptr);
+    ~PersistentSettings();
+
+    /** Current state of all entries. Writes copy the table while a snapshot of it is held, so a
+     * snapshot taken before a refresh can be shared with worker threads as is. */
+    std::shared_ptr<const GUI::Persistent::Table> GetSnapshot() const;
 
 public Q_SLOTS:
     void SetPlaytime(const QString& serial, quint64 playtime, bool sync);
@@ -39,7 +75,25 @@ public Q_SLOTS:
     void SetLastPlayed(const QString& serial, const QString& date, bool sync);
     QString GetLastPlayed(const QString& serial);
 
+    /** An empty string removes the entry */
+    void SetNotes(const QString& serial, const QString& notes, bool sync = false);
+    QString GetNotes(const QString& serial) const;
+
+    QString GetTitle(const QString& serial) const;
+
+    /** Compact all journaled changes into the .dat file and empty the journal */
+    void Flush();
+
 private:
-    std::map<QString, quint64> m_playtime;
-    std::map<QString, QString> m_last_played;
-};
\ No newline at end of file
+    void Journal(const QString& key, const QString& serial, const QVariant& value, bool sync);
+    bool AppendRecord(const QString& key, const QString& serial, const QVariant& value);
+    void ReplayJournal(GUI::Persistent::Table& table);
+    template <typename Func>
+    void Update(const QString& serial, Func&& func);
+
+    std::shared_ptr<GUI::Persistent::Table> m_table; // Only handed out as const
+    // (key, serial) -> value, an invalid QVariant removes the entry
+    std::map<std::pair<QString, QString>, QVariant> m_journal;
+    QFile m_journal_file;
+    QTimer m_flush_timer;
+};
@@ -850,10 +850,8 @@ void SettingsDialog::HandleButtonBox() {
 
                     // Delete game-specific config file
                     if (!m_game_serial.empty()) {
-                        const auto gamePath =
-                            Common::FS::GetUserPath(Common::FS::PathType::CustomConfigs) /
-                            (m_game_serial + ".json");
-                        std::filesystem::remove(gamePath);
+                        std::error_code ec;
+                        EmulatorSettingsImpl::RemoveGameConfig(m_game_serial, ec);
                     }
 
                     // Update UI
@@ -37,18 +37,6 @@ const QString default_style_sheet(
 
     // game grid
     "#GameListGrid { background-color: transparent; }"
-    "#flow_widget_content { background-color: transparent; }"
-    "#GameListGridItem[selected=\"true\"] { background: lightblue; }"
-    "#GameListGridItem:focus { border: 2px solid blue; background-color: lightblue; }"
-    "#GameListGridItem:hover { background: #94c9ff; }"
-    "#GameListGridItem:hover:focus { background: #007fff; }"
-    "#GameListGridItem #game_list_grid_item_title_label { color: rgba(51, 51, 51, 255); "
-    "font-weight: 600; font-size: 8pt; font-family: Lucida Grande; border: 0em solid white; }"
-
-    // game grid hover and focus: we need to handle properties differently when using descendants
-    "#GameListGridItem[selected=\"true\"] #game_list_grid_item_title_label { color: #fff; }"
-    "#GameListGridItem[hover=\"true\"] #game_list_grid_item_title_label { color: #fff; }"
-    "#GameListGridItem[focus=\"true\"] #game_list_grid_item_title_label { color: #fff; }"
 
     // tables
     "QTableWidget { background-color: #fff; border: none; }"
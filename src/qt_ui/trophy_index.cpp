@@ -0,0 +1,410 @@
+// SPDX-FileCopyrightText: Copyright 2025-2026 shadLauncher4 Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <array>
+#include <cstring>
+#include <span>
+#include <string_view>
+#include <system_error>
+#include <QDir>
+#include <QFile>
+#include <QSaveFile>
+#include <QXmlStreamReader>
+#include <fmt/core.h>
+
+#include "common/io_file.h"
+#include "common/mapped_file.h"
+#include "common/path_util.h"
+#include "trophy_index.h"
+
+namespace fs = std::filesystem;
+
+namespace {
+
+constexpr u32 index_magic = 0x49505254; // "TRPI"
+constexpr u32 index_version = 1;
+
+constexpr std::array<std::string_view, 31> language_xml_names = {
+    "TROP_00.XML", // 00 Japanese
+    "TROP_01.XML", // 01 English (US)
+    "TROP_02.XML", // 02 French
+    "TROP_03.XML", // 03 Spanish (ES)
+    "TROP_04.XML", // 04 German
+    "TROP_05.XML", // 05 Italian
+    "TROP_06.XML", // 06 Dutch
+    "TROP_07.XML", // 07 Portuguese (PT)
+    "TROP_08.XML", // 08 Russian
+    "TROP_09.XML", // 09 Korean
+    "TROP_10.XML", // 10 Traditional Chinese
+    "TROP_11.XML", // 11 Simplified Chinese
+    "TROP_12.XML", // 12 Finnish
+    "TROP_13.XML", // 13 Swedish
+    "TROP_14.XML", // 14 Danish
+    "TROP_15.XML", // 15 Norwegian
+    "TROP_16.XML", // 16 Polish
+    "TROP_17.XML", // 17 Portuguese (BR)
+    "TROP_18.XML", // 18 English (GB)
+    "TROP_19.XML", // 19 Turkish
+    "TROP_20.XML", // 20 Spanish (LA)
+    "TROP_21.XML", // 21 Arabic
+    "TROP_22.XML", // 22 French (CA)
+    "TROP_23.XML", // 23 Czech
+    "TROP_24.XML", // 24 Hungarian
+    "TROP_25.XML", // 25 Greek
+    "TROP_26.XML", // 26 Romanian
+    "TROP_27.XML", // 27 Thai
+    "TROP_28.XML", // 28 Vietnamese
+    "TROP_29.XML", // 29 Indonesian
+    "TROP_30.XML", // 30 Unkrainian
+};
+
+// Time and size of a file the index was built from, all zero if it does not exist
+struct SourceStamp {
+    s64 time;
+    u64 size;
+
+    bool operator==(const SourceStamp&) const = default;
+};
+
+struct IndexHeader {
+    u32 magic;
+    u32 version;
+    SourceStamp user_xml;
+    SourceStamp language_xml;
+    SourceStamp extraction; // Stamp written by TRP extraction, it changes with the icons
+    u32 total;
+    u32 unlocked;
+};
+static_assert(sizeof(IndexHeader) == 64);
+
+SourceStamp Stamp(const fs::path& path) {
+    std::error_code ec;
+    const auto time = fs::last_write_time(path, ec);
+    if (ec) {
+        return {};
+    }
+    const u64 size = fs::is_directory(path, ec) ? 0 : fs::file_size(path, ec);
+    return {static_cast<s64>(time.time_since_epoch().count()), ec ? 0 : size};
+}
+
+// Best trophy XML for the console language: TROP_XX.XML if the game has one, else TROP.XML
+fs::path LanguageXmlPath(const fs::path& xml_dir, int language) {
+    if (language >= 0 && language < static_cast<int>(language_xml_names.size())) {
+        fs::path path = xml_dir / language_xml_names[language];
+        std::error_code ec;
+        if (fs::exists(path, ec)) {
+            return path;
+        }
+    }
+    return xml_dir / "TROP.XML";
+}
+
+// FNV-1a, the file name has to stay the same across runs and builds
+u64 HashPath(const fs::path& path) {
+    u64 hash = 0xcbf29ce484222325ull;
+    for (const char c : path.generic_string()) {
+        hash ^= static_cast<u8>(c);
+        hash *= 0x100000001b3ull;
+    }
+    return hash;
+}
+
+// One index per user and language
+fs::path IndexPath(const fs::path& trophy_dir, const fs::path& user_xml, int language) {
+    return trophy_dir / "Index" / fmt::format("{:016x}_{}.bin", HashPath(user_xml), language);
+}
+
+IndexHeader CurrentHeader(const fs::path& trophy_dir, const fs::path& user_xml, int language) {
+    IndexHeader header{};
+    header.magic = index_magic;
+    header.version = index_version;
+    header.user_xml = Stamp(user_xml);
+    header.language_xml = Stamp(LanguageXmlPath(trophy_dir / "Xml", language));
+    header.extraction = Stamp(trophy_dir / "trp.stamp");
+    return header;
+}
+
+bool HeaderMatches(const IndexHeader& stored, const IndexHeader& current) {
+    return stored.magic == current.magic && stored.version == current.version &&
+           stored.user_xml == current.user_xml && stored.language_xml == current.language_xml &&
+           stored.extraction == current.extraction;
+}
+
+void WriteString(std::vector<u8>& out, const QString& string) {
+    const QByteArray utf8 = string.toUtf8();
+    const u32 size = static_cast<u32>(utf8.size());
+    const auto* size_bytes = reinterpret_cast<const u8*>(&size);
+    out.insert(out.end(), size_bytes, size_bytes + sizeof(size));
+    out.insert(out.end(), utf8.begin(), utf8.end());
+}
+
+class Reader {
+public:
+    explicit Reader(std::span<const u8> data) : m_data(data) {}
+
+    bool Read(void* object, size_t size) {
+        if (m_data.size() - m_offset < size) {
+            return false;
+        }
+        std::memcpy(object, m_data.data() + m_offset, size);
+        m_offset += size;
+        return true;
+    }
+
+    bool ReadString(QString& string) {
+        u32 size;
+        if (!Read(&size, sizeof(size)) || m_data.size() - m_offset < size) {
+            return false;
+        }
+        string = QString::fromUtf8(reinterpret_cast<const char*>(m_data.data() + m_offset),
+                                   static_cast<qsizetype>(size));
+        m_offset += size;
+        return true;
+    }
+
+private:
+    std::span<const u8> m_data;
+    size_t m_offset = 0;
+};
+
+std::optional<TrophyIndex> ReadIndex(const fs::path& path, const IndexHeader& current) {
+    Common::FS::MappedFile file;
+    if (!file.Open(path) || file.Size() < sizeof(IndexHeader)) {
+        return std::nullopt;
+    }
+    IndexHeader header;
+    std::memcpy(&header, file.Data(), sizeof(header));
+    if (!HeaderMatches(header, current)) {
+        return std::nullopt;
+    }
+
+    Reader reader(file.Span().subspan(sizeof(header)));
+    TrophyIndex index;
+    u32 count;
+    // Every trophy takes more than a byte, which bounds the count of a damaged file
+    if (!reader.ReadString(index.title) || !reader.Read(&count, sizeof(count)) ||
+        count > file.Size()) {
+        return std::nullopt;
+    }
+    index.trophies.resize(count);
+    for (TrophyIndex::Trophy& trophy : index.trophies) {
+        std::array<u8, 4> flags;
+        if (!reader.ReadString(trophy.id) || !reader.ReadString(trophy.pid) ||
+            !reader.ReadString(trophy.name) || !reader.ReadString(trophy.detail) ||
+            !reader.ReadString(trophy.icon_file) || !reader.Read(flags.data(), flags.size()) ||
+            !reader.Read(&trophy.unlock_time, sizeof(trophy.unlock_time))) {
+            return std::nullopt;
+        }
+        trophy.grade = static_cast<char>(flags[0]);
+        trophy.hidden = flags[1] != 0;
+        trophy.unlocked = flags[2] != 0;
+    }
+    return index;
+}
+
+void WriteIndex(const fs::path& path, IndexHeader header, const TrophyIndex& index) {
+    const TrophyIndex::Progress progress = index.GetProgress();
+    header.total = progress.total;
+    header.unlocked = progress.unlocked;
+
+    std::vector<u8> body;
+    WriteString(body, index.title);
+    const u32 count = static_cast<u32>(index.trophies.size());
+    body.insert(body.end(), reinterpret_cast<const u8*>(&count),
+                reinterpret_cast<const u8*>(&count) + sizeof(count));
+    for (const TrophyIndex::Trophy& trophy : index.trophies) {
+        WriteString(body, trophy.id);
+        WriteString(body, trophy.pid);
+        WriteString(body, trophy.name);
+        WriteString(body, trophy.detail);
+        WriteString(body, trophy.icon_file);
+        const std::array<u8, 4> flags = {static_cast<u8>(trophy.grade), trophy.hidden,
+                                         trophy.unlocked, 0};
+        body.insert(body.end(), flags.begin(), flags.end());
+        const auto* time = reinterpret_cast<const u8*>(&trophy.unlock_time);
+        body.insert(body.end(), time, time + sizeof(trophy.unlock_time));
+    }
+
+    std::error_code ec;
+    fs::create_directories(path.parent_path(), ec);
+
+    Common::FS::WriteFileAtomically(path, [&](Common::FS::IOFile& file) {
+        return file.WriteObject(header) &&
+               file.WriteRaw<u8>(body.data(), body.size()) == body.size();
+    });
+}
+
+s64 ParseTimestamp(const QStringView timestamp) {
+    if (timestamp.length() > 10) {
+        return TrophyIndex::unknown_time;
+    }
+    bool ok;
+    const qint64 seconds = timestamp.toLongLong(&ok);
+    return ok ? seconds : TrophyIndex::unknown_time;
+}
+
+std::optional<TrophyIndex> BuildIndex(const fs::path& trophy_dir, const fs::path& user_xml,
+                                      int language) {
+    QString user_xml_path;
+    Common::FS::PathToQString(user_xml_path, user_xml);
+    QFile user_file(user_xml_path);
+    if (!user_file.open(QFile::ReadOnly | QFile::Text)) {
+        return std::nullopt;
+    }
+
+    // Unlock state from the user's copy of TROPCONF.XML
+    std::vector<TrophyIndex::Trophy> states;
+    QXmlStreamReader user_reader(&user_file);
+    while (!user_reader.atEnd() && !user_reader.hasError()) {
+        user_reader.readNext();
+        if (!user_reader.isStartElement() || user_reader.name() != QStringLiteral("trophy")) {
+            continue;
+        }
+        const QXmlStreamAttributes attributes = user_reader.attributes();
+        TrophyIndex::Trophy& trophy = states.emplace_back();
+        trophy.id = attributes.value("id").toString();
+        trophy.hidden = attributes.value("hidden").toString().toLower() == QStringLiteral("yes");
+        const QStringView type = attributes.value("ttype");
+        trophy.grade = type.isEmpty() ? 0 : type.at(0).toLatin1();
+        trophy.pid = attributes.value("pid").toString();
+        if (attributes.hasAttribute("unlockstate")) {
+            trophy.unlocked = attributes.value("unlockstate") == QStringLiteral("true");
+            if (attributes.hasAttribute("timestamp")) {
+                trophy.unlock_time = ParseTimestamp(attributes.value("timestamp"));
+            }
+        }
+    }
+
+    // Names and details in the console language
+    QString language_xml_path;
+    Common::FS::PathToQString(language_xml_path,
+                              LanguageXmlPath(trophy_dir / "Xml", language));
+    QFile language_file(language_xml_path);
+    if (!language_file.open(QFile::ReadOnly | QFile::Text)) {
+        return std::nullopt;
+    }
+
+    TrophyIndex index;
+    QStringList names;
+    QStringList details;
+    QXmlStreamReader reader(&language_file);
+    while (!reader.atEnd() && !reader.hasError()) {
+        reader.readNext();
+        if (reader.isStartElement() && reader.name() == QStringLiteral("title-name")) {
+            index.title = reader.readElementText();
+        }
+        if (reader.isStartElement() && reader.name() == QStringLiteral("trophy")) {
+            while (reader.readNextStartElement()) {
+                if (reader.name() == QStringLiteral("name") && !states.empty()) {
+                    names.append(reader.readElementText());
+                } else if (reader.name() == QStringLiteral("detail") && !states.empty()) {
+                    details.append(reader.readElementText().replace(QChar('\n'), QChar(' ')));
+                } else {
+                    reader.skipCurrentElement();
+                }
+            }
+        }
+    }
+
+    // Icons are matched to trophies by their position in the sorted directory listing
+    QString icons_path;
+    Common::FS::PathToQString(icons_path, trophy_dir / "Icons");
+    const QStringList icon_files =
+        QDir(icons_path).entryList({QStringLiteral("trop*")}, QDir::Files, QDir::Name);
+
+    index.trophies.reserve(icon_files.size());
+    for (qsizetype row = 0; row < icon_files.size(); ++row) {
+        TrophyIndex::Trophy trophy;
+        if (row < static_cast<qsizetype>(states.size())) {
+            trophy = std::move(states[row]);
+        }
+        if (row < names.size() && row < details.size()) {
+            trophy.name = names[row];
+            trophy.detail = details[row];
+        }
+        trophy.icon_file = icon_files[row];
+        index.trophies.push_back(std::move(trophy));
+    }
+    return index;
+}
+
+} // namespace
+
+std::optional<TrophyIndex> TrophyIndex::Load(const fs::path& trophy_dir, const fs::path& user_xml,
+                                             int language) {
+    const IndexHeader current = CurrentHeader(trophy_dir, user_xml, language);
+    const fs::path path = IndexPath(trophy_dir, user_xml, language);
+    if (auto index = ReadIndex(path, current)) {
+        return index;
+    }
+
+    auto index = BuildIndex(trophy_dir, user_xml, language);
+    if (index) {
+        WriteIndex(path, current, *index);
+    }
+    return index;
+}
+
+TrophyIndex::Progress TrophyIndex::LibraryProgress(const fs::path& trophy_root,
+                                                   const fs::path& user_trophy_dir,
+                                                   int language) {
+    Progress progress;
+    std::error_code ec;
+    for (const auto& entry : fs::directory_iterator(trophy_root, ec)) {
+        if (!entry.is_directory()) {
+            continue;
+        }
+        const fs::path& trophy_dir = entry.path();
+        const fs::path user_xml = user_trophy_dir / (trophy_dir.filename().string() + ".xml");
+
+        // Only the header is needed, a stale index does not count until it is rebuilt
+        Common::FS::IOFile file(IndexPath(trophy_dir, user_xml, language),
+                                Common::FS::FileAccessMode::Read);
+        IndexHeader header;
+        if (file.ReadObject(header) &&
+            HeaderMatches(header, CurrentHeader(trophy_dir, user_xml, language))) {
+            progress += Progress{header.total, header.unlocked};
+        }
+    }
+    return progress;
+}
+
+QImage TrophyIndex::Thumbnail(const fs::path& trophy_dir, const QString& icon_file) {
+    const fs::path icon_path = trophy_dir / "Icons" / Common::FS::PathFromQString(icon_file);
+    const fs::path thumbnail_path = trophy_dir / "Thumbs" / Common::FS::PathFromQString(icon_file);
+
+    const SourceStamp icon_stamp = Stamp(icon_path);
+    const SourceStamp thumbnail_stamp = Stamp(thumbnail_path);
+    QString path;
+    if (thumbnail_stamp.time != 0 && thumbnail_stamp.time >= icon_stamp.time) {
+        Common::FS::PathToQString(path, thumbnail_path);
+        if (QImage thumbnail(path); !thumbnail.isNull()) {
+            return thumbnail;
+        }
+    }
+
+    Common::FS::PathToQString(path, icon_path);
+    const QImage thumbnail = QImage(path).scaled(QSize(thumbnail_size, thumbnail_size),
+                                                 Qt::KeepAspectRatio, Qt::SmoothTransformation);
+    if (thumbnail.isNull()) {
+        return thumbnail;
+    }
+
+    std::error_code ec;
+    fs::create_directories(thumbnail_path.parent_path(), ec);
+    Common::FS::PathToQString(path, thumbnail_path);
+    QSaveFile file(path);
+    if (file.open(QIODevice::WriteOnly) && thumbnail.save(&file, "PNG")) {
+        file.commit();
+    }
+    return thumbnail;
+}
+
+TrophyIndex::Progress TrophyIndex::GetProgress() const {
+    Progress progress;
+    progress.total = static_cast<u32>(trophies.size());
+    for (const Trophy& trophy : trophies) {
+        progress.unlocked += trophy.unlocked ? 1 : 0;
+    }
+    return progress;
+}
@@ -0,0 +1,79 @@
+// SPDX-FileCopyrightText: Copyright 2025-2026 shadLauncher4 Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <filesystem>
+#include <limits>
+#include <optional>
+#include <string>
+#include <vector>
+#include <QImage>
+#include <QString>
+
+#include "common/types.h"
+
+/**
+ * Precompiled trophy list of one NPComm ID as seen by one user.
+ *
+ * It is built from the user's trophy XML (unlock state) and the trophy XML of the console
+ * language (names and details), and stored next to the extracted trophy files. The index is
+ * only rebuilt when one of those XML files changes, so showing a trophy list parses no XML. The
+ * header of the file carries the unlock counts, which lets library wide progress be summed up
+ * without reading the trophy lists themselves.
+ */
+class TrophyIndex {
+public:
+    static constexpr s64 unknown_time = -1;
+    static constexpr s64 no_time = std::numeric_limits<s64>::min();
+    static constexpr int thumbnail_size = 128;
+
+    struct Trophy {
+        QString id;
+        QString pid;
+        QString name;
+        QString detail;
+        QString icon_file; // In the Icons directory of the extracted trophy files
+        char grade{};      // B, S, G or P
+        bool hidden{};
+        bool unlocked{};
+        s64 unlock_time = no_time; // Seconds since the epoch, unknown_time or no_time
+    };
+
+    struct Progress {
+        u32 total{};
+        u32 unlocked{};
+
+        Progress& operator+=(const Progress& other) {
+            total += other.total;
+            unlocked += other.unlocked;
+            return *this;
+        }
+    };
+
+    /**
+     * Returns the index of the trophy files in trophy_dir for the user whose trophy XML is
+     * user_xml, building it first if it is missing or outdated. Returns nothing if the XML files
+     * cannot be read.
+     */
+    static std::optional<TrophyIndex> Load(const std::filesystem::path& trophy_dir,
+                                           const std::filesystem::path& user_xml, int language);
+
+    /**
+     * Sums up the progress over every NPComm ID below trophy_root whose index for this user is
+     * up to date. user_trophy_dir holds the trophy XML files of the user.
+     */
+    static Progress LibraryProgress(const std::filesystem::path& trophy_root,
+                                    const std::filesystem::path& user_trophy_dir, int language);
+
+    /**
+     * Returns a trophy icon scaled to thumbnail_size. The scaled icon is kept on disk and made
+     * again when the icon changes. Thread-safe.
+     */
+    static QImage Thumbnail(const std::filesystem::path& trophy_dir, const QString& icon_file);
+
+    Progress GetProgress() const;
+
+    QString title;
+    std::vector<Trophy> trophies;
+};
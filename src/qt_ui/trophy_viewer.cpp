@@ -2,13 +2,16 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include <fstream>
+#include <numeric>
 #include <QCheckBox>
 #include <QDockWidget>
 #include <QGuiApplication>
 #include <QMessageBox>
+#include <QPointer>
 #include <QPushButton>
 #include <QResizeEvent>
 #include <QScreen>
+#include <QtConcurrent>
 #include <cmrc/cmrc.hpp>
 
 #include "common/logging/log.h"
@@ -16,59 +19,9 @@
 #include "core/emulator_settings.h"
 #include "core/file_format/npbind.h"
 #include "core/user_settings.h"
+#include "trophy_index.h"
 #include "trophy_viewer.h"
 
-static constexpr std::array<std::string_view, 31> s_language_xml_names = {
-    "TROP_00.XML", // 00 Japanese
-    "TROP_01.XML", // 01 English (US)
-    "TROP_02.XML", // 02 French
-    "TROP_03.XML", // 03 Spanish (ES)
-    "TROP_04.XML", // 04 German
-    "TROP_05.XML", // 05 Italian
-    "TROP_06.XML", // 06 Dutch
-    "TROP_07.XML", // 07 Portuguese (PT)
-    "TROP_08.XML", // 08 Russian
-    "TROP_09.XML", // 09 Korean
-    "TROP_10.XML", // 10 Traditional Chinese
-    "TROP_11.XML", // 11 Simplified Chinese
-    "TROP_12.XML", // 12 Finnish
-    "TROP_13.XML", // 13 Swedish
-    "TROP_14.XML", // 14 Danish
-    "TROP_15.XML", // 15 Norwegian
-    "TROP_16.XML", // 16 Polish
-    "TROP_17.XML", // 17 Portuguese (BR)
-    "TROP_18.XML", // 18 English (GB)
-    "TROP_19.XML", // 19 Turkish
-    "TROP_20.XML", // 20 Spanish (LA)
-    "TROP_21.XML", // 21 Arabic
-    "TROP_22.XML", // 22 French (CA)
-    "TROP_23.XML", // 23 Czech
-    "TROP_24.XML", // 24 Hungarian
-    "TROP_25.XML", // 25 Greek
-    "TROP_26.XML", // 26 Romanian
-    "TROP_27.XML", // 27 Thai
-    "TROP_28.XML", // 28 Vietnamese
-    "TROP_29.XML", // 29 Indonesian
-    "TROP_30.XML", // 30 Unkrainian
-};
-
-// Returns the best available trophy XML path for the current system language.
-// Resolution order:
-//   1. TROP_XX.XML for the active system language (e.g. TROP01.XML for English)
-//   2. TROP.XML    (master / language-neutral fallback)
-static std::filesystem::path GetTrophyXmlPath(const std::filesystem::path& xml_dir,
-                                              int system_language) {
-    // Try the exact language file first.
-    if (system_language >= 0 && system_language < static_cast<int>(s_language_xml_names.size())) {
-        auto lang_path = xml_dir / s_language_xml_names[system_language];
-        if (std::filesystem::exists(lang_path)) {
-            return lang_path;
-        }
-    }
-    // Final fallback: master TROP.XML (always present).
-    return xml_dir / "TROP.XML";
-}
-
 namespace fs = std::filesystem;
 
 CMRC_DECLARE(res);
@@ -116,6 +69,17 @@ void TrophyViewer::updateTrophyInfo() {
     int progress = (total > 0) ? (unlocked * 100 / total) : 0;
     trophyInfoLabel->setText(
         QString(tr("Progress") + ": %1% (%2/%3)").arg(progress).arg(unlocked).arg(total));
+
+    // Sums up the trophy indexes of every game viewed so far, without opening them
+    const TrophyIndex::Progress library = TrophyIndex::LibraryProgress(
+        Common::FS::GetUserPath(Common::FS::PathType::UserDir) / "trophy",
+        EmulatorSettings.GetHomeDir() / currentUserId_ / "trophy",
+        EmulatorSettings.GetConsoleLanguage());
+    const u32 libraryProgress = library.total > 0 ? library.unlocked * 100 / library.total : 0;
+    libraryProgressLabel->setText(QString(tr("Library Progress") + ": %1% (%2/%3)")
+                                      .arg(libraryProgress)
+                                      .arg(library.unlocked)
+                                      .arg(library.total));
 }
 
 void TrophyViewer::updateTableFilters() {
@@ -271,6 +235,11 @@ TrophyViewer::TrophyViewer(std::shared_ptr<GUISettings> gui_settings, QString tr
         "font-weight: bold; font-size: 16px; color: white; background: #333; padding: 5px;");
     dockLayout->addWidget(trophyInfoLabel);
 
+    libraryProgressLabel = new QLabel(tr("Library Progress") + ": 0% (0/0)", dockWidget);
+    libraryProgressLabel->setStyleSheet(
+        "font-weight: bold; font-size: 12px; color: white; background: #333; padding: 5px;");
+    dockLayout->addWidget(libraryProgressLabel);
+
     // Creates QCheckBox to filter trophies
     showEarnedCheck = new QCheckBox(tr("Show Earned Trophies"), dockWidget);
     showNotEarnedCheck = new QCheckBox(tr("Show Not Earned Trophies"), dockWidget);
@@ -327,11 +296,16 @@ TrophyViewer::TrophyViewer(std::shared_ptr<GUISettings> gui_settings, QString tr
     });
 }
 
+TrophyViewer::~TrophyViewer() {
+    iconLoadCancel_->store(true);
+}
+
 void TrophyViewer::SelectionChanged(int gameIndex, QString user) {
     if (gameIndex < 0 || gameIndex >= allTrophyGames_.size()) {
         return;
     }
 
+    iconLoadCancel_->store(true);
     while (tabWidget->count() > 0) {
         QWidget* widget = tabWidget->widget(0);
         tabWidget->removeTab(0);
@@ -375,34 +349,44 @@ void TrophyViewer::reopenLeftDock() {
 }
 
 void TrophyViewer::PopulateTrophyWidget(QString title, QString user) {
+    const std::filesystem::path trophyRoot =
+        Common::FS::GetUserPath(Common::FS::PathType::UserDir) / "trophy";
+
+    // Every NPComm ID has its own .trp file and output directory, so they are extracted in
+    // parallel. Files that were extracted before are recognized by their stamp and skipped.
+    const std::vector<std::filesystem::path> trpFiles =
+        TRP::ListTrpFiles(GetTrpFilesPath(Common::FS::PathFromQString(gameTrpPath_)), true);
+    QList<int> indices(static_cast<qsizetype>(std::min(npCommIds.size(), trpFiles.size())));
+    std::iota(indices.begin(), indices.end(), 0);
+    if (indices.size() < npCommIds.size()) {
+        LOG_WARNING(Loader, "Found {} trophy files for {} NPComm IDs", trpFiles.size(),
+                    npCommIds.size());
+    }
+    QtConcurrent::blockingMap(indices, [&](int index) {
+        TRP trp;
+        if (!trp.ExtractFile(trpFiles[index], npCommIds[index], trophyRoot / npCommIds[index])) {
+            LOG_ERROR(Loader, "Couldn't extract trophies");
+        }
+    });
 
-    int index = 0;
-    for (const auto& npCommId : npCommIds) {
-        auto trophyFilesPath =
-            Common::FS::GetUserPath(Common::FS::PathType::UserDir) / "trophy" / npCommId;
-        QString trophyDirQt;
-        Common::FS::PathToQString(trophyDirQt, trophyFilesPath);
-
-        std::filesystem::path extractPath =
-            GetTrpFilesPath(Common::FS::PathFromQString(gameTrpPath_));
-        QDir dir(trophyDirQt);
-        if (!dir.exists()) {
-            if (!trp.Extract(extractPath, index, npCommId, trophyFilesPath, true)) {
-                LOG_ERROR(Loader, "Couldn't extract trophies");
-            }
+    const int language = EmulatorSettings.GetConsoleLanguage();
+    currentUserId_ = "1000";
+    for (const auto& User : UserSettings.GetUserManager().GetAllUsers()) {
+        if (User.user_name == user) {
+            currentUserId_ = std::to_string(User.user_id);
         }
+    }
 
-        index++;
+    // Icons of the previous game are no longer needed
+    iconLoadCancel_->store(true);
+    iconLoadCancel_ = std::make_shared<std::atomic<bool>>(false);
 
-        const std::string filename = npCommId + ".xml";
-        std::string userId = "1000";
-        for (const auto& User : UserSettings.GetUserManager().GetAllUsers()) {
-            if (User.user_name == user) {
-                userId = std::to_string(User.user_id);
-            }
-        }
+    for (const auto& npCommId : npCommIds) {
+        const auto trophyFilesPath = trophyRoot / npCommId;
 
-        auto user_trophy_file = EmulatorSettings.GetHomeDir() / userId / "trophy" / filename;
+        const std::string filename = npCommId + ".xml";
+        auto user_trophy_file =
+            EmulatorSettings.GetHomeDir() / currentUserId_ / "trophy" / filename;
         if (!std::filesystem::exists(user_trophy_file)) {
             if (!std::filesystem::exists(user_trophy_file.parent_path())) {
                 std::filesystem::create_directories(user_trophy_file.parent_path());
@@ -413,119 +397,18 @@ void TrophyViewer::PopulateTrophyWidget(QString title, QString user) {
                                        discard);
         }
 
-        QFileInfoList dirList = dir.entryInfoList(QDir::Dirs | QDir::NoDotAndDotDot);
-        if (dirList.isEmpty())
-            return;
-
-        QString trpDir = trophyDirQt;
-
-        QString iconsPath = trpDir + "/Icons";
-        QDir iconsDir(iconsPath);
-        QFileInfoList iconDirList = iconsDir.entryInfoList(QDir::Files | QDir::NoDotAndDotDot);
-        std::vector<QImage> icons;
-
-        for (const QFileInfo& iconInfo : iconDirList) {
-            QString fileName = iconInfo.fileName();
-
-            // Skip files that doesn't start with "trop" or "TROP"
-            if (!fileName.startsWith("trop", Qt::CaseInsensitive))
-                continue;
-
-            QImage icon =
-                QImage(iconInfo.absoluteFilePath())
-                    .scaled(QSize(128, 128), Qt::KeepAspectRatio, Qt::SmoothTransformation);
-            icons.push_back(icon);
-        }
-
-        QStringList trpId;
-        QStringList trpHidden;
-        QStringList trpUnlocked;
-        QStringList trpType;
-        QStringList trpPid;
-        QStringList trophyNames;
-        QStringList trophyDetails;
-        QStringList trpTimeUnlocked;
-
-        QString userXmlPath;
-        Common::FS::PathToQString(userXmlPath, user_trophy_file);
-        QFile userFile(userXmlPath);
-        if (!userFile.open(QFile::ReadOnly | QFile::Text)) {
+        std::error_code ec;
+        if (!std::filesystem::is_directory(trophyFilesPath / "Xml", ec))
             return;
-        }
 
-        QXmlStreamReader usrFileReader(&userFile);
-        while (!usrFileReader.atEnd() && !usrFileReader.hasError()) {
-            usrFileReader.readNext();
-            if (usrFileReader.isStartElement() && usrFileReader.name().toString() == "trophy") {
-                trpId.append(usrFileReader.attributes().value("id").toString());
-                trpHidden.append(usrFileReader.attributes().value("hidden").toString());
-                trpType.append(usrFileReader.attributes().value("ttype").toString());
-                trpPid.append(usrFileReader.attributes().value("pid").toString());
-
-                if (usrFileReader.attributes().hasAttribute("unlockstate")) {
-                    if (usrFileReader.attributes().value("unlockstate").toString() == "true") {
-                        trpUnlocked.append("unlocked");
-                    } else {
-                        trpUnlocked.append("locked");
-                    }
-                    if (usrFileReader.attributes().hasAttribute("timestamp")) {
-                        QString ts = usrFileReader.attributes().value("timestamp").toString();
-                        if (ts.length() > 10)
-                            trpTimeUnlocked.append("unknown");
-                        else {
-                            bool ok;
-                            qint64 timestampInt = ts.toLongLong(&ok);
-                            if (ok) {
-                                QDateTime dt = QDateTime::fromSecsSinceEpoch(timestampInt);
-                                QString format = useEuropeanDateFormat ? "dd/MM/yyyy HH:mm:ss"
-                                                                       : "MM/dd/yyyy HH:mm:ss";
-                                trpTimeUnlocked.append(dt.toString(format));
-                            } else {
-                                trpTimeUnlocked.append("unknown");
-                            }
-                        }
-                    } else {
-                        trpTimeUnlocked.append("");
-                    }
-                } else {
-                    trpUnlocked.append("locked");
-                    trpTimeUnlocked.append("");
-                }
-            }
-        }
-
-        std::filesystem::path path = GetTrophyXmlPath(
-            Common::FS::GetUserPath(Common::FS::PathType::UserDir) / "trophy" / npCommId / "Xml",
-            EmulatorSettings.GetConsoleLanguage());
-        QString xmlPath;
-        Common::FS::PathToQString(xmlPath, path);
-
-        QFile file(xmlPath);
-        if (!file.open(QFile::ReadOnly | QFile::Text)) {
-            QMessageBox::information(this, "test", "did not open");
+        // Parses the XML files only if they changed since the index was built
+        const std::optional<TrophyIndex> index =
+            TrophyIndex::Load(trophyFilesPath, user_trophy_file, language);
+        if (!index) {
+            LOG_ERROR(Loader, "Couldn't read the trophy list of {}", npCommId);
             return;
         }
 
-        QString tabName;
-        QXmlStreamReader reader(&file);
-        while (!reader.atEnd() && !reader.hasError()) {
-            reader.readNext();
-            if (reader.isStartElement() && reader.name().toString() == "title-name") {
-                tabName = reader.readElementText();
-            }
-
-            if (reader.isStartElement() && reader.name().toString() == "trophy") {
-                while (reader.readNextStartElement()) {
-                    if (reader.name().toString() == "name" && !trpId.isEmpty()) {
-                        trophyNames.append(reader.readElementText());
-                    }
-                    if (reader.name().toString() == "detail" && !trpId.isEmpty()) {
-                        trophyDetails.append(reader.readElementText());
-                    }
-                }
-            }
-        }
-
         QTableWidget* tableWidget = new QTableWidget(this);
         tableWidget->setShowGrid(false);
         tableWidget->setColumnCount(9);
@@ -535,68 +418,41 @@ void TrophyViewer::PopulateTrophyWidget(QString title, QString user) {
         tableWidget->setVerticalScrollMode(QAbstractItemView::ScrollPerPixel);
         tableWidget->horizontalHeader()->setStretchLastSection(false);
         tableWidget->verticalHeader()->setVisible(false);
-        tableWidget->setRowCount(static_cast<int>(icons.size()));
-        tableWidget->setSortingEnabled(true);
+        tableWidget->setRowCount(static_cast<int>(index->trophies.size()));
         tableWidget->setWordWrap(true);
 
-        for (int row = 0; auto& icon : icons) {
+        // Icons are streamed in once they are decoded, until then rows keep their final height
+        QImage placeholder(QSize(TrophyIndex::thumbnail_size, TrophyIndex::thumbnail_size),
+                           QImage::Format_ARGB32_Premultiplied);
+        placeholder.fill(Qt::transparent);
+
+        QStringList iconFiles;
+        iconFiles.reserve(static_cast<qsizetype>(index->trophies.size()));
+        for (int row = 0; const TrophyIndex::Trophy& trophy : index->trophies) {
             QTableWidgetItem* item = new QTableWidgetItem();
-            item->setData(Qt::DecorationRole, icon);
+            item->setData(Qt::DecorationRole, placeholder);
+            item->setData(Qt::UserRole, row);
             item->setFlags(item->flags() & ~Qt::ItemIsEditable);
             tableWidget->setItem(row, 1, item);
+            iconFiles.append(trophy.icon_file);
 
-            const std::string filename = GetTrpType(trpType[row].at(0));
             QTableWidgetItem* typeitem = new QTableWidgetItem();
-
-            const auto CustomTrophy_Dir =
-                Common::FS::GetUserPath(Common::FS::PathType::CustomTrophy);
-            std::string customPath;
-
-            if (fs::exists(CustomTrophy_Dir / filename)) {
-                customPath = (CustomTrophy_Dir / filename).string();
-            }
-
-            std::vector<char> imgdata;
-
-            if (!customPath.empty()) {
-                std::ifstream file(customPath, std::ios::binary);
-                if (file) {
-                    imgdata = std::vector<char>(std::istreambuf_iterator<char>(file),
-                                                std::istreambuf_iterator<char>());
-                }
-            } else {
-                auto resource = cmrc::res::get_filesystem();
-                std::string resourceString = "src/images/" + filename;
-                auto file = resource.open(resourceString);
-                imgdata = std::vector<char>(file.begin(), file.end());
-            }
-
-            QImage type_icon = QImage::fromData(imgdata).scaled(
-                QSize(100, 100), Qt::KeepAspectRatio, Qt::SmoothTransformation);
-            typeitem->setData(Qt::DecorationRole, type_icon);
+            typeitem->setData(Qt::DecorationRole, GetTypeIcon(trophy.grade));
             typeitem->setFlags(typeitem->flags() & ~Qt::ItemIsEditable);
             tableWidget->setItem(row, 5, typeitem);
 
-            std::string detailString = trophyDetails[row].toStdString();
-            std::size_t newline_pos = 0;
-            while ((newline_pos = detailString.find("\n", newline_pos)) != std::string::npos) {
-                detailString.replace(newline_pos, 1, " ");
-                ++newline_pos;
-            }
-
-            if (!trophyNames.isEmpty() && !trophyDetails.isEmpty()) {
-                SetTableItem(tableWidget, row, 0, trpUnlocked[row]);
-                SetTableItem(tableWidget, row, 2, trophyNames[row]);
-                SetTableItem(tableWidget, row, 3, QString::fromStdString(detailString));
-                SetTableItem(tableWidget, row, 4, trpTimeUnlocked[row]);
-                SetTableItem(tableWidget, row, 6, trpId[row]);
-                SetTableItem(tableWidget, row, 7, trpHidden[row]);
-                SetTableItem(tableWidget, row, 8, trpPid[row]);
-            }
+            SetTableItem(tableWidget, row, 0, trophy.unlocked ? "unlocked" : "locked");
+            SetTableItem(tableWidget, row, 2, trophy.name);
+            SetTableItem(tableWidget, row, 3, trophy.detail);
+            SetTableItem(tableWidget, row, 4, FormatUnlockTime(trophy.unlock_time));
+            SetTableItem(tableWidget, row, 6, trophy.id);
+            SetTableItem(tableWidget, row, 7, trophy.hidden ? "yes" : "no");
+            SetTableItem(tableWidget, row, 8, trophy.pid);
 
-            tableWidget->verticalHeader()->resizeSection(row, icon.height());
+            tableWidget->verticalHeader()->resizeSection(row, TrophyIndex::thumbnail_size);
             row++;
         }
+        tableWidget->setSortingEnabled(true);
 
         auto header = tableWidget->horizontalHeader();
         header->setSectionResizeMode(1, QHeaderView::ResizeToContents);
@@ -618,7 +474,8 @@ void TrophyViewer::PopulateTrophyWidget(QString title, QString user) {
             tableWidget->setColumnWidth(3, hardMinDesc);
         }
 
-        tabWidget->addTab(tableWidget, tabName);
+        tabWidget->addTab(tableWidget, index->title);
+        LoadIconsAsync(tableWidget, trophyFilesPath, std::move(iconFiles));
     }
 
     this->setCentralWidget(tabWidget);
@@ -661,6 +518,79 @@ void TrophyViewer::SetTableItem(QTableWidget* parent, int row, int column, QStri
     parent->setItem(row, column, item);
 }
 
+QString TrophyViewer::FormatUnlockTime(s64 time) const {
+    if (time == TrophyIndex::no_time) {
+        return "";
+    }
+    if (time == TrophyIndex::unknown_time) {
+        return "unknown";
+    }
+    const QString format = useEuropeanDateFormat ? "dd/MM/yyyy HH:mm:ss" : "MM/dd/yyyy HH:mm:ss";
+    return QDateTime::fromSecsSinceEpoch(time).toString(format);
+}
+
+QImage TrophyViewer::GetTypeIcon(char grade) {
+    // Every row of a grade shows the same icon, so it is only decoded and scaled once
+    if (const auto it = typeIcons_.find(grade); it != typeIcons_.end()) {
+        return it->second;
+    }
+
+    const std::string filename = GetTrpType(QChar(grade));
+    const auto CustomTrophy_Dir = Common::FS::GetUserPath(Common::FS::PathType::CustomTrophy);
+    std::vector<char> imgdata;
+
+    if (fs::exists(CustomTrophy_Dir / filename)) {
+        std::ifstream file(CustomTrophy_Dir / filename, std::ios::binary);
+        if (file) {
+            imgdata = std::vector<char>(std::istreambuf_iterator<char>(file),
+                                        std::istreambuf_iterator<char>());
+        }
+    } else {
+        auto resource = cmrc::res::get_filesystem();
+        std::string resourceString = "src/images/" + filename;
+        if (resource.exists(resourceString)) {
+            auto file = resource.open(resourceString);
+            imgdata = std::vector<char>(file.begin(), file.end());
+        }
+    }
+
+    QImage type_icon = QImage::fromData(imgdata).scaled(QSize(100, 100), Qt::KeepAspectRatio,
+                                                        Qt::SmoothTransformation);
+    typeIcons_.emplace(grade, type_icon);
+    return type_icon;
+}
+
+void TrophyViewer::LoadIconsAsync(QTableWidget* table, std::filesystem::path trophyDir,
+                                  QStringList iconFiles) {
+    const auto cancel = iconLoadCancel_;
+    (void)QtConcurrent::run([table = QPointer<QTableWidget>(table),
+                             trophyDir = std::move(trophyDir), iconFiles = std::move(iconFiles),
+                             cancel] {
+        for (qsizetype index = 0; index < iconFiles.size(); ++index) {
+            if (cancel->load()) {
+                return;
+            }
+            const QImage icon = TrophyIndex::Thumbnail(trophyDir, iconFiles[index]);
+            QMetaObject::invokeMethod(
+                qApp,
+                [table, index, icon] {
+                    if (!table) {
+                        return;
+                    }
+                    // Rows may have been sorted, the icon item remembers its trophy
+                    for (int row = 0; row < table->rowCount(); ++row) {
+                        QTableWidgetItem* item = table->item(row, 1);
+                        if (item && item->data(Qt::UserRole).toLongLong() == index) {
+                            item->setData(Qt::DecorationRole, icon);
+                            break;
+                        }
+                    }
+                },
+                Qt::QueuedConnection);
+        }
+    });
+}
+
 std::filesystem::path TrophyViewer::GetTrpFilesPath(std::filesystem::path gamePath) {
     if (!gamePath.string().ends_with("-patch") && !gamePath.string().ends_with("-Update")) {
         return gamePath;
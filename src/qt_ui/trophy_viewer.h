@@ -3,6 +3,9 @@
 
 #pragma once
 
+#include <atomic>
+#include <map>
+#include <memory>
 #include <QApplication>
 #include <QCheckBox>
 #include <QComboBox>
@@ -38,6 +41,7 @@ public:
         std::shared_ptr<GUISettings> gui_settings, QString trophyPath, QString gameTrpPath,
         QString gameName = "",
         const QVector<TrophyGameInfo>& allTrophyGames = QVector<TrophyGameInfo>());
+    ~TrophyViewer() override;
 
     void updateTrophyInfo();
     void updateTableFilters();
@@ -51,6 +55,11 @@ private:
     void PopulateTrophyWidget(QString title, QString user);
     void SetTableItem(QTableWidget* parent, int row, int column, QString str);
     std::filesystem::path GetTrpFilesPath(std::filesystem::path gamePath);
+    QString FormatUnlockTime(s64 time) const;
+    QImage GetTypeIcon(char grade);
+    // Decodes the trophy icons of a table on a worker and shows them as they arrive
+    void LoadIconsAsync(QTableWidget* table, std::filesystem::path trophyDir,
+                        QStringList iconFiles);
     bool userResizedWindow_ = false;
     bool programmaticResize_ = false;
     bool initialSizeApplied_ = false;
@@ -59,8 +68,8 @@ private:
     QStringList headers;
     QString gameTrpPath_;
     QString currentGameName_;
-    TRP trp;
     QLabel* trophyInfoLabel;
+    QLabel* libraryProgressLabel;
     QCheckBox* showEarnedCheck;
     QCheckBox* showNotEarnedCheck;
     QCheckBox* showHiddenCheck;
@@ -71,6 +80,10 @@ private:
     QPushButton* reopenButton;
     QVector<TrophyGameInfo> allTrophyGames_;
     std::vector<std::string> npCommIds;
+    std::string currentUserId_ = "1000";
+    std::map<char, QImage> typeIcons_;
+    // Set when the tables whose icons are loading are replaced
+    std::shared_ptr<std::atomic<bool>> iconLoadCancel_ = std::make_shared<std::atomic<bool>>(false);
 
     std::string GetTrpType(const QChar trp_) {
         switch (trp_.toLatin1()) {
@@ -20,14 +20,21 @@
 #include <QTimer>
 #include <QVBoxLayout>
 #include <common/path_util.h>
+#include <common/version_store.h>
 #include <common/versions.h>
-#include <common/zip_util.h>
 #include "gui_settings.h"
 #include "qt_ui/main_window.h"
 #include "qt_utils.h"
 #include "ui_version_dialog.h"
 #include "version_dialog.h"
 
+namespace {
+
+// Release archives are large enough that parallel ranges pay off for the extra requests
+constexpr int release_download_chunks = 4;
+
+} // namespace
+
 VersionDialog::VersionDialog(std::shared_ptr<GUISettings> gui_settings, QWidget* parent)
     : QDialog(parent), ui(new Ui::VersionDialog), m_gui_settings(std::move(gui_settings)) {
     ui->setupUi(this);
@@ -201,7 +208,7 @@ VersionDialog::VersionDialog(std::shared_ptr<GUISettings> gui_settings, QWidget*
                 if (isShadps4Zip) {
                     extractedHash = match.captured(2);
                     // Extract everything to destFolder directly (keep all files)
-                    Zip::Extract(filePath, destFolder);
+                    VersionStore::Install(filePath, destFolder);
 
                     // Find the executable in the extracted folder
                     QDirIterator it(destFolder, QDirIterator::Subdirectories);
@@ -268,7 +275,7 @@ VersionDialog::VersionDialog(std::shared_ptr<GUISettings> gui_settings, QWidget*
 
                 } else {
                     // Regular zip extraction
-                    Zip::Extract(filePath, destFolder);
+                    VersionStore::Install(filePath, destFolder);
 
                     // Find the executable in the extracted folder
                     QDirIterator it(destFolder, QDirIterator::Subdirectories);
@@ -582,6 +589,8 @@ VersionDialog::VersionDialog(std::shared_ptr<GUISettings> gui_settings, QWidget*
                 return;
             }
         }
+        VersionStore::CollectGarbage(
+            m_gui_settings->GetValue(GUI::version_manager_versionPath).toString());
 
         VersionManager::RemoveVersion(versionName.toStdString());
         LoadInstalledList();
@@ -691,6 +700,7 @@ void VersionDialog::DownloadListVersion() {
     connect(m_downloader, &Downloader::SignalDownloadFinished, this,
             [this]() { PopulateDownloadTree(); });
 
+    m_downloader->SetParallelChunks(1);
     m_downloader->DownloadJSONWithCache(downloadUrl.toStdString(), cachePath, true,
                                         tr("Checking for new emulator versions..."), 2000);
 }
@@ -785,6 +795,7 @@ tr("First you need to choose a location to save the versions in\n'Path to save v
                 QString zipPath = QDir(userPath).filePath("temp_download_update.zip");
 
                 disconnect(m_downloader, nullptr, this, nullptr);
+                m_downloader->SetParallelChunks(release_download_chunks);
                 m_downloader->DownloadJSONWithCache(downloadUrl.toStdString(), zipPath, true,
                                                     tr("Downloading") + " " + versionName, 0);
 
@@ -796,7 +807,7 @@ tr("First you need to choose a location to save the versions in\n'Path to save v
 
                 connect(
                     m_downloader, &Downloader::SignalDownloadFinished, this,
-                    [this, release, versionName, userPath, zipPath](const QByteArray&) {
+                    [this, release, versionName, userPath, zipPath](const QString&) {
                         QString normalizedVersionName = versionName;
                         // Normalize version format: convert "v.0.11.0" to "v0.11.0"
                         // Also handle other possible formats
@@ -831,7 +842,7 @@ tr("First you need to choose a location to save the versions in\n'Path to save v
 
                         // extract ZIP to version folder
                         try {
-                            Zip::Extract(zipPath, destFolder);
+                            VersionStore::Install(zipPath, destFolder);
                             QFile::remove(zipPath);
                         } catch (const std::exception& e) {
                             QMessageBox::critical(this, tr("Error"),
@@ -1429,6 +1440,7 @@ void VersionDialog::showDownloadDialog(const QString& tagName, const QString& do
 
     disconnect(m_downloader, nullptr, this, nullptr);
 
+    m_downloader->SetParallelChunks(release_download_chunks);
     m_downloader->DownloadJSONWithCache(downloadUrl.toStdString(), zipPath, true,
                                         tr("Downloading Pre-release (Nightly)"), 0);
 
@@ -1448,8 +1460,10 @@ void VersionDialog::showDownloadDialog(const QString& tagName, const QString& do
             }
 
             try {
-                Zip::Extract(zipPath, destFolder);
+                VersionStore::Install(zipPath, destFolder);
                 QFile::remove(zipPath);
+                // The files only the previous nightly had are not referenced anymore
+                VersionStore::CollectGarbage(userPath);
             } catch (const std::exception& e) {
                 QMessageBox::critical(this, tr("Error"),
                                       tr("Extraction failure:") + ("\n") + e.what());